@@ -0,0 +1,61 @@
+#pragma once
+
+#include <userver/components/component_context.hpp>
+#include <userver/engine/task/cancel.hpp>
+#include <userver/formats/json/inline.hpp>
+#include <userver/server/handlers/http_handler_base.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
+#include <userver/testsuite/testpoint.hpp>
+#include <userver/utest/using_namespace_userver.hpp>
+
+namespace chaos {
+
+class RequestBodyStreamHandler final : public server::handlers::HttpHandlerBase {
+public:
+    static constexpr std::string_view kName = "handler-chaos-request-body-stream";
+
+    RequestBodyStreamHandler(const components::ComponentConfig& config, const components::ComponentContext& context)
+        : HttpHandlerBase(config, context) {}
+
+    std::string HandleRequestThrow(const server::http::HttpRequest& request, server::request::RequestContext&)
+        const override {
+        const auto& type = request.GetArg("type");
+
+        if (type == "ignore") {
+            // The rest of the body is skipped by the connection
+            return "ignored";
+        }
+
+        if (type == "wait") {
+            // The client is slowed down while the handler does not read the body
+            TESTPOINT("request_body_stream_wait", {});
+        } else if (type != "echo" && type != "chunks") {
+            UINVARIANT(false, "Unexpected request type");
+        }
+
+        std::string body;
+        try {
+            /// [ReadChunk]
+            std::string chunk;
+            auto& body_stream = request.GetBodyStream();
+            while (body_stream.ReadChunk(chunk)) {
+                if (type == "chunks") {
+                    // The chunk is reported even if the client has gone meanwhile
+                    const engine::TaskCancellationBlocker block_cancel;
+                    TESTPOINT("request_body_stream_chunk", formats::json::MakeObject("chunk", chunk));
+                }
+                body += chunk;
+            }
+            /// [ReadChunk]
+        } catch (const server::http::RequestBodyStreamError& e) {
+            const engine::TaskCancellationBlocker block_cancel;
+            TESTPOINT("request_body_stream_error", formats::json::MakeObject("body_size", body.size()));
+            throw;
+        }
+
+        if (type == "wait") return std::to_string(body.size());
+        return body;
+    }
+};
+
+}  // namespace chaos
@@ -18,6 +18,7 @@
 #include "httpclient_handlers.hpp"
 #include "httpserver_handlers.hpp"
 #include "httpserver_with_exception_handler.hpp"
+#include "request_body_stream_handlers.hpp"
 #include "resolver_handlers.hpp"
 
 int main(int argc, char* argv[]) {
@@ -28,6 +29,7 @@ int main(int argc, char* argv[]) {
                                     .Append<chaos::HttpServerHandler>("handler-chaos-httpserver-parse-body-args")
                                     .Append<chaos::ResolverHandler>()
                                     .Append<chaos::HttpServerWithExceptionHandler>()
+                                    .Append<chaos::RequestBodyStreamHandler>()
                                     .Append<components::LoggingConfigurator>()
                                     .Append<components::HttpClient>()
                                     .Append<components::TestsuiteSupport>()
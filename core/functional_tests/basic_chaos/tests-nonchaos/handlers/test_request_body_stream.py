@@ -0,0 +1,176 @@
+import asyncio
+import socket
+
+import pytest
+
+DEFAULT_PATH = '/chaos/request-body-stream'
+RECEIVE_SIZE = 1 << 16
+# Much more than the socket buffers and the body queue of the connection
+BACKPRESSURE_BODY_SIZE = 64 * 1024 * 1024
+BLOCKED_SEND_TIMEOUT = 1.0
+
+
+def _request_head(htype, headers):
+    head = f'POST {DEFAULT_PATH}?type={htype} HTTP/1.1\r\nHost: localhost\r\n'
+    for name, value in headers.items():
+        head += f'{name}: {value}\r\n'
+    return (head + '\r\n').encode('utf-8')
+
+
+async def _connect(loop, service_port):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    sock.setblocking(False)
+    await loop.sock_connect(sock, ('localhost', service_port))
+    return sock
+
+
+async def _recv_response(loop, sock, buffer=b''):
+    while b'\r\n\r\n' not in buffer:
+        data = await loop.sock_recv(sock, RECEIVE_SIZE)
+        assert data, 'Connection was closed before the response headers'
+        buffer += data
+
+    head, body = buffer.split(b'\r\n\r\n', 1)
+    status_line, *header_lines = head.decode('utf-8').split('\r\n')
+    headers = {}
+    for line in header_lines:
+        name, value = line.split(':', 1)
+        headers[name.strip().lower()] = value.strip()
+
+    content_length = int(headers['content-length'])
+    while len(body) < content_length:
+        data = await loop.sock_recv(sock, RECEIVE_SIZE)
+        assert data, 'Connection was closed before the response body'
+        body += data
+    return status_line, body[:content_length], body[content_length:]
+
+
+@pytest.fixture(name='chunk_testpoint')
+async def _chunk_testpoint(testpoint, service_client):
+    @testpoint('request_body_stream_chunk')
+    def chunk_testpoint(_data):
+        pass
+
+    await service_client.update_server_state()
+    return chunk_testpoint
+
+
+async def test_content_length(loop, service_port, chunk_testpoint):
+    sock = await _connect(loop, service_port)
+    await loop.sock_sendall(
+        sock,
+        _request_head('chunks', {'Content-Length': 10}) + b'aaaaa',
+    )
+    assert await chunk_testpoint.wait_call() == {'data': {'chunk': 'aaaaa'}}
+
+    await loop.sock_sendall(sock, b'bbbbb')
+    assert await chunk_testpoint.wait_call() == {'data': {'chunk': 'bbbbb'}}
+
+    status_line, body, _ = await _recv_response(loop, sock)
+    assert status_line == 'HTTP/1.1 200 OK'
+    assert body == b'aaaaabbbbb'
+    sock.close()
+
+
+async def test_chunked(loop, service_port, chunk_testpoint):
+    sock = await _connect(loop, service_port)
+    await loop.sock_sendall(
+        sock,
+        _request_head('chunks', {'Transfer-Encoding': 'chunked'}) + b'5\r\nhello\r\n',
+    )
+    assert await chunk_testpoint.wait_call() == {'data': {'chunk': 'hello'}}
+
+    await loop.sock_sendall(sock, b'6\r\n world\r\n0\r\n\r\n')
+    assert await chunk_testpoint.wait_call() == {'data': {'chunk': ' world'}}
+
+    status_line, body, _ = await _recv_response(loop, sock)
+    assert status_line == 'HTTP/1.1 200 OK'
+    assert body == b'hello world'
+    sock.close()
+
+
+async def test_early_return_pipelined(loop, service_port, service_client):
+    ignored_body = b'x' * (1024 * 1024)
+    requests = (
+        _request_head('ignore', {'Content-Length': len(ignored_body)})
+        + ignored_body
+        + _request_head('echo', {'Content-Length': 5})
+        + b'hello'
+    )
+
+    sock = await _connect(loop, service_port)
+    await loop.sock_sendall(sock, requests)
+
+    status_line, body, rest = await _recv_response(loop, sock)
+    assert status_line == 'HTTP/1.1 200 OK'
+    assert body == b'ignored'
+
+    # The rest of the ignored body is skipped, not parsed as a request
+    status_line, body, _ = await _recv_response(loop, sock, rest)
+    assert status_line == 'HTTP/1.1 200 OK'
+    assert body == b'hello'
+    sock.close()
+
+
+async def test_client_closed_mid_body(
+    loop,
+    service_port,
+    testpoint,
+    service_client,
+    chunk_testpoint,
+):
+    @testpoint('request_body_stream_error')
+    def error_testpoint(_data):
+        pass
+
+    await service_client.update_server_state()
+
+    sock = await _connect(loop, service_port)
+    await loop.sock_sendall(
+        sock,
+        _request_head('chunks', {'Content-Length': 1000}) + b'x' * 10,
+    )
+    assert await chunk_testpoint.wait_call() == {'data': {'chunk': 'x' * 10}}
+
+    sock.close()
+    assert await error_testpoint.wait_call() == {'data': {'body_size': 10}}
+
+
+async def test_backpressure(loop, service_port, testpoint, service_client):
+    started = asyncio.Event()
+    release = asyncio.Event()
+
+    @testpoint('request_body_stream_wait')
+    async def _wait_testpoint(_data):
+        started.set()
+        await release.wait()
+
+    await service_client.update_server_state()
+
+    body = memoryview(b'x' * BACKPRESSURE_BODY_SIZE)
+    sock = await _connect(loop, service_port)
+    await loop.sock_sendall(
+        sock,
+        _request_head('wait', {'Content-Length': len(body)}),
+    )
+    await started.wait()
+
+    # The connection stops reading the body while the handler does not read it
+    sent = 0
+    blocked_for = 0.0
+    while blocked_for < BLOCKED_SEND_TIMEOUT and sent < len(body):
+        try:
+            sent += sock.send(body[sent:])
+            blocked_for = 0.0
+        except BlockingIOError:
+            await asyncio.sleep(0.1)
+            blocked_for += 0.1
+    assert sent < len(body)
+
+    release.set()
+    await loop.sock_sendall(sock, body[sent:])
+
+    status_line, response_body, _ = await _recv_response(loop, sock)
+    assert status_line == 'HTTP/1.1 200 OK'
+    assert response_body == str(len(body)).encode('utf-8')
+    sock.close()
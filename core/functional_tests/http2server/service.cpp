@@ -7,6 +7,7 @@
 #include <userver/server/handlers/ping.hpp>
 #include <userver/server/handlers/server_monitor.hpp>
 #include <userver/server/handlers/tests_control.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_response_body_stream.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
 #include <userver/utest/using_namespace_userver.hpp>
@@ -83,6 +84,35 @@ public:
     };
 };
 
+class HandlerHttp2RequestBodyStream final : public server::handlers::HttpHandlerBase {
+public:
+    static constexpr std::string_view kName = "handler-http2-request-body-stream";
+
+    HandlerHttp2RequestBodyStream(
+        const components::ComponentConfig& config,
+        const components::ComponentContext& context
+    )
+        : server::handlers::HttpHandlerBase(config, context) {}
+
+    std::string HandleRequestThrow(const server::http::HttpRequest& req, server::request::RequestContext&)
+        const override {
+        const auto& type = req.GetArg("type");
+        if (type == "ignore") {
+            // The window of the skipped body is given back to the client
+            return "ignored";
+        }
+
+        std::string body;
+        std::string chunk;
+        auto& body_stream = req.GetBodyStream();
+        while (body_stream.ReadChunk(chunk)) {
+            if (type == "slow") engine::SleepFor(std::chrono::milliseconds{1});
+            body += chunk;
+        }
+        return body;
+    };
+};
+
 int main(int argc, char* argv[]) {
     auto component_list = components::MinimalServerComponentList()
                               .Append<components::TestsuiteSupport>()
@@ -94,6 +124,7 @@ int main(int argc, char* argv[]) {
                               .Append<components::DynamicConfigClient>()
                               .Append<HandlerHttp2>()
                               .Append<HandlerHttp2Stream>()
+                              .Append<HandlerHttp2RequestBodyStream>()
                               .Append<server::handlers::Ping>();
 
     return utils::DaemonMain(argc, argv, component_list);
@@ -0,0 +1,59 @@
+import asyncio
+
+DEFAULT_PATH = '/http2server-request-body-stream'
+# Much more than the initial window of a stream
+BODY_SIZE = 4 * 1024 * 1024
+
+
+async def test_data_stream(http2_client):
+    data = 'abcdefgh' * (BODY_SIZE // 8)
+    r = await http2_client.post(
+        DEFAULT_PATH,
+        params={'type': 'echo'},
+        data=data,
+        timeout=30.0,
+    )
+    assert 200 == r.status_code
+    assert data == r.text
+
+
+async def test_slow_handler_does_not_stall_other_streams(http2_client):
+    data = 'x' * BODY_SIZE
+    slow = asyncio.create_task(
+        http2_client.post(
+            DEFAULT_PATH,
+            params={'type': 'slow'},
+            data=data,
+            timeout=30.0,
+        ),
+    )
+
+    for _ in range(10):
+        r = await http2_client.post(
+            DEFAULT_PATH,
+            params={'type': 'echo'},
+            data='hello',
+        )
+        assert 200 == r.status_code
+        assert 'hello' == r.text
+
+    r = await slow
+    assert 200 == r.status_code
+    assert data == r.text
+
+
+async def test_ignored_body(http2_client):
+    for _ in range(3):
+        r = await http2_client.post(
+            DEFAULT_PATH,
+            params={'type': 'ignore'},
+            data='x' * BODY_SIZE,
+            timeout=30.0,
+        )
+        assert 200 == r.status_code
+        assert 'ignored' == r.text
+
+    # The window of the skipped bodies was given back to the connection
+    r = await http2_client.post(DEFAULT_PATH, params={'type': 'echo'}, data='hello')
+    assert 200 == r.status_code
+    assert 'hello' == r.text
@@ -67,6 +67,26 @@ async def test_too_big(websocket_client):
         assert exc.value.rcvd.code == 1009
 
 
+async def test_deflate(websocket_client):
+    async with websocket_client.get('chat') as chat:
+        assert [ext.name for ext in chat.extensions] == ['permessage-deflate']
+
+        msg = '{"delta": "' + 'abc' * 10000 + '"}'
+        for _ in range(3):
+            await chat.send(msg)
+            response = await chat.recv()
+            assert response == msg
+
+
+async def test_deflate_disabled(websocket_client):
+    async with websocket_client.get('handler-alt') as chat:
+        assert not chat.extensions
+
+        await chat.send('hello' * 100)
+        response = await chat.recv()
+        assert response == 'hello' * 100
+
+
 async def test_origin(service_client, service_port):
     async with websockets.connect(
         f'ws://localhost:{service_port}/chat',
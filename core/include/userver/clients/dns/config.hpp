@@ -39,6 +39,10 @@ struct ResolverConfig {
 
     /// Network cache failure TTL
     std::chrono::milliseconds cache_failure_ttl{std::chrono::seconds{5}};
+
+    /// Share of the reply TTL before the expiration of a network cache record,
+    /// in which a lookup of the record refreshes it in background
+    double cache_refresh_ahead_ratio{0.2};
 };
 
 }  // namespace clients::dns
@@ -3,6 +3,8 @@
 /// @file userver/clients/dns/resolver.hpp
 /// @brief @copybrief clients::dns::Resolver
 
+#include <optional>
+
 #include <userver/clients/dns/common.hpp>
 #include <userver/clients/dns/config.hpp>
 #include <userver/clients/dns/exception.hpp>
@@ -50,6 +52,16 @@ public:
     /// a result within the specified deadline.
     AddrVector Resolve(const std::string& name, engine::Deadline deadline);
 
+    /// @brief Performs a domain name resolution without network queries.
+    ///
+    /// Same as Resolve(), but returns std::nullopt instead of querying the
+    /// network name servers. A cached record close to its expiration is
+    /// refreshed in background.
+    ///
+    /// @throws clients::dns::NotResolvedException if the name is invalid or
+    /// its resolution has failed recently.
+    std::optional<AddrVector> ResolveCached(const std::string& name);
+
     /// Returns lookup source counters.
     const LookupSourceCounters& GetLookupSourceCounters() const;
 
@@ -0,0 +1,52 @@
+#pragma once
+
+/// @file userver/clients/http/adaptive_hedging.hpp
+/// @brief @copybrief clients::http::AdaptiveHedgingSettings
+
+#include <chrono>
+#include <cstddef>
+
+#include <userver/utils/retry_budget.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// @brief Settings of clients::http::Client::PerformHedged(), that sends a
+/// backup request if the previous one takes longer than the recent latency
+/// percentile of the destination.
+///
+/// The destination is the URL without the query, the same as for the
+/// automatically created destination metrics.
+struct AdaptiveHedgingSettings final {
+    /// Max number of requests, including the primary one
+    std::size_t max_attempts{2};
+
+    /// Percentile of the recent request timings of the destination to wait
+    /// for before sending the next request
+    double percentile{95.0};
+
+    /// Min number of the recent requests to the destination to rely on their
+    /// timings, `fallback_delay` is used until there are enough of them
+    std::size_t min_samples{100};
+
+    /// Delay before the next request if there are not enough timings
+    std::chrono::milliseconds fallback_delay{100};
+
+    /// Lower bound of the delay before the next request
+    std::chrono::milliseconds min_delay{1};
+
+    /// Max time to wait for the requests
+    std::chrono::milliseconds timeout_all{1000};
+
+    /// @brief Budget of the backup requests to the destination. Each request
+    /// puts `token_ratio` tokens into it, each backup request takes one, and
+    /// no backup requests are sent while it is less than half full.
+    ///
+    /// Applied once per destination, when it is first seen.
+    utils::RetryBudgetSettings budget{};
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
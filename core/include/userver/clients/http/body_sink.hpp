@@ -0,0 +1,61 @@
+#pragma once
+
+/// @file userver/clients/http/body_sink.hpp
+/// @brief @copybrief clients::http::ResponseBodySink
+
+#include <cstddef>
+#include <string_view>
+
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// @brief Receives the response body instead of clients::http::Response,
+/// see clients::http::Request::response_body_sink().
+///
+/// The methods are called from the HTTP client IO threads while the request
+/// is in flight, so they must not block or wait for the coroutine engine.
+class ResponseBodySink {
+public:
+    virtual ~ResponseBodySink();
+
+    /// Called before each attempt of the request to drop the data received
+    /// by the previous one.
+    virtual void Clear() noexcept = 0;
+
+    /// Called with the value of the Content-Length header of a response
+    /// before its body arrives. The value comes from the server and is not
+    /// validated, so the sink should not trust a huge one. An exception is
+    /// ignored, the default implementation does nothing.
+    virtual void Reserve(std::size_t size);
+
+    /// Called for each chunk of the response body. An exception aborts the
+    /// request with an error.
+    virtual void Append(std::string_view data) = 0;
+};
+
+/// @brief ResponseBodySink that writes the body into a caller-provided buffer.
+///
+/// A body that does not fit into the buffer aborts the request with an error.
+///
+/// @warning The buffer must outlive the request.
+class BufferBodySink final : public ResponseBodySink {
+public:
+    explicit BufferBodySink(utils::span<char> buffer) noexcept;
+
+    void Clear() noexcept override;
+    void Append(std::string_view data) override;
+
+    /// @returns the part of the buffer filled with the body
+    std::string_view GetBody() const noexcept;
+
+private:
+    utils::span<char> buffer_;
+    std::size_t size_{0};
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -7,11 +7,13 @@
 #error Use clients::Http from clients/http.hpp instead
 #endif
 
+#include <functional>
 #include <memory>
 
 #include <userver/moodycamel/concurrentqueue_fwd.h>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
+#include <userver/clients/http/adaptive_hedging.hpp>
 #include <userver/clients/http/config.hpp>
 #include <userver/clients/http/plugin.hpp>
 #include <userver/clients/http/request.hpp>
@@ -45,6 +47,9 @@ class EasyWrapper;
 }  // namespace impl
 
 struct TestsuiteConfig;
+class AdaptiveHedging;
+class Http2Pool;
+class RequestCoalescer;
 class Statistics;
 struct PoolStatistics;
 struct InstanceStatistics;
@@ -77,6 +82,23 @@ public:
     /// @note This method is thread-safe despite being non-const.
     Request CreateNotSignedRequest() { return CreateRequest(); }
 
+    /// @brief Performs a request set up by `setup` on a request from
+    /// CreateRequest(), and sends the same backup requests if the previous
+    /// one takes longer than the recent latency percentile of the destination.
+    ///
+    /// Returns the response or throws the exception of the first request to
+    /// finish, the rest are cancelled. Backup requests are limited by the
+    /// budget of the destination, so that they do not amplify its overload.
+    /// See AdaptiveHedgingSettings.
+    ///
+    /// The timings of the destination are taken from its destination metrics,
+    /// so those should not be disabled or set to another destination name.
+    ///
+    /// @throws clients::http::TimeoutException if none of the requests
+    /// finished in AdaptiveHedgingSettings::timeout_all
+    std::shared_ptr<Response>
+    PerformHedged(const std::function<void(Request&)>& setup, const AdaptiveHedgingSettings& settings = {});
+
     /// @cond
     // For internal use only.
     void SetMultiplexingEnabled(bool enabled);
@@ -94,6 +116,13 @@ public:
     // For internal use only.
     const http::DestinationStatistics& GetDestinationStatistics() const;
 
+    // For internal use only.
+    const AdaptiveHedging& GetAdaptiveHedging() const;
+
+    // Returns nullptr if the HTTP/2 pool is disabled.
+    // For internal use only.
+    const Http2Pool* GetHttp2Pool() const;
+
     // For internal use only.
     void SetTestsuiteConfig(const TestsuiteConfig& config);
 
@@ -146,6 +175,9 @@ private:
     CancellationPolicy cancellation_policy_;
 
     std::shared_ptr<DestinationStatistics> destination_statistics_;
+    std::shared_ptr<RequestCoalescer> request_coalescer_;
+    std::unique_ptr<AdaptiveHedging> adaptive_hedging_;
+    std::shared_ptr<Http2Pool> http2_pool_;
     std::unique_ptr<engine::ev::ThreadPool> thread_pool_;
     std::vector<Statistics> statistics_;
     std::vector<std::unique_ptr<curl::multi>> multis_;
@@ -48,6 +48,8 @@ namespace components {
 /// set-deadline-propagation-header | whether to set http::common::kXYaTaxiClientTimeoutMs request header, see @ref scripts/docs/en/userver/deadline_propagation.md | true
 /// plugins | Plugin names to apply. A plugin component is called "http-client-plugin-" plus the plugin name. | []
 /// cancellation-policy | Cancellation policy for new requests. | cancel
+/// http2-pool.enabled | set to true to place the HTTP/2 requests of a destination onto the IO threads already connected to it, so that they share the connections | false
+/// http2-pool.max-streams-per-connection | max number of concurrent requests over a single HTTP/2 connection | 100
 ///
 /// ## Static configuration example:
 ///
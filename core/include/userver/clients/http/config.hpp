@@ -26,6 +26,12 @@ enum class CancellationPolicy {
 
 CancellationPolicy Parse(yaml_config::YamlConfig value, formats::parse::To<CancellationPolicy>);
 
+struct Http2PoolSettings final {
+    /// Place the HTTP/2 requests to a destination onto the same io threads
+    bool enabled{false};
+    std::size_t max_streams_per_connection{100};
+};
+
 // Static config
 struct ClientSettings final {
     std::string thread_name_prefix{};
@@ -33,6 +39,7 @@ struct ClientSettings final {
     DeadlinePropagationConfig deadline_propagation{};
     const tracing::TracingManagerBase* tracing_manager{nullptr};
     CancellationPolicy cancellation_policy{CancellationPolicy::kCancel};
+    Http2PoolSettings http2_pool{};
 };
 
 ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<ClientSettings>);
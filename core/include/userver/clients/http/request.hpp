@@ -28,12 +28,15 @@ class TracingManagerBase;
 namespace clients::http {
 
 class RequestState;
+class ResponseBodySink;
 class StreamedResponse;
 class ConnectTo;
 class Form;
 struct DeadlinePropagationConfig;
 class RequestStats;
 class DestinationStatistics;
+class RequestCoalescer;
+class Http2Pool;
 struct TestsuiteConfig;
 
 namespace impl {
@@ -264,6 +267,12 @@ public:
 
     // Set deadline propagation settings. For internal use only.
     void SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config) &;
+
+    // Set the storage of the in-flight coalesced requests. For internal use only.
+    void SetRequestCoalescer(const std::shared_ptr<RequestCoalescer>& coalescer) &;
+
+    // Set the placement of the HTTP/2 requests. For internal use only.
+    void SetHttp2Pool(const std::shared_ptr<Http2Pool>& http2_pool) &;
     /// @endcond
 
     /// Disable auto-decoding of received replies.
@@ -273,6 +282,38 @@ public:
 
     void SetCancellationPolicy(CancellationPolicy cp);
 
+    /// @brief Share one upstream request between the concurrent identical
+    /// requests of the client. Default: do not share.
+    ///
+    /// While a GET or HEAD request with the same URL, headers, cookies and
+    /// proxy is in flight, async_perform() does not start a new one and waits
+    /// for the response of the in-flight request instead, getting its own copy
+    /// of the response or the same exception. Other settings, e.g. timeouts,
+    /// retries, authentication and TLS, of the in-flight request apply, so
+    /// enable it only for the requests that do not differ in those.
+    ///
+    /// The in-flight request is not cancelled if the task that started it is
+    /// cancelled, as if CancellationPolicy::kIgnore was set for it.
+    /// Requests with other methods, with a body or a custom method are never
+    /// shared.
+    Request& coalesce(bool enable = true) &;
+    Request coalesce(bool enable = true) &&;
+
+    /// @brief Write the response body into the sink right from the HTTP client
+    /// IO thread, without storing it in the Response. Default: store in the
+    /// Response.
+    ///
+    /// Useful for large bodies that go to a preallocated storage, e.g. a
+    /// buffer of clients::http::BufferBodySink: the body is not accumulated
+    /// in a growing std::string and is not copied after the request finishes.
+    /// Response::body() of such a request is empty, the body of an
+    /// unsuccessful response also goes to the sink.
+    ///
+    /// The sink is ignored by async_perform_stream_body(). Requests with a
+    /// sink are never coalesced.
+    Request& response_body_sink(std::shared_ptr<ResponseBodySink> sink) &;
+    Request response_body_sink(std::shared_ptr<ResponseBodySink> sink) &&;
+
     /// Override the default tracing manager from HTTP client for this
     /// particular request.
     Request& SetTracingManager(const tracing::TracingManagerBase&) &;
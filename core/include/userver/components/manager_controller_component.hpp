@@ -33,9 +33,13 @@ class Manager;
 /// coro_pool.initial_size | amount of coroutines to preallocate on startup | 1000
 /// coro_pool.max_size | max amount of coroutines to keep preallocated | 4000
 /// coro_pool.stack_size | size of a single coroutine | 256 * 1024
+/// coro_pool.small_stack_size | stack size for engine::StackSize::kSmall tasks, 0 to use stack_size | 0
+/// coro_pool.large_stack_size | stack size for engine::StackSize::kLarge tasks, 0 to use stack_size | 0
+/// coro_pool.numa_aware | keep idle coroutines per NUMA node, so that stacks stay local to the workers | false
 /// coro_pool.local_cache_size | local coroutine cache size per thread | 32
 /// event_thread_pool.threads | number of threads to process low level IO system calls (number of ev loops to start in libev) | 2
 /// event_thread_pool.thread_name | set OS thread name to this value | 'event-worker'
+/// event_thread_pool.io_uring | whether socket reads and writes that would block are submitted to a per ev thread io_uring instead of waiting for readiness via epoll; falls back to epoll if the kernel (5.19+ is required) does not support it | false
 /// components | dictionary of "component name": "options" | -
 /// default_task_processor | name of the default task processor to use in components | -
 /// task_processors.*NAME*.*OPTIONS* | dictionary of task processors to create and their options. See description below | -
@@ -54,7 +58,11 @@ class Manager;
 /// worker_threads | threads count for the task processor | -
 /// os-scheduling | OS scheduling mode for the task processor threads. 'idle' sets the lowest priority. 'low-priority' sets the priority below 'normal' but higher than 'idle'. | normal
 /// spinning-iterations | tunes the number of spin-wait iterations in case of an empty task queue before threads go to sleep | 1000
+/// adaptive-spinning | learn the number of spin-wait iterations (up to `spinning-iterations`) from the recent task arrivals and let only half of the idle threads spin; the decisions are reported in `engine.task-processors.worker-parking` metrics; only for `global-task-queue` | false
 /// task-processor-queue | Task queue mode for the task processor. `global-task-queue` default task queue. `work-stealing-task-queue` experimental with potentially better scalability than `global-task-queue`. | global-task-queue
+/// pin-worker-threads | pin each worker thread to a single CPU, neighbour workers get CPUs that share caches and NUMA nodes; with `work-stealing-task-queue` workers steal from the nearest workers first. Intended for a single CPU-bound task processor, as workers of different task processors are pinned to the same CPUs | false
+/// task-priorities | take tasks from the queue in the order of their engine::TaskPriority, lower priorities still get a small share of the workers | false
+/// deadline-scheduling | take non-kLow tasks with a deadline (e.g. handler tasks with a propagated deadline) from the queue in the earliest-deadline-first order before the other tasks; only for `global-task-queue` | false
 /// task-trace | optional dictionary of tracing options | empty (disabled)
 /// task-trace.every | set N to trace each Nth task | 1000
 /// task-trace.max-context-switch-count | set upper limit of context switches to trace for a single task | 1000
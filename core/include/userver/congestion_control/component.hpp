@@ -63,7 +63,7 @@ private:
     void ExtendWriter(utils::statistics::Writer& writer);
 
     struct Impl;
-    utils::FastPimpl<Impl, 704, 16> pimpl_;
+    utils::FastPimpl<Impl, 768, 16> pimpl_;
 };
 
 }  // namespace congestion_control
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include <userver/congestion_control/controllers/gradient.hpp>
+#include <userver/congestion_control/controllers/linear.hpp>
+#include <userver/congestion_control/controllers/v2.hpp>
+#include <userver/dynamic_config/source.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+/// Static config of a congestion controller of a database pool
+struct StaticConfig {
+    bool fake_mode{false};
+    bool enabled{true};
+    /// GradientController is used instead of the LinearController if set
+    std::optional<GradientConfig> gradient;
+};
+
+/// Parses `algorithm: linear|gradient` and the `gradient` settings
+/// along with the common `fake-mode` and `enabled` options
+StaticConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<StaticConfig>);
+
+/// Schema of the StaticConfig options, for the `congestion_control` option of
+/// the database components
+yaml_config::Schema GetStaticConfigSchema();
+
+/// Creates the controller selected by the static config, `linear_config_getter`
+/// is only used by the LinearController
+std::unique_ptr<Controller> MakeController(
+    const std::string& name,
+    v2::Sensor& sensor,
+    Limiter& limiter,
+    Stats& stats,
+    const StaticConfig& config,
+    dynamic_config::Source config_source,
+    std::function<v2::Config(const dynamic_config::Snapshot&)> linear_config_getter
+);
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include <userver/congestion_control/controllers/v2.hpp>
+#include <userver/congestion_control/limiter.hpp>
+#include <userver/yaml_config/schema.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+struct GradientConfig {
+    /// The limit never goes below this value
+    std::size_t min_limit{10};
+    /// The limit never goes above this value
+    std::optional<std::size_t> max_limit;
+    /// Timings up to rtt_tolerance times the no-load timings are not
+    /// considered an overload
+    double rtt_tolerance{1.5};
+    /// Share of the new limit estimate mixed into the limit each epoch,
+    /// smaller values make the limit less jumpy
+    double smoothing{0.2};
+    /// Number of epochs the no-load timings are averaged over
+    std::size_t long_window_epochs{60};
+    /// Timeouts rate that is considered an overload regardless of timings
+    double errors_threshold_percent{5.0};
+    /// The limit is not changed while there are fewer requests per epoch
+    std::size_t min_qps{10};
+};
+
+GradientConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<GradientConfig>);
+
+/// Schema of the GradientConfig static options, for the `gradient` option of
+/// the components
+yaml_config::Schema GetGradientConfigSchema();
+
+/// @brief Latency gradient controller, like TCP Vegas or Gradient2 of
+/// Netflix concurrency-limits.
+///
+/// Compares the recent timings with the long-term no-load timings and shrinks
+/// the limit proportionally once they grow. While the timings stay near the
+/// no-load ones, the limit grows by the square root of itself each epoch,
+/// which keeps the load near the knee of the latency curve. The limit is
+/// enforced only after the timings grew, and is released once the load no
+/// longer reaches it.
+class GradientController final : public Controller {
+public:
+    using StaticConfig = Controller::Config;
+
+    GradientController(
+        const std::string& name,
+        v2::Sensor& sensor,
+        Limiter& limiter,
+        Stats& stats,
+        const StaticConfig& config,
+        const GradientConfig& gradient_config
+    );
+
+    Limit Update(const Sensor::Data& current) override;
+
+private:
+    Limit MakeLimit(const Sensor::Data& current) const;
+
+    double GetQueueSize() const;
+
+    Stats& stats_;
+    const GradientConfig config_;
+
+    std::size_t epochs_passed_{0};
+    double long_timings_ms_{0};
+    double limit_{0};
+    bool is_active_{false};
+};
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -17,6 +17,13 @@ struct Stats {
     std::atomic<bool> is_fake_mode{false};
     std::atomic<int64_t> current_limit{0};
     std::atomic<int64_t> enabled_epochs{0};
+
+    // Filled by the GradientController only
+    std::atomic<bool> has_gradient{false};
+    std::atomic<int64_t> estimated_limit{0};
+    std::atomic<double> short_timings_ms{0};
+    std::atomic<double> long_timings_ms{0};
+    std::atomic<double> gradient{0};
 };
 
 void DumpMetric(utils::statistics::Writer& writer, const Stats& stats);
@@ -152,6 +152,38 @@ template <typename Function, typename... Args>
     );
 }
 
+/// @brief Runs an asynchronous function call that never suspends using
+/// specified task processor
+///
+/// The function is run on the stack of a task processor worker thread without
+/// a coroutine. It saves the coroutine stack acquisition and the context
+/// switches, which dominate the cost of tiny CPU-bound tasks, e.g. in fan-outs.
+///
+/// @warning The function must not wait for anything: no sleeps, mutexes,
+/// futures, I/O etc. An attempt to suspend aborts the process. Waits that are
+/// satisfied immediately (e.g. on an already finished task) are allowed.
+template <typename Function, typename... Args>
+[[nodiscard]] auto NonSuspendingAsyncNoSpan(TaskProcessor& task_processor, Function&& f, Args&&... args) {
+    using ResultType = typename utils::impl::WrappedCallImplType<Function, Args...>::ResultType;
+    constexpr auto kWaitMode = TaskWithResult<ResultType>::kWaitMode;
+
+    return TaskWithResult<ResultType>{impl::MakeTask(
+        {task_processor, Task::Importance::kNormal, kWaitMode, {}, /*non_suspending=*/true},
+        std::forward<Function>(f),
+        std::forward<Args>(args)...
+    )};
+}
+
+/// @brief Runs an asynchronous function call that never suspends using task
+/// processor of the caller
+/// @see engine::NonSuspendingAsyncNoSpan
+template <typename Function, typename... Args>
+[[nodiscard]] auto NonSuspendingAsyncNoSpan(Function&& f, Args&&... args) {
+    return NonSuspendingAsyncNoSpan(
+        current_task::GetTaskProcessor(), std::forward<Function>(f), std::forward<Args>(args)...
+    );
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
@@ -17,6 +17,10 @@ struct iovec;
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine::ev {
+class ThreadControl;
+}  // namespace engine::ev
+
 namespace engine::io {
 
 /// Socket type
@@ -100,6 +104,10 @@ public:
         return SendAll(list, deadline);
     }
 
+    [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size, Deadline deadline) override {
+        return SendAll(list, list_size, deadline);
+    }
+
     /// @brief Sends exactly list_size IoData to the socket.
     /// @note Can return less than len if socket is closed by peer.
     [[nodiscard]] size_t SendAll(const IoData* list, std::size_t list_size, Deadline deadline);
@@ -116,6 +124,14 @@ public:
     /// @see engine::io::Listen
     [[nodiscard]] Socket Accept(Deadline);
 
+    /// @cond
+    // For internal use only. Same as Socket(AddrDomain, SocketType) and
+    // Accept(Deadline), but the I/O of the resulting socket is served by
+    // the specified ev thread instead of the next one of the ev thread pool.
+    Socket(AddrDomain, SocketType, ev::ThreadControl& ev_thread);
+    [[nodiscard]] Socket Accept(Deadline, ev::ThreadControl& ev_thread);
+    /// @endcond
+
     /// @brief Receives at least one byte from the socket, returning source
     /// address.
     /// @returns 0 in bytes_sent if connection is closed on one side and no data
@@ -180,6 +196,10 @@ public:
     }
 
 private:
+    Socket(impl::FdControlHolder fd_control, AddrDomain domain);
+
+    Socket AcceptImpl(Deadline, ev::ThreadControl* ev_thread);
+
     AddrDomain domain_{AddrDomain::kUnspecified};
 
     impl::FdControlHolder fd_control_;
@@ -102,7 +102,11 @@ public:
         return SendAll(buf, len, deadline);
     }
 
-    [[nodiscard]] size_t WriteAll(std::initializer_list<IoData> list, Deadline deadline) override;
+    [[nodiscard]] size_t WriteAll(std::initializer_list<IoData> list, Deadline deadline) override {
+        return WriteAll(list.begin(), list.size(), deadline);
+    }
+
+    [[nodiscard]] size_t WriteAll(const IoData* list, std::size_t list_size, Deadline deadline) override;
 
     int GetRawFd();
 
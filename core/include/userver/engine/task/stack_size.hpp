@@ -0,0 +1,54 @@
+#pragma once
+
+/// @file userver/engine/task/stack_size.hpp
+/// @brief @copybrief engine::StackSize
+
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+/// @brief Size class of a coroutine stack.
+///
+/// The sizes are set by `coro_pool` options in the static config, see
+/// components::ManagerControllerComponent. If a size class is not configured,
+/// the tasks of that class get the default stacks.
+enum class StackSize : std::uint8_t {
+    kSmall,    ///< `coro_pool.small_stack_size`, for tiny leaf tasks
+    kDefault,  ///< `coro_pool.stack_size`
+    kLarge,    ///< `coro_pool.large_stack_size`, for deep recursion
+};
+
+/// @brief Sets the stack size class of the tasks started by the current task
+/// for the lifetime of the scope.
+///
+/// @code
+/// engine::StackSizeScope stack_size_scope{engine::StackSize::kSmall};
+/// for (auto& item : items) tasks.push_back(utils::Async("process", Process, item));
+/// @endcode
+///
+/// A task that overflows its stack aborts the process, so use
+/// StackSize::kSmall only for the tasks with a known shallow call depth, e.g.
+/// the ones suggested by the `coro-pool.stack-usage` metrics.
+class StackSizeScope final {
+public:
+    explicit StackSizeScope(StackSize stack_size);
+    ~StackSizeScope();
+
+    StackSizeScope(const StackSizeScope&) = delete;
+    StackSizeScope(StackSizeScope&&) = delete;
+    StackSizeScope& operator=(const StackSizeScope&) = delete;
+    StackSizeScope& operator=(StackSizeScope&&) = delete;
+
+private:
+    impl::TaskContext& context_;
+    const StackSize old_stack_size_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,59 @@
+#pragma once
+
+/// @file userver/engine/task/task_priority.hpp
+/// @brief @copybrief engine::TaskPriority
+
+#include <cstdint>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+/// @brief Scheduling class of a task.
+///
+/// Tasks of a higher priority are taken from the task processor queue before
+/// the tasks of a lower priority. Lower priorities are not starved, they get a
+/// small share of the scheduling decisions even under a constant load.
+///
+/// Priorities are respected only by task processors with `task-priorities`
+/// enabled in the static config, see components::ManagerControllerComponent.
+/// A new task inherits the priority of the task that created it.
+enum class TaskPriority : std::uint8_t {
+    kLow,     ///< Bulk background work, e.g. cache updates
+    kNormal,  ///< Default priority
+    kHigh,    ///< Latency-critical work
+};
+
+namespace current_task {
+
+/// Returns the priority of the current task
+TaskPriority GetPriority() noexcept;
+
+/// Sets the priority of the current task. It is applied the next time the
+/// task is scheduled and is inherited by the tasks created afterwards.
+void SetPriority(TaskPriority priority) noexcept;
+
+}  // namespace current_task
+
+/// Sets the priority of the current task for the lifetime of the scope
+class TaskPriorityScope final {
+public:
+    explicit TaskPriorityScope(TaskPriority priority);
+    ~TaskPriorityScope();
+
+    TaskPriorityScope(const TaskPriorityScope&) = delete;
+    TaskPriorityScope(TaskPriorityScope&&) = delete;
+    TaskPriorityScope& operator=(const TaskPriorityScope&) = delete;
+    TaskPriorityScope& operator=(TaskPriorityScope&&) = delete;
+
+private:
+    impl::TaskContext& context_;
+    const TaskPriority old_priority_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
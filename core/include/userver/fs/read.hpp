@@ -19,6 +19,8 @@ namespace fs {
 struct FileInfoWithData {
     std::string data;
     std::string extension;
+    /// Strong entity tag of the data, suitable for the HTTP ETag header
+    std::string etag;
 };
 
 using FileInfoWithDataConstPtr = std::shared_ptr<const FileInfoWithData>;
@@ -37,6 +39,9 @@ enum class SettingsReadFile {
 /// lexically.
 std::string GetLexicallyRelative(std::string_view path, std::string_view dir);
 
+/// @brief Returns file info for the file contents, computes the entity tag
+FileInfoWithData MakeFileInfoWithData(std::string data, std::string extension);
+
 /// @brief Returns files from recursively traversed directory
 /// @param async_tp TaskProcessor for synchronous waiting
 /// @param path to directory to traverse recursively
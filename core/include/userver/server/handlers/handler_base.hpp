@@ -38,8 +38,9 @@ namespace server::handlers {
 /// response_data_size_log_limit | trim responses to this size before logging | 512
 /// max_requests_per_second | integer to limit RPS to this handler | <no limit>
 /// decompress_request | allow decompression of the requests | true
-/// throttling_enabled | allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options | true
+/// throttling_enabled | allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` option | true
 /// set-response-server-hostname | set to true to add the `X-YaTaxi-Server-Hostname` header with instance name, set to false to not add the header | <takes the value from components::Server config>
+/// request-body-stream | set to true to read the request body by chunks with server::http::HttpRequest::GetBodyStream() while it is being received, server::http::HttpRequest::RequestBody() is empty then and `max_request_size` does not limit the body | false
 /// monitor-handler | Overrides the in-code `is_monitor` flag that makes the handler run either on `server.listener` or on `server.listener-monitor` | --
 /// set_tracing_headers | whether to set http tracing headers (X-YaTraceId, X-YaSpanId, X-RequestId) | true
 /// deadline_propagation_enabled | when `false`, disables HTTP handler @ref scripts/docs/en/userver/deadline_propagation.md "deadline propagation" | true
@@ -2,6 +2,7 @@
 
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -26,6 +27,26 @@ enum class UrlTrailingSlashOption {
     kDefault = kBoth,
 };
 
+/// Weighted fair admission of the clients of a handler under its
+/// `max_requests_per_second` and `max_requests_in_flight` limits
+struct FairShareConfig {
+    enum class ClientKey {
+        kHeader,         ///< client id is taken from a header
+        kRemoteAddress,  ///< client id is the remote IP address
+    };
+
+    ClientKey client_key{ClientKey::kHeader};
+    /// Header with the client id for ClientKey::kHeader
+    std::string header;
+    /// Share weights of the clients by their ids, the rest have weight 1
+    std::unordered_map<std::string, double> weights;
+    /// Load of the handler in percent of its limits, after which the clients
+    /// above their weighted shares are rejected
+    std::size_t shed_threshold_percent{80};
+};
+
+FairShareConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<FairShareConfig>);
+
 struct HandlerConfig {
     std::variant<std::string, FallbackHandler> path;
     std::string task_processor;
@@ -38,9 +59,11 @@ struct HandlerConfig {
     UrlTrailingSlashOption url_trailing_slash{UrlTrailingSlashOption::kDefault};
     std::optional<size_t> max_requests_in_flight;
     std::optional<size_t> max_requests_per_second;
+    std::optional<FairShareConfig> fair_share;
     bool decompress_request{true};
     bool throttling_enabled{true};
     bool response_body_stream{false};
+    bool request_body_stream{false};
     std::optional<bool> set_response_server_hostname;
     bool set_tracing_headers{true};
     bool deadline_propagation_enabled{true};
@@ -19,6 +19,11 @@ namespace server::handlers {
 /// @brief Handler that returns HTTP 200 if file exist
 /// and returns file data with mapped content/type
 ///
+/// The files are sent right from the components::FsCache memory. Responses
+/// carry an `ETag`, so `If-None-Match` requests for unchanged files get
+/// HTTP 304. A single byte range of the `Range` header is served with HTTP 206,
+/// multiple ranges are ignored and the whole file is sent.
+///
 /// ## HttpHandlerStatic Dynamic config
 /// * @ref USERVER_FILES_CONTENT_TYPE_MAP
 ///
@@ -0,0 +1,80 @@
+#pragma once
+
+/// @file userver/server/http/form_data_stream.hpp
+/// @brief @copybrief server::http::FormDataStream
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class HttpRequest;
+
+/// @brief Parts of a multipart/form-data body, parsed while the body is being
+/// received.
+///
+/// Unlike HttpRequest::GetFormDataArg(), the parts are not stored: the value of
+/// each part is read by chunks, so the uploads of any size take a constant
+/// amount of memory. Requires the `request-body-stream: true` static option of
+/// the handler.
+///
+/// @code
+/// server::http::FormDataStream form_data{request};
+/// server::http::FormDataStream::Part part;
+/// std::string chunk;
+/// while (form_data.NextPart(part)) {
+///     while (form_data.ReadChunk(chunk)) Store(part.name, chunk);
+/// }
+/// @endcode
+///
+/// The lines of the body must be separated by CRLF.
+class FormDataStream final {
+public:
+    /// @brief Headers of a part
+    struct Part final {
+        std::string name;
+        std::optional<std::string> filename;
+        std::optional<std::string> content_type;
+    };
+
+    /// Reads the body by chunks, has the semantics of RequestBodyStream::ReadChunk()
+    using ChunkReader = std::function<bool(std::string& chunk, engine::Deadline deadline)>;
+
+    /// @brief Parses the body of the request, see HttpRequest::GetBodyStream()
+    /// @throws handlers::ClientError if the request is not multipart/form-data
+    explicit FormDataStream(const HttpRequest& request);
+
+    /// @brief Parses the body of `content_type` read by `read_chunk`
+    /// @throws handlers::ClientError if the content type is not multipart/form-data
+    FormDataStream(std::string_view content_type, ChunkReader read_chunk);
+
+    FormDataStream(FormDataStream&&) noexcept;
+    FormDataStream& operator=(FormDataStream&&) noexcept;
+    ~FormDataStream();
+
+    /// @brief Skips the rest of the current part and reads the headers of the
+    /// next one.
+    /// @returns false if there are no more parts
+    /// @throws handlers::ClientError if the body is malformed
+    bool NextPart(Part& part, engine::Deadline deadline = {});
+
+    /// @brief Reads the next chunk of the value of the current part.
+    /// @returns false at the end of the value
+    /// @throws handlers::ClientError if the body is malformed
+    bool ReadChunk(std::string& chunk, engine::Deadline deadline = {});
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -28,6 +28,8 @@ class HttpHandlerBase;
 /// Server parts of the HTTP protocol implementation.
 namespace server::http {
 
+class RequestBodyStream;
+
 /// @brief HTTP Request data.
 /// @note do not create HttpRequest by hand in tests,
 ///       use HttpRequestBuilder instead.
@@ -210,10 +212,21 @@ public:
     /// @return moved out HTTP body. `this` is modified.
     std::string ExtractRequestBody();
 
+    /// @brief Returns the chunks of the body for the handlers with the
+    /// `request-body-stream: true` static option, RequestBody() is empty for them.
+    ///
+    /// The chunks are received while the handler runs, the rest of the body is
+    /// skipped once the handler returns.
+    RequestBodyStream& GetBodyStream() const;
+
     /// @cond
     void SetRequestBody(std::string body);
     void ParseArgsFromBody();
     bool IsFinal() const;
+
+    bool IsBodyStreamed() const;
+    bool IsBodyStreamReceived() const;
+    void CloseBodyStream() const;
     /// @endcond
 
     /// @brief Set the response status code.
@@ -288,7 +301,7 @@ private:
     friend class HttpRequestHandler;
 
     struct Impl;
-    utils::FastPimpl<Impl, 1648, 16> pimpl_;
+    utils::FastPimpl<Impl, 1744, 16> pimpl_;
 };
 
 }  // namespace server::http
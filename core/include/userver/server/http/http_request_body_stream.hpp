@@ -0,0 +1,72 @@
+#pragma once
+
+/// @file userver/server/http/http_request_body_stream.hpp
+/// @brief @copybrief server::http::RequestBodyStream
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <userver/concurrent/queue.hpp>
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class HttpRequestConstructor;
+
+/// @brief Thrown by RequestBodyStream::ReadChunk() if the rest of the body can not be read
+class RequestBodyStreamError final : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+/// @brief Chunks of the request body of a handler with the `request-body-stream: true` static option.
+///
+/// The chunks are received from the connection while the handler runs. A slow
+/// handler slows down the client instead of buffering the whole body: with
+/// HTTP/1.1 the connection stops reading the socket while the unread chunks
+/// take more than a fixed amount of memory, with HTTP/2 the flow control window
+/// of the stream is given back to the client only as the chunks are read.
+class RequestBodyStream final {
+public:
+    RequestBodyStream(RequestBodyStream&&) noexcept;
+    RequestBodyStream& operator=(RequestBodyStream&&) noexcept;
+    ~RequestBodyStream();
+
+    /// @brief Waits for the next chunk of the body and stores it into `chunk`.
+    /// @returns false if the whole body was read, `chunk` is left intact then
+    /// @throws RequestBodyStreamError if the connection was closed before the
+    /// end of the body, or the deadline was reached, or the task was cancelled
+    bool ReadChunk(std::string& chunk, engine::Deadline deadline = {});
+
+private:
+    friend class HttpRequestConstructor;
+
+    using Queue = concurrent::StringStreamQueue;
+    // Called with the size of each chunk taken from the queue
+    using OnChunkRead = std::function<void(std::size_t)>;
+
+    RequestBodyStream(
+        Queue::Consumer&& consumer,
+        std::shared_ptr<const std::atomic<bool>> is_received,
+        OnChunkRead&& on_chunk_read
+    );
+
+    void ReleaseUnreadChunks() noexcept;
+
+    Queue::Consumer consumer_;
+    // Set by the connection before it drops the producer once the whole body
+    // is received, to tell the end of the body from a closed connection
+    std::shared_ptr<const std::atomic<bool>> is_received_;
+    OnChunkRead on_chunk_read_;
+    bool is_read_{false};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -65,6 +65,10 @@ public:
 
     HttpRequestBuilder& SetResponseStatus(HttpStatus status);
 
+    HttpRequestBuilder& SetBodyStream(RequestBodyStream&& body_stream);
+
+    HttpRequestBuilder& SetBodyStreamReceived();
+
     const HttpRequest& GetRef() const;
 
     HttpResponse& GetHttpResponse();
@@ -4,7 +4,9 @@
 /// @brief @copybrief server::http::HttpResponse
 
 #include <chrono>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <variant>
 
 #include <userver/concurrent/queue.hpp>
@@ -31,6 +33,7 @@ namespace server::http {
 inline constexpr std::string_view kDefaultContentType = "application/octet-stream";
 
 class Http2ResponseWriter;
+class HttpResponseBatch;
 
 namespace impl {
 
@@ -99,6 +102,18 @@ public:
     /// @brief Remove all cookies from response.
     void ClearCookies();
 
+    /// @brief Sets the body to a part of an immutable buffer that is shared
+    /// with other responses, e.g. a cached file. The body is written to the
+    /// socket without copying it into the response.
+    ///
+    /// @param owner keeps `data` alive until the response is sent
+    /// @note The data set by SetData() takes precedence if it is not empty.
+    void SetSharedData(std::shared_ptr<const void> owner, std::string_view data);
+
+    /// @return The body set by SetData(), or the one set by SetSharedData() if
+    /// the former is empty
+    std::string_view GetBodyData() const;
+
     /// @return HTTP response status
     HttpStatus GetStatus() const { return status_; }
 
@@ -146,6 +161,15 @@ public:
 
 private:
     friend class Http2ResponseWriter;
+    friend class HttpResponseBatch;
+
+    // Whether the body is sent using the chunked transfer encoding
+    bool IsSentAsChunks() const;
+
+    std::size_t GetBodySize() const override;
+
+    // Appends the status line, the headers and the cookies
+    void WriteHeaders(USERVER_NAMESPACE::http::headers::HeadersString& header);
 
     // Returns total size of the response
     std::size_t SetBodyStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
@@ -153,6 +177,10 @@ private:
     // Returns total size of the response
     std::size_t SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header);
 
+    // Appends Content-Length and the end of the headers, returns the body to
+    // send right after the headers
+    std::string_view FinishHeadersNotStreamed(USERVER_NAMESPACE::http::headers::HeadersString& header);
+
     const HttpRequest& request_;
     HttpStatus status_ = HttpStatus::kOk;
     HeadersMap headers_;
@@ -162,6 +190,9 @@ private:
     std::optional<Queue::Consumer> body_stream_;
     Producer body_stream_producer_;
     bool is_stream_body_{false};
+
+    std::shared_ptr<const void> shared_data_owner_;
+    std::string_view shared_data_;
 };
 
 void SetThrottleReason(http::HttpResponse& http_response, std::string log_reason, std::string http_header_reason);
@@ -3,6 +3,7 @@
 /// @file userver/server/request/request_context.hpp
 /// @brief @copybrief server::request::RequestContext
 
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -104,6 +105,22 @@ public:
     /// @brief Erase data with specified name.
     void EraseData(std::string_view name);
 
+    /// @brief Monotonic memory resource that lives as long as the request.
+    ///
+    /// Memory allocated from the arena is not reused until the request
+    /// finishes, then it is released at once. Allocating request-scoped
+    /// temporaries from it is cheaper than going to the global allocator:
+    ///
+    /// @code
+    /// std::pmr::vector<std::pmr::string> ids{&context.GetArena()};
+    /// @endcode
+    ///
+    /// The arena is created on the first call. It is not thread-safe, use it
+    /// from the task that handles the request. The data stored in this
+    /// RequestContext is destroyed before the arena, so it may hold containers
+    /// allocated from it.
+    std::pmr::memory_resource& GetArena();
+
     // TODO : TAXICOMMON-8252
     impl::InternalRequestContext& GetInternalContext();
 
@@ -22,6 +22,9 @@ struct Http2StreamEvent {
     std::int32_t stream_id{-1};
     std::string body_part{};
     bool is_end{false};
+    // Bytes of the streamed request body read by the handler, the stream
+    // window is updated by that much. Such events carry no response data.
+    std::size_t consumed_body_size{0};
 };
 
 // The order is fifo in the context of a single producer. So we are tolerant to
@@ -119,6 +122,12 @@ protected:
 
     void SetSent(std::size_t bytes_sent, std::chrono::steady_clock::time_point sent_time);
 
+    // Size of the body that is accounted as the response data in flight
+    virtual std::size_t GetBodySize() const { return data_.size(); }
+
+    // Replaces the accounted response data with the current body
+    void AccountBody();
+
 private:
     class Guard final {
     public:
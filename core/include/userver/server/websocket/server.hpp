@@ -45,11 +45,30 @@ struct Message {
 
 class WebSocketConnectionImpl;
 
+/// @brief permessage-deflate extension settings, RFC 7692
+struct DeflateConfig final {
+    bool enabled = false;
+    /// Reset the compressor after each message, saves memory but worsens the
+    /// compression of small similar messages
+    bool server_no_context_takeover = false;
+    /// Ask the client to reset its compressor after each message
+    bool client_no_context_takeover = false;
+    /// Compressor window size, 9..15
+    int server_max_window_bits = 15;
+    /// zlib compression level, 1..9
+    int compression_level = 6;
+    /// Smaller messages are sent uncompressed
+    unsigned min_message_size = 128;
+};
+
 struct Config final {
     unsigned max_remote_payload = 65536;
     unsigned fragment_size = 65536;  // 0 - do not fragment
+    DeflateConfig deflate;
 };
 
+DeflateConfig Parse(const yaml_config::YamlConfig&, formats::parse::To<DeflateConfig>);
+
 Config Parse(const yaml_config::YamlConfig&, formats::parse::To<Config>);
 
 struct Statistics final {
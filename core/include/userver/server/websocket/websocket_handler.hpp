@@ -28,6 +28,12 @@ namespace server::websocket {
 /// status-codes-log-level | map of "status": log_level items to override span log level for specific status codes | {}
 /// max-remote-payload | max remote payload size | 65536
 /// fragment-size | max output fragment size | 65536
+/// permessage-deflate.enabled | accept the permessage-deflate compression (RFC 7692) offered by clients | false
+/// permessage-deflate.server-no-context-takeover | reset the compressor after each message, saves memory | false
+/// permessage-deflate.client-no-context-takeover | ask the clients to reset their compressors after each message | false
+/// permessage-deflate.server-max-window-bits | compressor window size, log2 from 9 to 15 | 15
+/// permessage-deflate.compression-level | zlib compression level from 1 to 9 | 6
+/// permessage-deflate.min-message-size | smaller messages are sent uncompressed | 128
 ///
 /// ## Example usage:
 ///
@@ -28,6 +28,8 @@ ResolverConfig ParseResolverConfig(const components::ComponentConfig& component_
         component_config["cache_max_reply_ttl"].As<std::chrono::milliseconds>(config.cache_max_reply_ttl);
     config.cache_failure_ttl =
         component_config["cache_failure_ttl"].As<std::chrono::milliseconds>(config.cache_failure_ttl);
+    config.cache_refresh_ahead_ratio =
+        component_config["cache-refresh-ahead-ratio"].As<double>(config.cache_refresh_ahead_ratio);
     return config;
 }
 
@@ -100,6 +102,14 @@ properties:
         type: string
         description: TTL for network failures caching
         defaultDescription: 5s
+    cache-refresh-ahead-ratio:
+        type: number
+        description: |
+            share of the reply TTL before the expiration of a cached record,
+            in which a lookup of the record refreshes it in background
+        defaultDescription: 0.2
+        minimum: 0
+        maximum: 1
 )");
 }
 
@@ -2,6 +2,7 @@
 
 #include <arpa/inet.h>
 #include <netinet/in.h>
+#include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <string_view>
@@ -155,6 +156,8 @@ private:
     struct NetCacheEntry {
         AddrVector addrs;
         std::chrono::steady_clock::time_point expiration;
+        /// lookups after this point refresh the record in background
+        std::chrono::steady_clock::time_point refresh_ahead;
         bool is_failure{false};
     };
 
@@ -182,6 +185,7 @@ private:
     const std::chrono::milliseconds net_cache_update_margin_;
     const std::chrono::milliseconds net_cache_max_reply_ttl_;
     const std::chrono::milliseconds net_cache_failure_ttl_;
+    const double net_cache_refresh_ahead_ratio_;
     cache::NWayLRU<std::string, NetCacheEntry> net_cache_;
     concurrent::MutexSet<std::string> net_cache_update_mutexes_;
     utils::impl::WaitTokenStorage wait_token_storage_;
@@ -193,6 +197,7 @@ Resolver::Impl::Impl(engine::TaskProcessor& fs_task_processor, const ResolverCon
       net_cache_update_margin_{config.network_timeout},
       net_cache_max_reply_ttl_{config.cache_max_reply_ttl},
       net_cache_failure_ttl_{config.cache_failure_ttl},
+      net_cache_refresh_ahead_ratio_{std::clamp(config.cache_refresh_ahead_ratio, 0.0, 1.0)},
       net_cache_{config.cache_ways, config.cache_size_per_way},
       net_cache_update_mutexes_(config.cache_ways) {}
 
@@ -236,7 +241,7 @@ Resolver::Impl::NetCacheResult Resolver::Impl::QueryNetCache(const std::string&
         ++source_counters_.cached_stale;
     }
 
-    if (cached->expiration - now >= net_cache_update_margin_) {
+    if (now < cached->refresh_ahead) {
         result.status = NetCacheResult::Status::kHitReply;
     } else {
         result.status = NetCacheResult::Status::kHitReplyWithUpdate;
@@ -331,7 +336,8 @@ void Resolver::Impl::FinishNetUpdate(
         LOG_LIMITED_ERROR() << "Resolving of '" << name << "' failed: " << ex;
         if (failure_mode == FailureMode::kCache) {
             LOG_TRACE() << "Caching failure for '" << name << '\'';
-            net_cache_.Put(name, NetCacheEntry{{}, utils::datetime::MockSteadyNow() + net_cache_failure_ttl_, true});
+            const auto expiration = utils::datetime::MockSteadyNow() + net_cache_failure_ttl_;
+            net_cache_.Put(name, NetCacheEntry{{}, expiration, expiration, true});
         }
         ++source_counters_.network_failure;
         throw;
@@ -342,9 +348,14 @@ void Resolver::Impl::FinishNetUpdate(
     if (addrs) *addrs = response.addrs;
     if (effective_ttl.count() > 0) {
         LOG_TRACE() << "Updating cache for '" << name << '\'';
-        net_cache_.Put(
-            name, NetCacheEntry{std::move(response.addrs), utils::datetime::MockSteadyNow() + effective_ttl}
+        // Hot records are refreshed ahead of their expiration, so that their
+        // lookups never wait for the network
+        const auto refresh_ahead_margin = std::max<std::chrono::milliseconds>(
+            net_cache_update_margin_,
+            std::chrono::duration_cast<std::chrono::milliseconds>(effective_ttl * net_cache_refresh_ahead_ratio_)
         );
+        const auto expiration = utils::datetime::MockSteadyNow() + effective_ttl;
+        net_cache_.Put(name, NetCacheEntry{std::move(response.addrs), expiration, expiration - refresh_ahead_margin});
     } else {
         LOG_TRACE() << "Skipping cache update for '" << name << '\'';
     }
@@ -357,9 +368,46 @@ Resolver::Resolver(engine::TaskProcessor& fs_task_processor, const ResolverConfi
 Resolver::~Resolver() = default;
 
 AddrVector Resolver::Resolve(const std::string& name, engine::Deadline deadline) {
+    {
+        auto cached_addrs = ResolveCached(name);
+        if (cached_addrs) return std::move(*cached_addrs);
+    }
+
+    auto mutex = impl_->GetUpdateMutex(name);
+    std::unique_lock lock{mutex, std::defer_lock};
+    // synchronize with possible parallel updates
+    if (deadline.IsReachable()) {
+        [[maybe_unused]] auto lock_result = lock.try_lock_for(deadline.TimeLeft());
+    } else {
+        lock.lock();
+    }
+    if (!lock) {
+        impl_->AccountNetUpdateFailure();
+        throw NotResolvedException{"Resolving '" + name + "' timed out (lock)"};
+    }
+
+    auto net_result = impl_->QueryNetCache(name);
+    switch (net_result.status) {
+        case Impl::NetCacheResult::Status::kMiss:
+            return impl_->DoForegroundQuery(lock, std::move(mutex), name, deadline);
+
+        case Impl::NetCacheResult::Status::kHitReplyWithUpdate:
+            impl_->StartBackgroundQuery(lock, std::move(mutex), name);
+            [[fallthrough]];
+        case Impl::NetCacheResult::Status::kHitReply:
+            return std::move(net_result.addrs);
+
+        case Impl::NetCacheResult::Status::kHitFailure:
+            throw NotResolvedException{"Not resolving '" + name + "' because of prior failure"};
+    }
+
+    UINVARIANT(false, "Unexpected cache result status");
+}
+
+std::optional<AddrVector> Resolver::ResolveCached(const std::string& name) {
     {
         auto opt_addr = ParseNumericAddr(name);
-        if (opt_addr) return {*opt_addr};
+        if (opt_addr) return AddrVector{*opt_addr};
     }
 
     CheckValidDomainName(name);
@@ -378,35 +426,17 @@ AddrVector Resolver::Resolve(const std::string& name, engine::Deadline deadline)
     }
 
     auto net_result = impl_->QueryNetCache(name);
-
-    if (net_result.status == Impl::NetCacheResult::Status::kHitReply) {
-        return std::move(net_result.addrs);
-    }
-
-    auto mutex = impl_->GetUpdateMutex(name);
-    std::unique_lock lock{mutex, std::defer_lock};
-    if (net_result.status == Impl::NetCacheResult::Status::kMiss) {
-        // synchronize with possible parallel updates
-        if (deadline.IsReachable()) {
-            [[maybe_unused]] auto lock_result = lock.try_lock_for(deadline.TimeLeft());
-        } else {
-            lock.lock();
-        }
-        if (!lock) {
-            impl_->AccountNetUpdateFailure();
-            throw NotResolvedException{"Resolving '" + name + "' timed out (lock)"};
-        }
-
-        net_result = impl_->QueryNetCache(name);
+    if (net_result.status == Impl::NetCacheResult::Status::kHitReplyWithUpdate) {
+        auto mutex = impl_->GetUpdateMutex(name);
+        std::unique_lock lock{mutex, std::defer_lock};
+        impl_->StartBackgroundQuery(lock, std::move(mutex), name);
     }
 
     switch (net_result.status) {
         case Impl::NetCacheResult::Status::kMiss:
-            return impl_->DoForegroundQuery(lock, std::move(mutex), name, deadline);
+            return std::nullopt;
 
         case Impl::NetCacheResult::Status::kHitReplyWithUpdate:
-            impl_->StartBackgroundQuery(lock, std::move(mutex), name);
-            [[fallthrough]];
         case Impl::NetCacheResult::Status::kHitReply:
             return std::move(net_result.addrs);
 
@@ -59,7 +59,11 @@ constexpr auto kNetV6String{"2a02:6b8:a::a"};
 struct MockedResolver {
     using ServerMock = utest::DnsServerMock;
 
-    MockedResolver(size_t cache_max_ttl, size_t cache_size_per_way)
+    MockedResolver(
+        size_t cache_max_ttl,
+        size_t cache_size_per_way,
+        std::chrono::milliseconds network_timeout = utest::kMaxTestWaitTime
+    )
         : hosts_file{[] {
               auto file = fs::blocking::TempFile::Create();
               fs::blocking::RewriteFileContents(file.GetPath(), kTestHosts);
@@ -80,7 +84,7 @@ struct MockedResolver {
                        clients::dns::ResolverConfig config;
                        config.file_path = hosts_file.GetPath();
                        config.file_update_interval = utest::kMaxTestWaitTime;
-                       config.network_timeout = utest::kMaxTestWaitTime;
+                       config.network_timeout = network_timeout;
                        config.network_attempts = 1;
                        config.cache_max_reply_ttl = std::chrono::seconds{cache_max_ttl};
                        config.cache_failure_ttl = std::chrono::seconds{cache_max_ttl}, config.cache_ways = 1;
@@ -450,4 +454,63 @@ UTEST(Resolver, FirstUpdateCombines) {
     EXPECT_EQ(counters.network_failure, 1);
 }
 
+UTEST(Resolver, ResolveCached) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    MockedResolver resolver{1000, 1};
+
+    EXPECT_PRED_FORMAT2(CheckAddrs, resolver->ResolveCached("127.0.0.1").value(), (Expected{"127.0.0.1"}));
+    EXPECT_PRED_FORMAT2(CheckAddrs, resolver->ResolveCached("mycomputer").value(), (Expected{"::1", "127.0.0.1"}));
+    EXPECT_FALSE(resolver->ResolveCached("not-mycomputer"));
+
+    EXPECT_PRED_FORMAT2(
+        CheckAddrs, resolver->Resolve("not-mycomputer", test_deadline), (Expected{kNetV6String, kNetV4String})
+    );
+    EXPECT_PRED_FORMAT2(
+        CheckAddrs, resolver->ResolveCached("not-mycomputer").value(), (Expected{kNetV6String, kNetV4String})
+    );
+
+    UEXPECT_THROW(resolver->Resolve("fail", test_deadline), clients::dns::NotResolvedException);
+    UEXPECT_THROW(resolver->ResolveCached("fail"), clients::dns::NotResolvedException);
+
+    const auto& counters = resolver->GetLookupSourceCounters();
+    EXPECT_EQ(counters.file, 1);
+    EXPECT_EQ(counters.cached, 1);
+    EXPECT_EQ(counters.cached_stale, 0);
+    EXPECT_EQ(counters.cached_failure, 1);
+    EXPECT_EQ(counters.network, 1);
+    EXPECT_EQ(counters.network_failure, 1);
+}
+
+UTEST(Resolver, CacheRefreshAhead) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    MockedResolver resolver{10, 1, std::chrono::seconds{1}};
+    const auto& counters = resolver->GetLookupSourceCounters();
+
+    utils::datetime::MockNowSet({});
+
+    EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline), (Expected{kNetV6String, kNetV4String}));
+    EXPECT_EQ(counters.network, 1);
+
+    utils::datetime::MockSleep(std::chrono::seconds{5});
+    EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline), (Expected{kNetV6String, kNetV4String}));
+    EXPECT_EQ(counters.network, 1);
+
+    // The last 20% of the TTL, the record is refreshed before it expires
+    utils::datetime::MockSleep(std::chrono::seconds{4});
+    EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline), (Expected{kNetV6String, kNetV4String}));
+    while (counters.network < 2 && !test_deadline.IsReached()) {
+        engine::Yield();
+    }
+    EXPECT_EQ(counters.network, 2);
+
+    utils::datetime::MockSleep(std::chrono::seconds{2});
+    EXPECT_PRED_FORMAT2(CheckAddrs, resolver->Resolve("first", test_deadline), (Expected{kNetV6String, kNetV4String}));
+
+    EXPECT_EQ(counters.cached, 3);
+    EXPECT_EQ(counters.cached_stale, 0);
+    EXPECT_EQ(counters.network_failure, 0);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,178 @@
+#include <clients/http/adaptive_hedging.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/http/url.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/datetime.hpp>
+#include <userver/utils/hedged_request.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <clients/http/destination_statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+constexpr std::chrono::milliseconds kTimingsUpdatePeriod{std::chrono::seconds{1}};
+
+// Each destination keeps its backup requests budget for the lifetime of the
+// client, the requests to the rest are not hedged
+constexpr std::size_t kMaxDestinations = 1000;
+
+// Same clock as the recent period of the destination statistics, so that
+// their epochs and the timings updates agree even if the time is mocked
+std::int64_t NowMs() noexcept {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(utils::datetime::SteadyNow().time_since_epoch())
+        .count();
+}
+
+class HedgingStrategy final {
+public:
+    HedgingStrategy(
+        const std::function<Request()>& create_request,
+        Request primary,
+        utils::RetryBudget* budget,
+        std::exception_ptr& exception
+    )
+        : create_request_(create_request), primary_(std::move(primary)), budget_(budget), exception_(exception) {}
+
+    std::optional<ResponseFuture> Create(std::size_t attempt) {
+        if (attempt == 0) {
+            UASSERT(primary_);
+            if (budget_) budget_->AccountOk();
+            return std::exchange(primary_, std::nullopt)->async_perform();
+        }
+
+        // Backup requests must not amplify an overload of the destination
+        if (!budget_ || !budget_->CanRetry()) return std::nullopt;
+        budget_->AccountFail();
+        return create_request_().async_perform();
+    }
+
+    std::optional<std::chrono::milliseconds> ProcessReply(ResponseFuture&& future) {
+        try {
+            response_ = future.Get();
+        } catch (const std::exception&) {
+            exception_.get() = std::current_exception();
+        }
+        return std::nullopt;
+    }
+
+    std::optional<std::shared_ptr<Response>> ExtractReply() {
+        if (!response_) return std::nullopt;
+        return std::move(response_);
+    }
+
+    void Finish(ResponseFuture&& future) { future.Cancel(); }
+
+private:
+    std::reference_wrapper<const std::function<Request()>> create_request_;
+    std::optional<Request> primary_;
+    utils::RetryBudget* budget_;
+    std::reference_wrapper<std::exception_ptr> exception_;
+    std::shared_ptr<Response> response_;
+};
+
+struct DestinationView final {
+    const utils::RetryBudget& budget;
+    std::int64_t delay_ms;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const DestinationView& view) {
+    writer["budget"] = view.budget;
+    writer["delay-ms"] = view.delay_ms;
+}
+
+}  // namespace
+
+AdaptiveHedging::AdaptiveHedging(std::shared_ptr<const DestinationStatistics> destination_statistics)
+    : destination_statistics_(std::move(destination_statistics)) {
+    UASSERT(destination_statistics_);
+}
+
+AdaptiveHedging::~AdaptiveHedging() = default;
+
+std::shared_ptr<Response>
+AdaptiveHedging::Perform(const std::function<Request()>& create_request, const AdaptiveHedgingSettings& settings) {
+    auto primary = create_request();
+    const auto name = USERVER_NAMESPACE::http::ExtractMetaTypeFromUrl(primary.GetUrl());
+    const auto destination = GetDestination(name, settings);
+
+    utils::hedging::HedgingSettings hedging_settings;
+    hedging_settings.timeout_all = settings.timeout_all;
+    if (destination) {
+        hedging_settings.max_attempts = std::max<std::size_t>(settings.max_attempts, 1);
+        hedging_settings.hedging_delay = GetDelay(*destination, name, settings);
+    } else {
+        hedging_settings.max_attempts = 1;
+        hedging_settings.hedging_delay = settings.timeout_all;
+    }
+
+    std::exception_ptr exception;
+    auto response = utils::hedging::HedgeRequest(
+        HedgingStrategy{create_request, std::move(primary), destination ? &destination->budget : nullptr, exception},
+        hedging_settings
+    );
+
+    if (response && *response) return std::move(*response);
+    if (exception) std::rethrow_exception(exception);
+    if (engine::current_task::ShouldCancel()) {
+        throw CancelException("Hedged request was cancelled", {}, ErrorKind::kCancel);
+    }
+    throw TimeoutException("Hedged request has not finished in time", {});
+}
+
+std::shared_ptr<AdaptiveHedging::Destination>
+AdaptiveHedging::GetDestination(const std::string& name, const AdaptiveHedgingSettings& settings) {
+    auto destination = destinations_.Get(name);
+    if (!destination && destinations_.SizeApprox() < kMaxDestinations) {
+        destination = destinations_.TryEmplace(name, settings.budget).value;
+    }
+    return destination;
+}
+
+std::chrono::milliseconds AdaptiveHedging::GetDelay(
+    Destination& destination,
+    const std::string& name,
+    const AdaptiveHedgingSettings& settings
+) const {
+    const auto now = NowMs();
+    auto next_update = destination.next_timings_update_ms.load(std::memory_order_relaxed);
+    if (now >= next_update &&
+        destination.next_timings_update_ms.compare_exchange_strong(next_update, now + kTimingsUpdatePeriod.count())) {
+        auto timings = destination_statistics_->GetRecentTimings(name);
+        if (timings) destination.timings.Assign(std::move(*timings));
+    }
+
+    auto delay = settings.fallback_delay;
+    {
+        const auto timings = destination.timings.Read();
+        if (timings->Count() >= settings.min_samples) {
+            delay = std::chrono::milliseconds{timings->GetPercentile(settings.percentile)};
+        }
+    }
+    delay = std::max(delay, settings.min_delay);
+
+    destination.delay_ms.store(delay.count(), std::memory_order_relaxed);
+    return delay;
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const AdaptiveHedging& hedging) {
+    for (const auto& [name, destination] : hedging.destinations_) {
+        writer.ValueWithLabels(
+            DestinationView{destination->budget, destination->delay_ms.load(std::memory_order_relaxed)},
+            {"http_destination", name}
+        );
+    }
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <userver/clients/http/adaptive_hedging.hpp>
+#include <userver/clients/http/request.hpp>
+#include <userver/clients/http/response.hpp>
+#include <userver/rcu/rcu.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/retry_budget.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+#include <clients/http/statistics.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+class DestinationStatistics;
+
+/// Sends the backup requests to a destination after the recent latency
+/// percentile of its requests, while the budget of the destination allows.
+class AdaptiveHedging final {
+public:
+    explicit AdaptiveHedging(std::shared_ptr<const DestinationStatistics> destination_statistics);
+    ~AdaptiveHedging();
+
+    std::shared_ptr<Response>
+    Perform(const std::function<Request()>& create_request, const AdaptiveHedgingSettings& settings);
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const AdaptiveHedging& hedging);
+
+private:
+    struct Destination final {
+        explicit Destination(const utils::RetryBudgetSettings& budget_settings) : budget(budget_settings) {}
+
+        utils::RetryBudget budget;
+        /// timings of the recent requests, refreshed once a period as getting
+        /// them from the destination statistics is not cheap
+        rcu::Variable<Percentile> timings;
+        /// steady clock milliseconds
+        std::atomic<std::int64_t> next_timings_update_ms{0};
+        /// the last delay before a backup request
+        std::atomic<std::int64_t> delay_ms{0};
+    };
+
+    std::shared_ptr<Destination> GetDestination(const std::string& name, const AdaptiveHedgingSettings& settings);
+
+    std::chrono::milliseconds
+    GetDelay(Destination& destination, const std::string& name, const AdaptiveHedgingSettings& settings) const;
+
+    const std::shared_ptr<const DestinationStatistics> destination_statistics_;
+    rcu::RcuMap<std::string, Destination> destinations_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
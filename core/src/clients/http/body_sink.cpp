@@ -0,0 +1,32 @@
+#include <userver/clients/http/body_sink.hpp>
+
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+ResponseBodySink::~ResponseBodySink() = default;
+
+void ResponseBodySink::Reserve(std::size_t /*size*/) {}
+
+BufferBodySink::BufferBodySink(utils::span<char> buffer) noexcept : buffer_(buffer) {}
+
+void BufferBodySink::Clear() noexcept { size_ = 0; }
+
+void BufferBodySink::Append(std::string_view data) {
+    if (data.size() > buffer_.size() - size_) {
+        throw std::length_error(fmt::format("Response body does not fit into the buffer of {} bytes", buffer_.size()));
+    }
+    std::memcpy(buffer_.data() + size_, data.data(), data.size());
+    size_ += data.size();
+}
+
+std::string_view BufferBodySink::GetBody() const noexcept { return {buffer_.data(), size_}; }
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
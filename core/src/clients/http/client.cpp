@@ -17,6 +17,9 @@
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/adaptive_hedging.hpp>
+#include <clients/http/http2_pool.hpp>
+#include <clients/http/request_coalescer.hpp>
 #include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <curl-ev/multi.hpp>
@@ -50,6 +53,8 @@ Client::Client(
     : deadline_propagation_config_(settings.deadline_propagation),
       cancellation_policy_(settings.cancellation_policy),
       destination_statistics_(std::make_shared<DestinationStatistics>()),
+      request_coalescer_(std::make_shared<RequestCoalescer>()),
+      adaptive_hedging_(std::make_unique<AdaptiveHedging>(destination_statistics_)),
       statistics_(settings.io_threads),
       fs_task_processor_(fs_task_processor),
       user_agent_(utils::GetUserverIdentifier()),
@@ -79,6 +84,16 @@ Client::Client(
         }
     }).Get();
 
+    if (settings.http2_pool.enabled) {
+        std::vector<curl::multi*> multis;
+        multis.reserve(multis_.size());
+        for (auto& multi : multis_) {
+            multi->SetMaxConcurrentStreams(ClampToLong(settings.http2_pool.max_streams_per_connection));
+            multis.push_back(multi.get());
+        }
+        http2_pool_ = std::make_shared<Http2Pool>(settings.http2_pool, std::move(multis));
+    }
+
     easy_reinit_task_.Start("http_easy_reinit", utils::PeriodicTask::Settings(kEasyReinitPeriod), [this] {
         ReinitEasy();
     });
@@ -164,14 +179,33 @@ Request Client::CreateRequest() {
     }
     request.SetDeadlinePropagationConfig(deadline_propagation_config_);
     request.SetCancellationPolicy(cancellation_policy_);
+    request.SetRequestCoalescer(request_coalescer_);
+    if (http2_pool_) {
+        request.SetHttp2Pool(http2_pool_);
+    }
 
     return request;
 }
 
+std::shared_ptr<Response>
+Client::PerformHedged(const std::function<void(Request&)>& setup, const AdaptiveHedgingSettings& settings) {
+    return adaptive_hedging_->Perform(
+        [this, &setup] {
+            auto request = CreateRequest();
+            setup(request);
+            return request;
+        },
+        settings
+    );
+}
+
 void Client::SetMultiplexingEnabled(bool enabled) {
     for (auto& multi : multis_) {
         multi->SetMultiplexingEnabled(enabled);
     }
+    if (http2_pool_) {
+        http2_pool_->SetMultiplexingEnabled(enabled);
+    }
 }
 
 void Client::SetMaxHostConnections(size_t max_host_connections) {
@@ -225,6 +259,10 @@ void Client::SetDestinationMetricsAutoMaxSize(size_t max_size) { destination_sta
 
 const DestinationStatistics& Client::GetDestinationStatistics() const { return *destination_statistics_; }
 
+const AdaptiveHedging& Client::GetAdaptiveHedging() const { return *adaptive_hedging_; }
+
+const Http2Pool* Client::GetHttp2Pool() const { return http2_pool_.get(); }
+
 void Client::PushIdleEasy(std::shared_ptr<curl::easy>&& easy) noexcept {
     try {
         easy->reset();
@@ -6,10 +6,13 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/trim.hpp>
 
+#include <clients/http/adaptive_hedging.hpp>
 #include <clients/http/client_utils_test.hpp>
+#include <clients/http/http2_pool.hpp>
 #include <clients/http/testsuite.hpp>
 #include <engine/task/task_processor.hpp>
 #include <userver/clients/dns/resolver.hpp>
+#include <userver/clients/http/body_sink.hpp>
 #include <userver/clients/http/connect_to.hpp>
 #include <userver/clients/http/streamed_response.hpp>
 #include <userver/concurrent/queue.hpp>
@@ -23,8 +26,12 @@
 #include <userver/http/common_headers.hpp>
 #include <userver/http/http_version.hpp>
 #include <userver/logging/log.hpp>
+#include <userver/tracing/manager.hpp>
 #include <userver/tracing/tracing.hpp>
 #include <userver/utils/async.hpp>
+#include <userver/utils/mock_now.hpp>
+#include <userver/utils/scope_guard.hpp>
+#include <userver/utils/statistics/testing.hpp>
 #include <userver/utils/userver_info.hpp>
 
 #include <userver/utest/http_client.hpp>
@@ -346,6 +353,25 @@ HttpResponse no_user_agent_validate_callback(const HttpRequest& request) {
         HttpResponse::kWriteAndClose};
 }
 
+struct CountingSleepCallback {
+    std::shared_ptr<std::size_t> requests = std::make_shared<std::size_t>(0);
+
+    HttpResponse operator()(const HttpRequest& request) const {
+        ++*requests;
+        return sleep_callback_base(request, std::chrono::milliseconds{100});
+    }
+};
+
+// Only the first request is slow
+struct SlowFirstCallback {
+    std::shared_ptr<std::size_t> requests = std::make_shared<std::size_t>(0);
+
+    HttpResponse operator()(const HttpRequest& request) const {
+        const auto sleep_for = (++*requests == 1 ? utest::kMaxTestWaitTime : std::chrono::milliseconds{0});
+        return sleep_callback_base(request, sleep_for);
+    }
+};
+
 struct Response301WithHeader {
     const std::string location;
     const std::string header;
@@ -1551,4 +1577,188 @@ UTEST(HttpClient, DigestAuth) {
     }
 }
 
+UTEST(HttpClient, Coalesce) {
+    const CountingSleepCallback callback;
+    const utest::SimpleServer http_server{callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    const auto perform_all = [&](const std::string& header_value, bool coalesce) {
+        std::vector<clients::http::ResponseFuture> futures;
+        for (unsigned i = 0; i < kFewRepetitions; ++i) {
+            futures.push_back(http_client_ptr->CreateRequest()
+                                  .get(http_server.GetBaseUrl())
+                                  .headers({{kTestHeader, header_value}})
+                                  .timeout(kTimeout)
+                                  .coalesce(coalesce)
+                                  .async_perform());
+        }
+        for (auto& future : futures) {
+            const auto response = future.Get();
+            EXPECT_EQ(response->status_code(), 200);
+            EXPECT_EQ(response->body(), std::string(4096, '@'));
+        }
+    };
+
+    perform_all("a", true);
+    EXPECT_EQ(*callback.requests, 1);
+
+    perform_all("b", false);
+    EXPECT_EQ(*callback.requests, 1 + kFewRepetitions);
+
+    // The response of a finished request is not reused
+    perform_all("a", true);
+    EXPECT_EQ(*callback.requests, 2 + kFewRepetitions);
+}
+
+UTEST(HttpClient, PerformHedged) {
+    const SlowFirstCallback callback;
+    const utest::SimpleServer http_server{callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    clients::http::AdaptiveHedgingSettings settings;
+    settings.fallback_delay = std::chrono::milliseconds{50};
+    settings.timeout_all = kTimeout;
+
+    const auto response = http_client_ptr->PerformHedged(
+        [&](clients::http::Request& request) { request.get(http_server.GetBaseUrl()).timeout(kTimeout); }, settings
+    );
+    EXPECT_EQ(response->status_code(), 200);
+    EXPECT_EQ(response->body(), std::string(4096, '@'));
+    EXPECT_EQ(*callback.requests, 2);
+
+    // The budget of the destination allows a single backup request
+    settings.budget.max_tokens = 1;
+    const auto url = http_server.GetBaseUrl() + "/small-budget";
+    const auto perform = [&] {
+        *callback.requests = 0;
+        return http_client_ptr->PerformHedged(
+            [&](clients::http::Request& request) { request.get(url).timeout(kTimeout); }, settings
+        );
+    };
+
+    EXPECT_EQ(perform()->status_code(), 200);
+    EXPECT_EQ(*callback.requests, 2);
+
+    settings.timeout_all = std::chrono::milliseconds{200};
+    EXPECT_THROW(perform(), clients::http::TimeoutException);
+    EXPECT_EQ(*callback.requests, 1);
+}
+
+UTEST(HttpClient, PerformHedgedDelayFollowsPercentile) {
+    constexpr std::size_t kMinSamples = 5;
+    constexpr std::chrono::milliseconds kResponseTime{100};
+
+    const CountingSleepCallback callback;
+    const utest::SimpleServer http_server{callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+    // The timings of the destination come from its metrics
+    http_client_ptr->SetDestinationMetricsAutoMaxSize(1);
+
+    utils::statistics::Storage storage;
+    const auto statistics_scope = storage.RegisterWriter(
+        "hedging", [&](utils::statistics::Writer& writer) { writer = http_client_ptr->GetAdaptiveHedging(); }
+    );
+    const auto get_delay = [&] {
+        const utils::statistics::Snapshot snapshot{
+            storage, "hedging", {{"http_destination", http_server.GetBaseUrl()}}};
+        return std::chrono::milliseconds{snapshot.SingleMetric("delay-ms").AsInt()};
+    };
+
+    clients::http::AdaptiveHedgingSettings settings;
+    settings.min_samples = kMinSamples;
+    settings.fallback_delay = kTimeout;
+    settings.timeout_all = kTimeout;
+    const auto perform = [&] {
+        const auto response = http_client_ptr->PerformHedged(
+            [&](clients::http::Request& request) { request.get(http_server.GetBaseUrl()).timeout(kTimeout); },
+            settings
+        );
+        EXPECT_EQ(response->status_code(), 200);
+    };
+
+    // The recent timings skip the current epoch of the destination metrics
+    utils::datetime::MockNowSet(std::chrono::system_clock::now());
+    const utils::ScopeGuard mock_now_guard{[] { utils::datetime::MockNowUnset(); }};
+
+    for (std::size_t i = 0; i <= kMinSamples; ++i) {
+        perform();
+        EXPECT_EQ(get_delay(), kTimeout) << "Not enough timings yet";
+    }
+    EXPECT_EQ(*callback.requests, kMinSamples + 1);
+
+    utils::datetime::MockSleep(std::chrono::seconds{10});
+    perform();
+    const auto delay = get_delay();
+    EXPECT_GE(delay, kResponseTime);
+    EXPECT_LT(delay, kTimeout);
+}
+
+UTEST(HttpClient, ResponseBodySink) {
+    const EchoCallback callback;
+    const utest::SimpleServer http_server{callback};
+    auto http_client_ptr = utest::CreateHttpClient();
+
+    const std::string payload(4096, '@');
+    std::string buffer(payload.size(), '\0');
+    auto sink = std::make_shared<clients::http::BufferBodySink>(utils::span<char>{buffer.data(), buffer.size()});
+    const auto response = http_client_ptr->CreateRequest()
+                              .post(http_server.GetBaseUrl(), payload)
+                              .response_body_sink(sink)
+                              .timeout(kTimeout)
+                              .perform();
+    EXPECT_EQ(response->status_code(), 200);
+    EXPECT_EQ(response->body_view(), "");
+    EXPECT_EQ(sink->GetBody(), payload);
+    EXPECT_EQ(sink->GetBody().data(), buffer.data());
+
+    std::string small_buffer(payload.size() / 2, '\0');
+    auto small_sink =
+        std::make_shared<clients::http::BufferBodySink>(utils::span<char>{small_buffer.data(), small_buffer.size()});
+    EXPECT_THROW(
+        http_client_ptr->CreateRequest()
+            .post(http_server.GetBaseUrl(), payload)
+            .response_body_sink(small_sink)
+            .timeout(kTimeout)
+            .perform(),
+        clients::http::BaseException
+    );
+}
+
+UTEST(HttpClient, Http2Pool) {
+    const EchoCallback callback;
+    const utest::SimpleServer http_server{callback};
+
+    const tracing::GenericTracingManager tracing_manager{tracing::Format::kYandexTaxi, tracing::Format::kYandexTaxi};
+    clients::http::ClientSettings settings;
+    settings.io_threads = 4;
+    settings.tracing_manager = &tracing_manager;
+    settings.http2_pool.enabled = true;
+    clients::http::Client http_client{
+        std::move(settings),
+        engine::current_task::GetTaskProcessor(),
+        std::vector<utils::NotNull<clients::http::Plugin*>>{}};
+
+    const auto* http2_pool = http_client.GetHttp2Pool();
+    ASSERT_TRUE(http2_pool);
+    utils::statistics::Storage storage;
+    const auto statistics_scope =
+        storage.RegisterWriter("http2-pool", [http2_pool](utils::statistics::Writer& writer) { writer = *http2_pool; });
+
+    // No TLS, so the request is performed over HTTP/1.1, yet it is placed
+    for (unsigned i = 0; i < kFewRepetitions; ++i) {
+        const auto response = http_client.CreateRequest()
+                                  .post(http_server.GetBaseUrl(), "test")
+                                  .http_version(USERVER_NAMESPACE::http::HttpVersion::k2Tls)
+                                  .timeout(kTimeout)
+                                  .perform();
+        EXPECT_EQ(response->status_code(), 200);
+    }
+
+    const utils::statistics::Snapshot snapshot{storage, "http2-pool", {{"http_destination", http_server.GetBaseUrl()}}};
+    EXPECT_EQ(snapshot.SingleMetric("requests").AsRate(), kFewRepetitions);
+    EXPECT_EQ(snapshot.SingleMetric("streams").AsInt(), 0);
+    // The sequential requests stick to the IO thread that served the first one
+    EXPECT_EQ(snapshot.SingleMetric("io-threads").AsInt(), 1);
+}
+
 USERVER_NAMESPACE_END
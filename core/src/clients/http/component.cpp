@@ -9,7 +9,9 @@
 #include <userver/server/middlewares/headers_propagator.hpp>
 #include <userver/testsuite/testsuite_support.hpp>
 
+#include <clients/http/adaptive_hedging.hpp>
 #include <clients/http/destination_statistics.hpp>
+#include <clients/http/http2_pool.hpp>
 #include <clients/http/statistics.hpp>
 #include <clients/http/testsuite.hpp>
 #include <userver/clients/http/client.hpp>
@@ -156,6 +158,10 @@ void HttpClient::WriteStatistics(utils::statistics::Writer& writer) {
         DumpMetric(writer, http_client_.GetPoolStatistics());
     }
     DumpMetric(writer, http_client_.GetDestinationStatistics());
+    writer["hedging"] = http_client_.GetAdaptiveHedging();
+    if (const auto* http2_pool = http_client_.GetHttp2Pool()) {
+        writer["http2-pool"] = *http2_pool;
+    }
 }
 
 yaml_config::Schema HttpClient::GetStaticConfigSchema() {
@@ -231,6 +237,19 @@ properties:
         enum:
           - cancel
           - ignore
+    http2-pool:
+        type: object
+        description: placement of the HTTP/2 requests to a destination onto few IO threads to share their connections
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: set to true to place the HTTP/2 requests of a destination onto the IO threads already connected to it
+                defaultDescription: false
+            max-streams-per-connection:
+                type: integer
+                description: max number of concurrent requests over a single HTTP/2 connection
+                defaultDescription: 100
 )");
 }
 
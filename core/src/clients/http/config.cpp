@@ -38,6 +38,14 @@ DeadlinePropagationConfig ParseDeadlinePropagationConfig(const yaml_config::Yaml
     return result;
 }
 
+Http2PoolSettings ParseHttp2PoolSettings(const yaml_config::YamlConfig& value) {
+    Http2PoolSettings result;
+    result.enabled = value["enabled"].As<bool>(result.enabled);
+    result.max_streams_per_connection =
+        value["max-streams-per-connection"].As<std::size_t>(result.max_streams_per_connection);
+    return result;
+}
+
 }  // namespace
 
 CancellationPolicy Parse(yaml_config::YamlConfig value, formats::parse::To<CancellationPolicy>) {
@@ -52,6 +60,7 @@ ClientSettings Parse(const yaml_config::YamlConfig& value, formats::parse::To<Cl
     result.thread_name_prefix = value["thread-name-prefix"].As<std::string>(result.thread_name_prefix);
     result.io_threads = value["threads"].As<size_t>(result.io_threads);
     result.deadline_propagation = ParseDeadlinePropagationConfig(value);
+    result.http2_pool = ParseHttp2PoolSettings(value["http2-pool"]);
     return result;
 }
 
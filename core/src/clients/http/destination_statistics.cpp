@@ -59,6 +59,12 @@ void DestinationStatistics::SetAutoMaxSize(size_t max_auto_destinations) {
     max_auto_destinations_ = max_auto_destinations;
 }
 
+std::optional<Percentile> DestinationStatistics::GetRecentTimings(const std::string& destination) const {
+    const auto stats = rcu_map_.Get(destination);
+    if (!stats) return std::nullopt;
+    return stats->GetRecentTimings();
+}
+
 DestinationStatistics::DestinationsMap::ConstIterator DestinationStatistics::begin() const { return rcu_map_.begin(); }
 
 DestinationStatistics::DestinationsMap::ConstIterator DestinationStatistics::end() const { return rcu_map_.end(); }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 
 #include <userver/rcu/rcu_map.hpp>
@@ -23,6 +24,10 @@ public:
 
     void SetAutoMaxSize(size_t max_auto_destinations);
 
+    // Return recent timings of the destination, std::nullopt if there are no
+    // statistics for it
+    std::optional<Percentile> GetRecentTimings(const std::string& destination) const;
+
     using DestinationsMap = rcu::RcuMap<std::string, Statistics>;
 
     DestinationsMap::ConstIterator begin() const;
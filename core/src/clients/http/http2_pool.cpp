@@ -0,0 +1,179 @@
+#include <clients/http/http2_pool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <utility>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/statistics/rate.hpp>
+#include <userver/utils/statistics/writer.hpp>
+
+#include <curl-ev/share.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+namespace {
+
+// libcurl closes the connections that were idle for 118 seconds by default
+constexpr std::chrono::milliseconds kConnectionIdleTime{std::chrono::seconds{60}};
+
+// Each destination holds the streams counters of every IO thread until the
+// pool is destroyed, the requests to the rest are not placed
+constexpr std::size_t kMaxDestinations = 1000;
+
+constexpr std::string_view kSchemaSeparator = "://";
+
+// libcurl expires the idle connections by the real clock, so a mocked time
+// must not affect the placement
+std::int64_t NowMs() noexcept {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// "scheme://host:port" part of the URL without the user info
+std::string ExtractDestination(std::string_view url) {
+    const auto schema_end = url.find(kSchemaSeparator);
+    if (schema_end == std::string_view::npos) return {};
+
+    auto authority = url.substr(schema_end + kSchemaSeparator.size());
+    authority = authority.substr(0, authority.find_first_of("/?#"));
+    const auto userinfo_end = authority.rfind('@');
+    if (userinfo_end != std::string_view::npos) authority.remove_prefix(userinfo_end + 1);
+
+    std::string result{url.substr(0, schema_end + kSchemaSeparator.size())};
+    result.append(authority);
+    return result;
+}
+
+struct DestinationSnapshot final {
+    std::size_t streams{0};
+    std::size_t io_threads{0};
+    std::uint64_t requests{0};
+    std::uint64_t moved_requests{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const DestinationSnapshot& snapshot) {
+    writer["streams"] = snapshot.streams;
+    writer["io-threads"] = snapshot.io_threads;
+    writer["requests"] = utils::statistics::Rate{snapshot.requests};
+    writer["moved-requests"] = utils::statistics::Rate{snapshot.moved_requests};
+}
+
+}  // namespace
+
+bool Http2Pool::Destination::Multi::IsConnectionOpen(std::int64_t now_ms) const noexcept {
+    return streams.load(std::memory_order_relaxed) > 0 ||
+           now_ms - last_used_ms.load(std::memory_order_relaxed) < kConnectionIdleTime.count();
+}
+
+Http2Pool::Lease::Lease(std::shared_ptr<Destination> destination, std::size_t index, curl::multi& multi) noexcept
+    : destination_(std::move(destination)), index_(index), multi_(&multi) {}
+
+Http2Pool::Lease::Lease(Lease&& other) noexcept
+    : destination_(std::move(other.destination_)), index_(other.index_), multi_(std::exchange(other.multi_, nullptr)) {}
+
+Http2Pool::Lease& Http2Pool::Lease::operator=(Lease&& other) noexcept {
+    if (this == &other) return *this;
+    Release();
+    destination_ = std::move(other.destination_);
+    index_ = other.index_;
+    multi_ = std::exchange(other.multi_, nullptr);
+    return *this;
+}
+
+Http2Pool::Lease::~Lease() { Release(); }
+
+curl::multi& Http2Pool::Lease::GetMulti() const {
+    UASSERT(multi_);
+    return *multi_;
+}
+
+void Http2Pool::Lease::Release() noexcept {
+    if (!destination_) return;
+    auto& multi = destination_->multis[index_];
+    multi.last_used_ms.store(NowMs(), std::memory_order_relaxed);
+    multi.streams.fetch_sub(1, std::memory_order_relaxed);
+    destination_.reset();
+}
+
+Http2Pool::Http2Pool(const Http2PoolSettings& settings, std::vector<curl::multi*> multis)
+    : max_streams_per_connection_(std::max<std::size_t>(settings.max_streams_per_connection, 1)),
+      multis_(std::move(multis)),
+      share_(std::make_shared<curl::share>()) {
+    UASSERT(!multis_.empty());
+    share_->set_share_ssl_session(true);
+}
+
+Http2Pool::~Http2Pool() = default;
+
+Http2Pool::Lease Http2Pool::Acquire(std::string_view url, const curl::multi* current) {
+    if (!multiplexing_enabled_) return {};
+
+    auto key = ExtractDestination(url);
+    if (key.empty()) return {};
+
+    auto destination = destinations_.Get(key);
+    if (!destination) {
+        if (destinations_.SizeApprox() >= kMaxDestinations) return {};
+        destination = destinations_.TryEmplace(key, multis_.size()).value;
+    }
+
+    const auto current_it = std::find(multis_.begin(), multis_.end(), current);
+    const auto current_index = current_it != multis_.end() ? current_it - multis_.begin() : 0;
+    const auto index = Place(*destination, current_index);
+
+    destination->multis[index].streams.fetch_add(1, std::memory_order_relaxed);
+    destination->requests.fetch_add(1, std::memory_order_relaxed);
+    if (index != static_cast<std::size_t>(current_index)) {
+        destination->moved_requests.fetch_add(1, std::memory_order_relaxed);
+    }
+    return Lease{std::move(destination), index, *multis_[index]};
+}
+
+std::size_t Http2Pool::Place(const Destination& destination, std::size_t current) const {
+    const auto now = NowMs();
+    std::optional<std::size_t> best_open;
+    std::size_t best_open_streams = 0;
+    std::size_t best_any = current;
+    std::size_t best_any_streams = destination.multis[current].streams.load(std::memory_order_relaxed);
+
+    // Starting from the current multi keeps the request on it if it is as good
+    // as the others, rebinding is not free
+    for (std::size_t i = 0; i < multis_.size(); ++i) {
+        const auto index = (current + i) % multis_.size();
+        const auto& multi = destination.multis[index];
+        const auto streams = multi.streams.load(std::memory_order_relaxed);
+        const bool has_free_stream = multi.IsConnectionOpen(now) && streams < max_streams_per_connection_;
+        if (has_free_stream && (!best_open || streams < best_open_streams)) {
+            best_open = index;
+            best_open_streams = streams;
+        }
+        if (streams < best_any_streams) {
+            best_any = index;
+            best_any_streams = streams;
+        }
+    }
+
+    return best_open.value_or(best_any);
+}
+
+void DumpMetric(utils::statistics::Writer& writer, const Http2Pool& pool) {
+    const auto now = NowMs();
+    for (const auto& [destination, stats] : pool.destinations_) {
+        DestinationSnapshot snapshot;
+        for (const auto& multi : stats->multis) {
+            snapshot.streams += multi.streams.load(std::memory_order_relaxed);
+            if (multi.IsConnectionOpen(now)) ++snapshot.io_threads;
+        }
+        snapshot.requests = stats->requests.load(std::memory_order_relaxed);
+        snapshot.moved_requests = stats->moved_requests.load(std::memory_order_relaxed);
+        writer.ValueWithLabels(snapshot, {"http_destination", destination});
+    }
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/clients/http/config.hpp>
+#include <userver/rcu/rcu_map.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace curl {
+class multi;
+class share;
+}  // namespace curl
+
+namespace clients::http {
+
+/// Places the HTTP/2 requests to a destination onto few curl::multi instances,
+/// so that the requests are multiplexed over the connections of those multis
+/// instead of every multi opening connections of its own.
+///
+/// The multis that served the destination recently most likely keep an open
+/// connection to it, the least loaded of them with less than
+/// `max-streams-per-connection` requests in flight gets the request. If all of
+/// them are full, the least loaded of all multis gets it.
+class Http2Pool final {
+    struct Destination;
+
+public:
+    Http2Pool(const Http2PoolSettings& settings, std::vector<curl::multi*> multis);
+    ~Http2Pool();
+
+    /// A request placed onto a multi, releases its stream on destruction
+    class Lease final {
+    public:
+        Lease() = default;
+        Lease(Lease&&) noexcept;
+        Lease& operator=(Lease&&) noexcept;
+        ~Lease();
+
+        explicit operator bool() const noexcept { return multi_ != nullptr; }
+
+        curl::multi& GetMulti() const;
+
+    private:
+        friend class Http2Pool;
+
+        Lease(std::shared_ptr<Destination> destination, std::size_t index, curl::multi& multi) noexcept;
+
+        void Release() noexcept;
+
+        std::shared_ptr<Destination> destination_;
+        std::size_t index_{0};
+        curl::multi* multi_{nullptr};
+    };
+
+    /// Places a request to the URL, `current` is the multi the request is
+    /// bound to and is preferred among the equally loaded ones
+    Lease Acquire(std::string_view url, const curl::multi* current);
+
+    /// TLS sessions shared by all the multis
+    const std::shared_ptr<curl::share>& GetShare() const noexcept { return share_; }
+
+    void SetMultiplexingEnabled(bool enabled) noexcept { multiplexing_enabled_ = enabled; }
+    bool IsMultiplexingEnabled() const noexcept { return multiplexing_enabled_; }
+
+    friend void DumpMetric(utils::statistics::Writer& writer, const Http2Pool& pool);
+
+private:
+    struct Destination final {
+        struct Multi final {
+            std::atomic<std::size_t> streams{0};
+            /// steady clock milliseconds, the connection is likely to be open
+            /// for some time after the last stream
+            std::atomic<std::int64_t> last_used_ms{0};
+
+            bool IsConnectionOpen(std::int64_t now_ms) const noexcept;
+        };
+
+        explicit Destination(std::size_t multis_count) : multis(multis_count) {}
+
+        std::vector<Multi> multis;
+        std::atomic<std::uint64_t> requests{0};
+        std::atomic<std::uint64_t> moved_requests{0};
+    };
+
+    std::size_t Place(const Destination& destination, std::size_t current) const;
+
+    const std::size_t max_streams_per_connection_;
+    const std::vector<curl::multi*> multis_;
+    std::shared_ptr<curl::share> share_;
+    std::atomic<bool> multiplexing_enabled_{true};
+    rcu::RcuMap<std::string, Destination> destinations_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -140,7 +140,7 @@ void SetHeaders(curl::easy& easy, const Range& headers_range) {
 }
 
 template <class Range>
-void SetCookies(curl::easy& easy, const Range& cookies_range) {
+void SetCookies(RequestState& state, const Range& cookies_range) {
     std::string cookie_str;
     for (const auto& [name, value] : cookies_range) {
         if (!cookie_str.empty()) cookie_str += "; ";
@@ -148,7 +148,7 @@ void SetCookies(curl::easy& easy, const Range& cookies_range) {
         cookie_str += '=';
         cookie_str += value;
     }
-    easy.set_cookie(cookie_str);
+    state.cookies(std::move(cookie_str));
 }
 
 template <class Range>
@@ -407,13 +407,13 @@ Request& Request::proxy_auth_type(ProxyAuthType value) & {
 Request Request::proxy_auth_type(ProxyAuthType value) && { return std::move(this->proxy_auth_type(value)); }
 
 Request& Request::cookies(const Cookies& cookies) & {
-    SetCookies(pimpl_->easy(), cookies);
+    SetCookies(*pimpl_, cookies);
     return *this;
 }
 Request Request::cookies(const Cookies& cookies) && { return std::move(this->cookies(cookies)); }
 
 Request& Request::cookies(const std::unordered_map<std::string, std::string>& cookies) & {
-    SetCookies(pimpl_->easy(), cookies);
+    SetCookies(*pimpl_, cookies);
     return *this;
 }
 Request Request::cookies(const std::unordered_map<std::string, std::string>& cookies) && {
@@ -421,6 +421,7 @@ Request Request::cookies(const std::unordered_map<std::string, std::string>& coo
 }
 
 Request& Request::method(HttpMethod method) & {
+    pimpl_->method(method);
     switch (method) {
         case HttpMethod::kDelete:
         case HttpMethod::kOptions:
@@ -471,6 +472,7 @@ Request& Request::set_custom_http_request_method(std::string method) & {
                              "changing of request type. Use it only if you need to make "
                              "GET-request with body.";
     pimpl_->easy().set_custom_request(method);
+    pimpl_->method(std::nullopt);
     return *this;
 }
 Request Request::set_custom_http_request_method(std::string method) && {
@@ -545,6 +547,26 @@ Request Request::DisableReplyDecoding() && { return std::move(this->DisableReply
 
 void Request::SetCancellationPolicy(CancellationPolicy cp) { pimpl_->SetCancellationPolicy(cp); }
 
+Request& Request::coalesce(bool enable) & {
+    pimpl_->coalesce(enable);
+    return *this;
+}
+Request Request::coalesce(bool enable) && { return std::move(this->coalesce(enable)); }
+
+Request& Request::response_body_sink(std::shared_ptr<ResponseBodySink> sink) & {
+    pimpl_->response_body_sink(std::move(sink));
+    return *this;
+}
+Request Request::response_body_sink(std::shared_ptr<ResponseBodySink> sink) && {
+    return std::move(this->response_body_sink(std::move(sink)));
+}
+
+void Request::SetRequestCoalescer(const std::shared_ptr<RequestCoalescer>& coalescer) & {
+    pimpl_->SetRequestCoalescer(coalescer);
+}
+
+void Request::SetHttp2Pool(const std::shared_ptr<Http2Pool>& http2_pool) & { pimpl_->SetHttp2Pool(http2_pool); }
+
 Request& Request::SetTracingManager(const tracing::TracingManagerBase& tracing_manager) & {
     pimpl_->SetTracingManager(tracing_manager);
     return *this;
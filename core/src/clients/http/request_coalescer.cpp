@@ -0,0 +1,58 @@
+#include <clients/http/request_coalescer.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+std::optional<RequestCoalescer::ResponseFuture> RequestCoalescer::Join(const std::string& key) {
+    auto in_flight = in_flight_.Lock();
+    const auto it = in_flight->find(key);
+    if (it == in_flight->end()) {
+        in_flight->emplace(key, Promises{});
+        return std::nullopt;
+    }
+
+    auto& promise = it->second.emplace_back();
+    return promise.get_future();
+}
+
+void RequestCoalescer::Finish(
+    const std::string& key,
+    const std::shared_ptr<Response>& response,
+    std::exception_ptr exception
+) {
+    UASSERT(response || exception);
+
+    Promises promises;
+    {
+        auto in_flight = in_flight_.Lock();
+        const auto it = in_flight->find(key);
+        if (it == in_flight->end()) return;
+        promises = std::move(it->second);
+        in_flight->erase(it);
+    }
+
+    // Each of the requests gets its own copy as Response is mutable
+    for (auto& promise : promises) {
+        if (exception) {
+            promise.set_exception(exception);
+        } else {
+            promise.set_value(std::make_shared<Response>(*response));
+        }
+    }
+}
+
+void RequestCoalescer::Abandon(const std::string& key) noexcept {
+    Promises promises;
+    auto in_flight = in_flight_.Lock();
+    const auto it = in_flight->find(key);
+    if (it == in_flight->end()) return;
+    promises = std::move(it->second);
+    in_flight->erase(it);
+}
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
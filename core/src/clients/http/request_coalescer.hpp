@@ -0,0 +1,46 @@
+#pragma once
+
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <userver/clients/http/response.hpp>
+#include <userver/concurrent/variable.hpp>
+#include <userver/engine/future.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace clients::http {
+
+/// Shares one in-flight request between the identical requests of a client,
+/// see Request::coalesce()
+class RequestCoalescer final {
+public:
+    using ResponseFuture = engine::Future<std::shared_ptr<Response>>;
+
+    /// Returns the future of the in-flight request with the same key, or
+    /// std::nullopt if there is none. In the latter case the caller performs
+    /// the request and must call Finish() with its result.
+    std::optional<ResponseFuture> Join(const std::string& key);
+
+    /// Passes the response or the exception to the requests joined to the key
+    void Finish(const std::string& key, const std::shared_ptr<Response>& response, std::exception_ptr exception);
+
+    /// Forgets the key without a result, the joined requests get
+    /// engine::FutureError
+    void Abandon(const std::string& key) noexcept;
+
+private:
+    using Promises = std::vector<engine::Promise<std::shared_ptr<Response>>>;
+
+    // Promises are fulfilled from the ev threads, so the lock is not an engine one
+    concurrent::Variable<std::unordered_map<std::string, Promises>, std::mutex> in_flight_;
+};
+
+}  // namespace clients::http
+
+USERVER_NAMESPACE_END
@@ -1,6 +1,7 @@
 #include <clients/http/request_state.hpp>
 
 #include <algorithm>
+#include <charconv>
 #include <chrono>
 #include <string_view>
 
@@ -16,6 +17,7 @@
 #include <userver/baggage/baggage.hpp>
 #include <userver/clients/dns/resolver.hpp>
 #include <userver/clients/http/connect_to.hpp>
+#include <userver/clients/http/request.hpp>
 #include <userver/server/request/task_inherited_data.hpp>
 #include <userver/utils/assert.hpp>
 #include <userver/utils/async.hpp>
@@ -50,6 +52,10 @@ constexpr Status kLeastHttpCodeForDeadlineExpired{400};
 
 constexpr Status kFakeHttpErrorCode{599};
 
+/// Max size of the response body storage reserved from the Content-Length
+/// header, a larger body grows the storage as it arrives
+constexpr std::size_t kMaxBodyReserveSize = 4 * 1024 * 1024;
+
 constexpr std::string_view kTracingClientName = "external";
 
 constexpr utils::TrivialBiMap kTestsuiteActions = [](auto selector) {
@@ -94,6 +100,11 @@ bool IsSetCookie(std::string_view key) {
     return equal(key, USERVER_NAMESPACE::http::headers::kSetCookie);
 }
 
+bool IsContentLength(std::string_view key) {
+    const utils::StrIcaseEqual equal;
+    return equal(key, USERVER_NAMESPACE::http::headers::kContentLength);
+}
+
 // Not a strict check, but OK for non-header line check
 bool IsHttpStatusLineStart(const char* ptr, size_t size) { return (size > 5 && memcmp(ptr, "HTTP/", 5) == 0); }
 
@@ -250,6 +261,8 @@ RequestState::RequestState(
 }
 
 RequestState::~RequestState() {
+    if (coalescing_key_) coalescer_->Abandon(*coalescing_key_);
+
     std::error_code ec;
     easy().set_error_buffer(nullptr, ec);
     UASSERT(!ec);
@@ -328,7 +341,10 @@ void RequestState::client_key_cert(crypto::PrivateKey pkey, crypto::Certificate
     }
 }
 
-void RequestState::http_version(curl::easy::http_version_t version) { easy().set_http_version(version); }
+void RequestState::http_version(curl::easy::http_version_t version) {
+    easy().set_http_version(version);
+    http_version_ = version;
+}
 
 void RequestState::set_timeout(long timeout_ms) {
     original_timeout_ = std::chrono::milliseconds{timeout_ms};
@@ -368,6 +384,17 @@ void RequestState::http_auth_type(
     easy().set_password(std::string{password}.c_str());
 }
 
+void RequestState::method(std::optional<HttpMethod> method) { method_ = method; }
+
+void RequestState::cookies(std::string cookies) {
+    easy().set_cookie(cookies);
+    cookies_ = std::move(cookies);
+}
+
+void RequestState::coalesce(bool enable) { coalesce_ = enable; }
+
+void RequestState::response_body_sink(std::shared_ptr<ResponseBodySink> sink) { body_sink_ = std::move(sink); }
+
 void RequestState::Cancel() {
     // We can not call `retry_.timer.reset();` here because of data race
     is_cancelled_ = true;
@@ -398,6 +425,13 @@ void RequestState::SetDeadlinePropagationConfig(const DeadlinePropagationConfig&
     deadline_propagation_config_ = deadline_propagation_config;
 }
 
+void RequestState::SetRequestCoalescer(const std::shared_ptr<RequestCoalescer>& coalescer) { coalescer_ = coalescer; }
+
+void RequestState::SetHttp2Pool(const std::shared_ptr<Http2Pool>& http2_pool) {
+    http2_pool_ = http2_pool;
+    easy().set_share(http2_pool_->GetShare());
+}
+
 size_t RequestState::on_header(void* ptr, size_t size, size_t nmemb, void* userdata) {
     auto* self = static_cast<RequestState*>(userdata);
     const std::size_t data_size = size * nmemb;
@@ -444,6 +478,8 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
     auto& span = holder->span_storage_->Get();
     auto& easy = holder->easy();
 
+    holder->http2_lease_ = {};
+
     // TODO don't swallow errors, report them to StreamedResponse
     auto* stream_data = std::get_if<StreamData>(&holder->data_);
     if (stream_data && !stream_data->headers_promise_set.exchange(true)) {
@@ -489,8 +525,10 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
             [&holder, &err](FullBufferedData& buffered_data) {
                 { [[maybe_unused]] const auto cleanup = holder->response_move(); }
                 auto promise = std::move(buffered_data.promise_);
+                auto exception = holder->PrepareException(err);
+                holder->FinishCoalescing({}, exception);
                 // The task will wake up and may reuse RequestState.
-                promise.set_exception(holder->PrepareException(err));
+                promise.set_exception(std::move(exception));
             },
             [](StreamData& stream_data) {
                 auto producer = std::move(stream_data.queue_producer);
@@ -512,8 +550,10 @@ void RequestState::on_completed(std::shared_ptr<RequestState> holder, std::error
         const utils::Overloaded visitor{
             [&holder](FullBufferedData& buffered_data) {
                 auto promise = std::move(buffered_data.promise_);
+                auto response = holder->response_move();
+                holder->FinishCoalescing(response, {});
                 // The task will wake up and may reuse RequestState.
-                promise.set_value(holder->response_move());
+                promise.set_value(std::move(response));
             },
             [](StreamData& stream_data) {
                 auto producer = std::move(stream_data.queue_producer);
@@ -628,6 +668,7 @@ void RequestState::parse_header(char* ptr, size_t size) try {
     }
 
     std::string value(col_pos, end - col_pos);
+    if (IsContentLength(key)) ReserveBody(value);
     response_->headers().emplace(std::move(key), std::move(value));
 } catch (const std::exception& e) {
     LOG_ERROR() << "Failed to parse header: " << e.what();
@@ -647,6 +688,23 @@ std::string_view RequestState::GetLoggedEffectiveUrl() noexcept {
 }
 
 engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::impl::SourceLocation location) {
+    UASSERT(!coalescing_key_);
+    if (coalesce_ && coalescer_) {
+        auto key = MakeCoalescingKey();
+        if (key) {
+            if (auto future = coalescer_->Join(*key)) {
+                // ResponseFuture waits for the deadline of the current task
+                deadline_ = server::request::GetTaskInheritedDeadline();
+                deadline_expired_ = false;
+                return std::move(*future);
+            }
+            coalescing_key_ = std::move(key);
+            // The other requests wait for the response, so cancellation of the
+            // current one must not interrupt the transfer
+            cancellation_policy_ = CancellationPolicy::kIgnore;
+        }
+    }
+
     data_.emplace<FullBufferedData>();
 
     StartNewSpan(location);
@@ -656,7 +714,12 @@ engine::Future<std::shared_ptr<Response>> RequestState::async_perform(utils::imp
     span.AddTag("stream_api", 0);
 
     // set place for response body
-    easy().set_sink(&response_->sink_string());
+    if (body_sink_) {
+        easy().set_write_function(&RequestState::SinkWriteFunction);
+        easy().set_write_data(this);
+    } else {
+        easy().set_sink(&response_->sink_string());
+    }
 
     auto future = std::get_if<FullBufferedData>(&data_)->promise_.get_future();
 
@@ -701,12 +764,16 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
     UASSERT(response_);
     response_->sink_string().clear();
     response_->body().clear();
+    if (body_sink_) body_sink_->Clear();
 
     UpdateTimeoutHeader();
 
     plugin_pipeline_.HookPerformRequest(*this);
 
-    if (resolver_ && retry_.current == 1) {
+    if (http2_pool_ && retry_.current == 1) PlaceOntoHttp2Pool();
+
+    // Most of the names are cached, they need no task to wait for the network
+    if (resolver_ && retry_.current == 1 && !TryResolveTargetAddressFromCache(*resolver_)) {
         engine::AsyncNoSpan([this, holder = shared_from_this(), handler = std::move(handler)]() mutable {
             try {
                 ResolveTargetAddress(*resolver_);
@@ -714,12 +781,16 @@ void RequestState::perform_request(curl::easy::handler_type handler) {
             } catch (const clients::dns::ResolverException& ex) {
                 // TODO: should retry - TAXICOMMON-4932
                 auto* buffered_data = std::get_if<FullBufferedData>(&data_);
+                http2_lease_ = {};
                 if (buffered_data) {
+                    FinishCoalescing({}, std::current_exception());
                     buffered_data->promise_.set_exception(std::current_exception());
                 }
             } catch (const BaseException& ex) {
                 auto* buffered_data = std::get_if<FullBufferedData>(&data_);
+                http2_lease_ = {};
                 if (buffered_data) {
+                    FinishCoalescing({}, std::current_exception());
                     buffered_data->promise_.set_exception(std::current_exception());
                 }
             }
@@ -790,8 +861,9 @@ void RequestState::HandleDeadlineAlreadyPassed() {
     auto exc = PrepareDeadlinePassedException(GetLoggedOriginalUrl(), easy().get_local_stats());
 
     const utils::Overloaded visitor{
-        [&exc](FullBufferedData& buffered_data) {
+        [this, &exc](FullBufferedData& buffered_data) {
             auto promise = std::move(buffered_data.promise_);
+            FinishCoalescing({}, exc);
             // The task will wake up and may reuse RequestState.
             promise.set_exception(std::move(exc));
         },
@@ -882,6 +954,76 @@ void RequestState::ThrowDeadlineExpiredException() {
     std::rethrow_exception(PrepareDeadlinePassedException(GetLoggedOriginalUrl(), LocalStats{}));
 }
 
+std::optional<std::string> RequestState::MakeCoalescingKey() const {
+    // Only the requests without side effects and without a body are shared
+    if (!method_ || (*method_ != HttpMethod::kGet && *method_ != HttpMethod::kHead)) return std::nullopt;
+    if (easy().has_post_data()) return std::nullopt;
+    // The body of the in-flight request would go to its sink only
+    if (body_sink_) return std::nullopt;
+
+    return fmt::format(
+        "{} {}\r\n{}Cookie: {}\r\nProxy: {}",
+        ToStringView(*method_),
+        easy().get_original_url(),
+        easy().GetHeadersString(),
+        cookies_,
+        proxy_url_
+    );
+}
+
+bool RequestState::IsHttp2Requested() const {
+    switch (http_version_) {
+        case curl::easy::http_version_t::http_version_2_0:
+        case curl::easy::http_version_t::http_version_2tls:
+        case curl::easy::http_version_t::http_version_2_prior_knowledge:
+            return true;
+        case curl::easy::http_version_t::http_version_none:
+            // libcurl negotiates HTTP/2 over TLS by default
+            return utils::text::StartsWith(easy().get_original_url(), "https://");
+        default:
+            return false;
+    }
+}
+
+void RequestState::PlaceOntoHttp2Pool() {
+    http2_lease_ = {};
+    if (!IsHttp2Requested()) return;
+
+    http2_lease_ = http2_pool_->Acquire(easy().get_original_url(), easy().GetMulti());
+    if (http2_lease_) easy().Rebind(http2_lease_.GetMulti());
+}
+
+void RequestState::ReserveBody(std::string_view content_length) noexcept {
+    // HEAD responses announce the size of the body they do not have
+    if (method_ == HttpMethod::kHead || !std::holds_alternative<FullBufferedData>(data_)) return;
+
+    std::size_t size = 0;
+    const auto* end = content_length.data() + content_length.size();
+    if (std::from_chars(content_length.data(), end, size).ptr != end) return;
+
+    try {
+        if (body_sink_) {
+            // The sink decides how much of the announced size to trust
+            body_sink_->Reserve(size);
+        } else {
+            // Avoids the reallocations and the peak memory of 2x the body size
+            // on growth of the body storage. The header comes from the server,
+            // so a huge value does not make the client allocate it up front.
+            size = std::min(size, kMaxBodyReserveSize);
+            response_->sink_string().reserve(size);
+        }
+    } catch (const std::exception& e) {
+        LOG_LIMITED_WARNING() << "Failed to reserve " << size << " bytes for the response body: " << e;
+    }
+}
+
+void RequestState::FinishCoalescing(const std::shared_ptr<Response>& response, std::exception_ptr exception) {
+    if (!coalescing_key_) return;
+    const auto key = std::move(*coalescing_key_);
+    coalescing_key_.reset();
+    coalescer_->Finish(key, response, std::move(exception));
+}
+
 void RequestState::ResetDataForNewRequest() {
     SetBaggageHeader(easy());
 
@@ -910,6 +1052,24 @@ void RequestState::ResetDataForNewRequest() {
     StartStats();
 }
 
+size_t RequestState::SinkWriteFunction(char* ptr, size_t size, size_t nmemb, void* userdata) noexcept {
+    const size_t actual_size = size * nmemb;
+    if (!actual_size) return 0;
+
+    RequestState& rs = *static_cast<RequestState*>(userdata);
+    UASSERT(rs.body_sink_);
+
+    try {
+        rs.body_sink_->Append(std::string_view{ptr, actual_size});
+    } catch (const std::exception& e) {
+        LOG_WARNING() << "Failed to write the response body into the sink: " << e
+                      << tracing::impl::LogSpanAsLastNoCurrent{rs.span_storage_->Get()};
+        // Aborts the transfer with CURLE_WRITE_ERROR
+        return 0;
+    }
+    return actual_size;
+}
+
 size_t RequestState::StreamWriteFunction(char* ptr, size_t size, size_t nmemb, void* userdata) {
     const size_t actual_size = size * nmemb;
     RequestState& rs = *static_cast<RequestState*>(userdata);
@@ -1012,10 +1172,37 @@ void RequestState::ResolveTargetAddress(clients::dns::Resolver& resolver) {
     if (hostname.find(':') != std::string::npos) return;
 
     const auto addrs = resolver.Resolve(hostname, deadline);
+    AddTargetAddress(target.Get(), hostname, addrs);
+}
+
+bool RequestState::TryResolveTargetAddressFromCache(clients::dns::Resolver& resolver) try {
+    const MaybeOwnedUrl target{proxy_url_, easy()};
+    const std::string hostname = target.Get().GetHostPtr().get();
+
+    // CURLOPT_RESOLV hostnames cannot contain colons (as IPv6 addresses do), skip
+    if (hostname.find(':') != std::string::npos) return true;
+
+    const auto addrs = resolver.ResolveCached(hostname);
+    if (!addrs) return false;
+
+    AddTargetAddress(target.Get(), hostname, *addrs);
+    return true;
+} catch (const clients::dns::ResolverException&) {
+    // ResolveTargetAddress() reports the error
+    return false;
+} catch (const BaseException&) {
+    return false;
+}
+
+void RequestState::AddTargetAddress(
+    const curl::url& target,
+    const std::string& hostname,
+    const clients::dns::AddrVector& addrs
+) {
     auto addr_strings =
         addrs | boost::adaptors::transformed([](const auto& addr) { return addr.PrimaryAddressString(); });
 
-    easy().add_resolve(hostname, target.Get().GetPortPtr().get(), fmt::to_string(fmt::join(addr_strings, ",")));
+    easy().add_resolve(hostname, target.GetPortPtr().get(), fmt::to_string(fmt::join(addr_strings, ",")));
 }
 
 void RequestState::SetTracingManager(const tracing::TracingManagerBase& m) { tracing_manager_ = m; }
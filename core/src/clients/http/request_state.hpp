@@ -8,6 +8,7 @@
 #include <system_error>
 
 #include <userver/clients/dns/resolver_fwd.hpp>
+#include <userver/clients/http/body_sink.hpp>
 #include <userver/clients/http/config.hpp>
 #include <userver/clients/http/error.hpp>
 #include <userver/clients/http/form.hpp>
@@ -28,6 +29,8 @@
 
 #include <clients/http/destination_statistics.hpp>
 #include <clients/http/easy_wrapper.hpp>
+#include <clients/http/http2_pool.hpp>
+#include <clients/http/request_coalescer.hpp>
 #include <clients/http/testsuite.hpp>
 #include <crypto/helpers.hpp>
 #include <engine/ev/watcher/timer_watcher.hpp>
@@ -38,6 +41,7 @@ namespace clients::http {
 
 class StreamedResponse;
 class ConnectTo;
+enum class HttpMethod;
 
 class RequestState : public std::enable_shared_from_this<RequestState> {
 public:
@@ -92,6 +96,14 @@ public:
     void proxy_auth_type(curl::easy::proxyauth_t value);
     /// sets proxy auth type and credentials to use
     void http_auth_type(curl::easy::httpauth_t value, bool auth_only, std::string_view user, std::string_view password);
+    /// set the method, std::nullopt for a custom one
+    void method(std::optional<HttpMethod> method);
+    /// set cookies
+    void cookies(std::string cookies);
+    /// share the in-flight request with the identical ones
+    void coalesce(bool enable);
+    /// write the response body into the sink instead of the response
+    void response_body_sink(std::shared_ptr<ResponseBodySink> sink);
 
     /// get timeout value in milliseconds
     long timeout() const { return original_timeout_.count(); }
@@ -123,6 +135,10 @@ public:
 
     void SetDeadlinePropagationConfig(const DeadlinePropagationConfig& deadline_propagation_config);
 
+    void SetRequestCoalescer(const std::shared_ptr<RequestCoalescer>& coalescer);
+
+    void SetHttp2Pool(const std::shared_ptr<Http2Pool>& http2_pool);
+
     curl::easy& easy() { return easy_.Easy(); }
     const curl::easy& easy() const { return easy_.Easy(); }
     std::shared_ptr<Response> response() const { return response_; }
@@ -166,6 +182,7 @@ private:
     std::string_view GetLoggedEffectiveUrl() noexcept;
 
     static size_t StreamWriteFunction(char* ptr, size_t size, size_t nmemb, void* userdata);
+    static size_t SinkWriteFunction(char* ptr, size_t size, size_t nmemb, void* userdata) noexcept;
 
     void AccountResponse(std::error_code err);
     std::exception_ptr PrepareException(std::error_code err);
@@ -179,6 +196,16 @@ private:
     void WithRequestStats(const Func& func);
 
     void ResolveTargetAddress(clients::dns::Resolver& resolver);
+    /// returns false if the address is not cached and has to be resolved by
+    /// ResolveTargetAddress()
+    bool TryResolveTargetAddressFromCache(clients::dns::Resolver& resolver);
+    void AddTargetAddress(const curl::url& target, const std::string& hostname, const clients::dns::AddrVector& addrs);
+
+    std::optional<std::string> MakeCoalescingKey() const;
+    void ReserveBody(std::string_view content_length) noexcept;
+    bool IsHttp2Requested() const;
+    void PlaceOntoHttp2Pool();
+    void FinishCoalescing(const std::shared_ptr<Response>& response, std::exception_ptr exception);
 
     /// curl handler wrapper
     impl::EasyWrapper easy_;
@@ -233,6 +260,20 @@ private:
     std::string proxy_url_;
     impl::PluginPipeline& plugin_pipeline_;
 
+    std::optional<HttpMethod> method_;
+    std::string cookies_;
+    bool coalesce_{false};
+    std::shared_ptr<RequestCoalescer> coalescer_;
+    /// key of the in-flight request shared with the identical ones
+    std::optional<std::string> coalescing_key_;
+
+    std::shared_ptr<ResponseBodySink> body_sink_;
+
+    curl::easy::http_version_t http_version_{curl::easy::http_version_t::http_version_none};
+    std::shared_ptr<Http2Pool> http2_pool_;
+    /// the stream of the request in the pool, held until the last attempt ends
+    Http2Pool::Lease http2_lease_;
+
     struct StreamData {
         StreamData(Queue::Producer&& queue_producer) : queue_producer(std::move(queue_producer)) {}
 
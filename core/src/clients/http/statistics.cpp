@@ -149,6 +149,8 @@ void Statistics::AccountError(ErrorGroup error) { ++error_count_[static_cast<int
 
 void Statistics::AccountStatus(int code) { reply_status_.Account(code); }
 
+Percentile Statistics::GetRecentTimings() const { return timings_percentile_.GetStatsForPeriod(); }
+
 void DumpMetric(utils::statistics::Writer& writer, const DestinationStatisticsView& view) {
     const auto& stats = view.stats;
 
@@ -96,6 +96,8 @@ public:
 
     void AccountStatus(int);
 
+    Percentile GetRecentTimings() const;
+
 private:
     std::atomic<uint64_t> easy_handles_{0};
     std::atomic<uint64_t> last_time_to_start_us_{0};
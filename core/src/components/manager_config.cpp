@@ -99,6 +99,30 @@ properties:
                 type: integer
                 description: size of a single coroutine, bytes
                 defaultDescription: 256 * 1024
+            small_stack_size:
+                type: integer
+                description: |
+                    stack size of the tasks started within
+                    engine::StackSizeScope{engine::StackSize::kSmall}, bytes;
+                    must be less than stack_size. 0 makes such tasks use
+                    stack_size. See coro-pool.size-classes.stack-usage
+                    metrics for the suggested value.
+                defaultDescription: 0
+            large_stack_size:
+                type: integer
+                description: |
+                    stack size of the tasks started within
+                    engine::StackSizeScope{engine::StackSize::kLarge}, bytes;
+                    must be greater than stack_size. 0 makes such tasks use
+                    stack_size.
+                defaultDescription: 0
+            numa_aware:
+                type: boolean
+                description: |
+                    keep separate pools of idle coroutines for each NUMA node,
+                    so that the stack memory stays local to the workers that
+                    run the coroutines. Best used with pin-worker-threads.
+                defaultDescription: false
             local_cache_size:
                 type: integer
                 description: |
@@ -121,6 +145,13 @@ properties:
                 description: >
                     number of threads to process low level IO system calls
                     (number of ev loops to start in libev)
+            io_uring:
+                type: boolean
+                description: >
+                    whether socket reads and writes that would block are
+                    submitted to a per ev thread io_uring instead of waiting
+                    for readiness via epoll (requires Linux 5.19+)
+                defaultDescription: false
     components:
         type: object
         description: 'dictionary of "component name": "options"'
@@ -162,6 +193,16 @@ properties:
                         tunes the number of spin-wait iterations in case of
                         an empty task queue before threads go to sleep
                     defaultDescription: 10000
+                adaptive-spinning:
+                    type: boolean
+                    description: |
+                        learn the spin-wait length from the recent task
+                        arrivals (spinning-iterations is the upper bound)
+                        and let only half of the idle threads spin, the
+                        rest go to sleep at once; only for
+                        `global-task-queue`; the decisions are reported in
+                        the `worker-parking` metrics of the task processor
+                    defaultDescription: false
                 task-processor-queue:
                     type: string
                     description: |
@@ -173,6 +214,28 @@ properties:
                     enum:
                       - global-task-queue
                       - work-stealing-task-queue
+                pin-worker-threads:
+                    type: boolean
+                    description: |
+                        pin each worker thread to a single CPU, placing
+                        neighbour workers on CPUs that share caches and
+                        NUMA nodes; `work-stealing-task-queue` then steals
+                        from the nearest workers first
+                    defaultDescription: false
+                task-priorities:
+                    type: boolean
+                    description: |
+                        take tasks of engine::TaskPriority::kHigh from the
+                        queue before the kNormal ones, and the kNormal ones
+                        before the kLow ones
+                    defaultDescription: false
+                deadline-scheduling:
+                    type: boolean
+                    description: |
+                        take tasks with a deadline from the queue in the
+                        earliest-deadline-first order before the other
+                        tasks; only for `global-task-queue`
+                    defaultDescription: false
                 task-trace:
                     type: object
                     description: .
@@ -1,5 +1,8 @@
 #include <userver/components/manager_controller_component.hpp>
 
+#include <array>
+#include <string_view>
+
 #include <components/manager_config.hpp>
 #include <components/manager_controller_component_config.hpp>
 #include <engine/task/task_processor.hpp>
@@ -47,6 +50,10 @@ void DumpMetric(utils::statistics::Writer& writer, const engine::TaskProcessor&
     }
 
     writer["worker-threads"] = task_processor.GetWorkerCount();
+
+    if (const auto parking_stats = task_processor.GetWorkerParkingStats()) {
+        writer["worker-parking"] = *parking_stats;
+    }
 }
 
 }  // namespace engine
@@ -103,6 +110,22 @@ void ManagerControllerComponent::WriteStatistics(utils::statistics::Writer& writ
             stack_usage_stats["max-usage-percent"] = stats.max_stack_usage_pct;
             stack_usage_stats["is-monitor-active"] = stats.is_stack_usage_monitor_active;
         }
+        constexpr std::array<std::pair<engine::StackSize, std::string_view>, engine::coro::kStackSizesCount>
+            kSizeClassNames{{
+                {engine::StackSize::kSmall, "small"},
+                {engine::StackSize::kDefault, "default"},
+                {engine::StackSize::kLarge, "large"},
+            }};
+        // Without the small and large classes all the coroutines use the default stacks,
+        // the stack-usage metrics above already cover them
+        const auto has_extra_size_classes =
+            stats.size_classes[engine::coro::ToIndex(engine::StackSize::kSmall)].stack_size != 0 ||
+            stats.size_classes[engine::coro::ToIndex(engine::StackSize::kLarge)].stack_size != 0;
+        for (const auto& [stack_size, name] : kSizeClassNames) {
+            const auto& size_class_stats = stats.size_classes[engine::coro::ToIndex(stack_size)];
+            if (!has_extra_size_classes || size_class_stats.stack_size == 0) continue;
+            coro_pool["size-classes"].ValueWithLabels(size_class_stats, {"stack_size_class", name});
+        }
     }
 
     // misc
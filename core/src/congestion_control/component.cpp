@@ -1,7 +1,12 @@
 #include <userver/congestion_control/component.hpp>
 
+#include <memory>
+#include <stdexcept>
+
 #include <congestion_control/watchdog.hpp>
+#include <server/congestion_control/latency_sensor.hpp>
 #include <userver/congestion_control/config.hpp>
+#include <userver/congestion_control/controllers/gradient.hpp>
 #include <userver/server/congestion_control/sensor.hpp>
 
 #include <userver/components/component.hpp>
@@ -56,12 +61,15 @@ struct Component::Impl {
     server::congestion_control::Sensor server_sensor;
     server::congestion_control::Limiter server_limiter;
     Controller server_controller;
+    server::congestion_control::LatencySensor latency_sensor;
+    v2::Stats gradient_stats;
 
     std::atomic<bool> fake_mode;
     std::atomic<bool> force_disabled{false};
     std::atomic<size_t> last_activate_factor{1};
 
     // These subscriptions and tasks must be the last fields!
+    std::unique_ptr<v2::GradientController> gradient_controller;
     Watchdog wd;
     utils::statistics::Entry statistics_holder;
     concurrent::AsyncEventSubscriberScope config_subscription;
@@ -72,6 +80,7 @@ struct Component::Impl {
           server(server),
           server_sensor(tp),
           server_controller(kServerControllerName, dynamic_config),
+          latency_sensor(server, tp),
           fake_mode(fake_mode) {
         server_limiter.RegisterLimitee(server);
         server_sensor.RegisterRequestsSource(server);
@@ -114,9 +123,24 @@ Component::Component(const components::ComponentConfig& config, const components
                          "is enforced";
     }
 
-    pimpl_->wd.Register({pimpl_->server_sensor, pimpl_->server_limiter, pimpl_->server_controller});
+    const auto algorithm = config["algorithm"].As<std::string>("tasks-overload");
+    if (algorithm == "gradient") {
+        pimpl_->gradient_controller = std::make_unique<v2::GradientController>(
+            kServerControllerName,
+            pimpl_->latency_sensor,
+            pimpl_->server_limiter,
+            pimpl_->gradient_stats,
+            v2::GradientController::StaticConfig{pimpl_->fake_mode.load(), true},
+            config["gradient"].As<v2::GradientConfig>(v2::GradientConfig{})
+        );
+    } else if (algorithm == "tasks-overload") {
+        pimpl_->wd.Register({pimpl_->server_sensor, pimpl_->server_limiter, pimpl_->server_controller});
+    } else {
+        throw std::runtime_error(fmt::format("Unknown congestion control algorithm '{}'", algorithm));
+    }
 
     pimpl_->config_subscription = pimpl_->dynamic_config.UpdateAndListen(this, kName, &Component::OnConfigUpdate);
+    if (pimpl_->gradient_controller) pimpl_->gradient_controller->Start();
 
     auto& storage = context.FindComponent<components::StatisticsStorage>().GetStorage();
     pimpl_->statistics_holder =
@@ -140,6 +164,7 @@ void Component::OnConfigUpdate(const dynamic_config::Snapshot& cfg) {
         enabled = false;
     }
     pimpl_->server_controller.SetEnabled(enabled);
+    if (pimpl_->gradient_controller) pimpl_->gradient_controller->SetEnabled(enabled);
 }
 
 void Component::OnAllComponentsLoaded() {
@@ -154,12 +179,19 @@ void Component::OnAllComponentsLoaded() {
     }
 }
 
-void Component::OnAllComponentsAreStopping() { pimpl_->wd.Stop(); }
+void Component::OnAllComponentsAreStopping() {
+    if (pimpl_->gradient_controller) pimpl_->gradient_controller->Stop();
+    pimpl_->wd.Stop();
+}
 
 void Component::ExtendWriter(utils::statistics::Writer& writer) {
     if (!pimpl_->force_disabled) {
         auto rps = writer["rps"];
-        FormatStats(pimpl_->server_controller, pimpl_->last_activate_factor, rps);
+        if (pimpl_->gradient_controller) {
+            rps = pimpl_->gradient_stats;
+        } else {
+            FormatStats(pimpl_->server_controller, pimpl_->last_activate_factor, rps);
+        }
     }
 }
 
@@ -168,7 +200,7 @@ server::congestion_control::Limiter& Component::GetServerLimiter() { return pimp
 server::congestion_control::Sensor& Component::GetServerSensor() { return pimpl_->server_sensor; }
 
 yaml_config::Schema Component::GetStaticConfigSchema() {
-    return yaml_config::MergeSchemas<components::ComponentBase>(R"(
+    auto schema = yaml_config::MergeSchemas<components::ComponentBase>(R"(
 type: object
 description: Component to limit too active requests, also known as CC.
 additionalProperties: false
@@ -189,7 +221,16 @@ properties:
         type: integer
         description: HTTP status code for ratelimited responses
         defaultDescription: 429
+    algorithm:
+        type: string
+        description: RPS is limited on the main task processor overloads with `tasks-overload` and on the timings growth with `gradient`
+        defaultDescription: tasks-overload
+        enum:
+          - tasks-overload
+          - gradient
 )");
+    schema.properties->emplace("gradient", yaml_config::SchemaPtr{v2::GetGradientConfigSchema()});
+    return schema;
 }
 
 }  // namespace congestion_control
@@ -0,0 +1,71 @@
+#include <userver/congestion_control/controllers/factory.hpp>
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+StaticConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<StaticConfig>) {
+    StaticConfig config;
+    config.fake_mode = value["fake-mode"].As<bool>(false);
+    config.enabled = value["enabled"].As<bool>(true);
+
+    const auto algorithm = value["algorithm"].As<std::string>("linear");
+    if (algorithm == "gradient") {
+        config.gradient = value["gradient"].As<GradientConfig>(GradientConfig{});
+    } else if (algorithm != "linear") {
+        throw std::runtime_error(fmt::format("Unknown congestion control algorithm '{}'", algorithm));
+    }
+    return config;
+}
+
+yaml_config::Schema GetStaticConfigSchema() {
+    auto schema = yaml_config::impl::SchemaFromString(R"(
+type: object
+description: congestion control settings
+additionalProperties: false
+properties:
+    fake-mode:
+        type: boolean
+        description: whether CC limiter is actually working
+        defaultDescription: false
+    enabled:
+        type: boolean
+        description: whether CC is enabled for the database
+        defaultDescription: true
+    algorithm:
+        type: string
+        description: congestion control algorithm, `gradient` limits the load once the timings grow
+        defaultDescription: linear
+        enum:
+          - linear
+          - gradient
+)");
+    schema.properties->emplace("gradient", yaml_config::SchemaPtr{GetGradientConfigSchema()});
+    return schema;
+}
+
+std::unique_ptr<Controller> MakeController(
+    const std::string& name,
+    v2::Sensor& sensor,
+    Limiter& limiter,
+    Stats& stats,
+    const StaticConfig& config,
+    dynamic_config::Source config_source,
+    std::function<v2::Config(const dynamic_config::Snapshot&)> linear_config_getter
+) {
+    const Controller::Config controller_config{config.fake_mode, config.enabled};
+    if (config.gradient) {
+        return std::make_unique<GradientController>(name, sensor, limiter, stats, controller_config, *config.gradient);
+    }
+    return std::make_unique<LinearController>(
+        name, sensor, limiter, stats, controller_config, config_source, std::move(linear_config_getter)
+    );
+}
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,176 @@
+#include <userver/congestion_control/controllers/gradient.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include <userver/logging/log.hpp>
+#include <userver/yaml_config/yaml_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace congestion_control::v2 {
+
+namespace {
+
+// No-load timings are averaged over the first epochs before any limiting
+constexpr std::size_t kWarmupEpochs = 10;
+constexpr double kMinGradient = 0.5;
+// Sensors report whole milliseconds
+constexpr double kMinTimingsMs = 1.0;
+// After a long overload the timings drop far below the long-term average, it
+// is brought down faster than the averaging alone would do
+constexpr double kLongTimingsDriftRatio = 2.0;
+constexpr double kLongTimingsDecay = 0.95;
+
+}  // namespace
+
+GradientConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<GradientConfig>) {
+    GradientConfig config;
+    config.min_limit = value["min-limit"].As<std::size_t>(config.min_limit);
+    config.max_limit = value["max-limit"].As<std::optional<std::size_t>>();
+    config.rtt_tolerance = value["rtt-tolerance"].As<double>(config.rtt_tolerance);
+    config.smoothing = value["smoothing"].As<double>(config.smoothing);
+    config.long_window_epochs = value["long-window-epochs"].As<std::size_t>(config.long_window_epochs);
+    config.errors_threshold_percent = value["errors-threshold-percent"].As<double>(config.errors_threshold_percent);
+    config.min_qps = value["min-qps"].As<std::size_t>(config.min_qps);
+
+    if (config.rtt_tolerance < 1.0) {
+        throw std::runtime_error("Gradient congestion control 'rtt-tolerance' must be at least 1");
+    }
+    if (config.smoothing <= 0.0 || config.smoothing > 1.0) {
+        throw std::runtime_error("Gradient congestion control 'smoothing' must be in (0, 1]");
+    }
+    if (config.long_window_epochs == 0) {
+        throw std::runtime_error("Gradient congestion control 'long-window-epochs' must be positive");
+    }
+    if (config.max_limit && *config.max_limit < config.min_limit) {
+        throw std::runtime_error("Gradient congestion control 'max-limit' is less than 'min-limit'");
+    }
+    return config;
+}
+
+yaml_config::Schema GetGradientConfigSchema() {
+    return yaml_config::impl::SchemaFromString(R"(
+type: object
+description: settings of the `gradient` algorithm
+additionalProperties: false
+properties:
+    min-limit:
+        type: integer
+        description: minimal limit
+        defaultDescription: 10
+    max-limit:
+        type: integer
+        description: maximal limit
+        defaultDescription: unlimited
+    rtt-tolerance:
+        type: number
+        description: timings growth ratio that is not considered an overload
+        defaultDescription: 1.5
+    smoothing:
+        type: number
+        description: share of the new limit estimate applied each second
+        defaultDescription: 0.2
+    long-window-epochs:
+        type: integer
+        description: number of seconds the no-load timings are averaged over
+        defaultDescription: 60
+    errors-threshold-percent:
+        type: number
+        description: percent of timeouts that is considered an overload
+        defaultDescription: 5
+    min-qps:
+        type: integer
+        description: the limit is not changed while there are fewer requests per second
+        defaultDescription: 10
+)");
+}
+
+GradientController::GradientController(
+    const std::string& name,
+    v2::Sensor& sensor,
+    Limiter& limiter,
+    Stats& stats,
+    const StaticConfig& config,
+    const GradientConfig& gradient_config
+)
+    : Controller(name, sensor, limiter, stats, config), stats_(stats), config_(gradient_config) {
+    stats_.has_gradient = true;
+}
+
+Limit GradientController::Update(const Sensor::Data& current) {
+    const auto current_load = static_cast<double>(current.current_load);
+
+    if (current.total < config_.min_qps) {
+        // Too little QPS, timings avg data is VERY noisy
+        return MakeLimit(current);
+    }
+
+    const double short_timings_ms = std::max(static_cast<double>(current.timings_avg_ms), kMinTimingsMs);
+    stats_.short_timings_ms = short_timings_ms;
+
+    if (epochs_passed_ < kWarmupEpochs) {
+        epochs_passed_++;
+        long_timings_ms_ += (short_timings_ms - long_timings_ms_) / epochs_passed_;
+        limit_ = std::max(limit_, current_load);
+
+        stats_.long_timings_ms = long_timings_ms_;
+        stats_.estimated_limit = static_cast<std::int64_t>(limit_);
+        return {std::nullopt, current.current_load};
+    }
+
+    long_timings_ms_ += (short_timings_ms - long_timings_ms_) / config_.long_window_epochs;
+    if (long_timings_ms_ > kLongTimingsDriftRatio * short_timings_ms) long_timings_ms_ *= kLongTimingsDecay;
+
+    double gradient = std::clamp(config_.rtt_tolerance * long_timings_ms_ / short_timings_ms, kMinGradient, 1.0);
+    if (100 * current.GetRate() > config_.errors_threshold_percent) gradient = kMinGradient;
+    const bool overloaded = gradient < 1.0;
+
+    if (overloaded && !is_active_) {
+        LOG_ERROR() << GetName() << " Congestion Control is activated";
+        is_active_ = true;
+        // A limit above the load would not hold it back
+        limit_ = std::min(limit_, current_load);
+    }
+
+    const double queue_size = GetQueueSize();
+    // A limit far above the load is not probed by it, so it is not grown
+    const bool is_app_limited = current_load < limit_ / 2;
+    if (overloaded || !is_app_limited) {
+        const double new_limit = limit_ * gradient + queue_size;
+        limit_ = limit_ * (1 - config_.smoothing) + new_limit * config_.smoothing;
+    }
+
+    if (!overloaded && is_active_ && limit_ > current_load + queue_size) {
+        LOG_ERROR() << GetName() << " Congestion Control is deactivated";
+        is_active_ = false;
+    }
+
+    // While the limit is not enforced it must not lag behind the load
+    if (!is_active_) limit_ = std::max(limit_, current_load);
+
+    const auto max_limit = config_.max_limit.value_or(std::numeric_limits<std::size_t>::max());
+    limit_ = std::clamp(limit_, static_cast<double>(config_.min_limit), static_cast<double>(max_limit));
+
+    LOG_DEBUG() << "CC gradient " << GetName() << ": sensor=(" << current.ToLogString()
+                << ") long_timings_ms=" << long_timings_ms_ << " gradient=" << gradient << " limit=" << limit_;
+
+    stats_.long_timings_ms = long_timings_ms_;
+    stats_.gradient = gradient;
+    stats_.estimated_limit = static_cast<std::int64_t>(limit_);
+
+    return MakeLimit(current);
+}
+
+Limit GradientController::MakeLimit(const Sensor::Data& current) const {
+    if (!is_active_) return {std::nullopt, current.current_load};
+    return {static_cast<std::size_t>(limit_), current.current_load};
+}
+
+double GradientController::GetQueueSize() const { return std::max(1.0, std::sqrt(limit_)); }
+
+}  // namespace congestion_control::v2
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,148 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/congestion_control/controllers/factory.hpp>
+#include <userver/congestion_control/controllers/gradient.hpp>
+#include <userver/formats/yaml/serialize.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+class FakeSensor : public congestion_control::v2::Sensor {
+    Data GetCurrent() override { return {}; }
+};
+
+class FakeLimiter : public congestion_control::Limiter {
+    void SetLimit(const congestion_control::Limit&) override {}
+};
+
+congestion_control::v2::Sensor::Data MakeData(std::size_t timings_avg_ms, std::size_t current_load) {
+    congestion_control::v2::Sensor::Data data;
+    data.total = 1000;
+    data.timings_avg_ms = timings_avg_ms;
+    data.current_load = current_load;
+    return data;
+}
+
+}  // namespace
+
+class CCGradient : public ::testing::Test {
+protected:
+    congestion_control::v2::GradientController MakeController(const congestion_control::v2::GradientConfig& config = {}
+    ) {
+        return congestion_control::v2::GradientController("test", sensor_, limiter_, stats_, {}, config);
+    }
+
+    congestion_control::v2::Stats stats_;
+
+private:
+    FakeSensor sensor_;
+    FakeLimiter limiter_;
+};
+
+TEST_F(CCGradient, Zero) {
+    auto controller = MakeController();
+
+    for (size_t i = 0; i < 1000; i++) {
+        auto limit = controller.Update({});
+        EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+    }
+}
+
+TEST_F(CCGradient, StableTimings) {
+    auto controller = MakeController();
+
+    for (size_t i = 0; i < 1000; i++) {
+        auto limit = controller.Update(MakeData(100, 50 + i % 10));
+        EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+    }
+    EXPECT_GE(stats_.estimated_limit.load(), 59);
+    EXPECT_DOUBLE_EQ(stats_.gradient.load(), 1.0);
+}
+
+TEST_F(CCGradient, TimingsGrowth) {
+    auto controller = MakeController();
+
+    for (size_t i = 0; i < 100; i++) {
+        auto limit = controller.Update(MakeData(100, 200));
+        EXPECT_EQ(limit.load_limit, std::nullopt) << i;
+    }
+
+    // Overload, the limit goes down while the timings are high
+    std::size_t last_limit = 200;
+    for (size_t i = 0; i < 10; i++) {
+        auto limit = controller.Update(MakeData(1000, 200));
+        ASSERT_NE(limit.load_limit, std::nullopt) << i;
+        EXPECT_LT(*limit.load_limit, last_limit) << i;
+        last_limit = *limit.load_limit;
+    }
+    EXPECT_LT(stats_.gradient.load(), 1.0);
+
+    // The limit is probed up while it holds the timings down
+    for (size_t i = 0; i < 10; i++) {
+        auto limit = controller.Update(MakeData(100, last_limit));
+        ASSERT_NE(limit.load_limit, std::nullopt) << i;
+        EXPECT_GE(*limit.load_limit, last_limit) << i;
+        last_limit = *limit.load_limit;
+    }
+
+    // The load no longer reaches the limit
+    auto limit = controller.Update(MakeData(100, 10));
+    EXPECT_EQ(limit.load_limit, std::nullopt);
+}
+
+TEST_F(CCGradient, Timeouts) {
+    auto controller = MakeController();
+
+    for (size_t i = 0; i < 100; i++) {
+        controller.Update(MakeData(100, 200));
+    }
+
+    auto data = MakeData(100, 200);
+    data.timeouts = 100;
+    auto limit = controller.Update(data);
+    ASSERT_NE(limit.load_limit, std::nullopt);
+    EXPECT_LT(*limit.load_limit, 200);
+    EXPECT_DOUBLE_EQ(stats_.gradient.load(), 0.5);
+}
+
+TEST_F(CCGradient, MinMax) {
+    congestion_control::v2::GradientConfig config;
+    config.min_limit = 50;
+    config.max_limit = 100;
+    auto controller = MakeController(config);
+
+    for (size_t i = 0; i < 100; i++) {
+        controller.Update(MakeData(10, 500));
+    }
+    EXPECT_EQ(stats_.estimated_limit.load(), 100);
+
+    for (size_t i = 0; i < 20; i++) {
+        auto limit = controller.Update(MakeData(10000, 500));
+        ASSERT_NE(limit.load_limit, std::nullopt) << i;
+        EXPECT_GE(*limit.load_limit, 50) << i;
+    }
+    EXPECT_EQ(stats_.estimated_limit.load(), 50);
+}
+
+TEST_F(CCGradient, FactoryConfig) {
+    const auto yaml = formats::yaml::FromString(R"(
+fake-mode: true
+algorithm: gradient
+gradient:
+    min-limit: 5
+    rtt-tolerance: 2
+)");
+    const auto config = yaml_config::YamlConfig(yaml, {}).As<congestion_control::v2::StaticConfig>();
+    EXPECT_TRUE(config.fake_mode);
+    ASSERT_TRUE(config.gradient);
+    EXPECT_EQ(config.gradient->min_limit, 5);
+    EXPECT_DOUBLE_EQ(config.gradient->rtt_tolerance, 2);
+
+    const auto linear_yaml = formats::yaml::FromString("enabled: false");
+    const auto linear_config = yaml_config::YamlConfig(linear_yaml, {}).As<congestion_control::v2::StaticConfig>();
+    EXPECT_FALSE(linear_config.enabled);
+    EXPECT_FALSE(linear_config.gradient);
+}
+
+USERVER_NAMESPACE_END
@@ -16,6 +16,14 @@ void DumpMetric(utils::statistics::Writer& writer, const Stats& stats) {
     writer["is-fake-mode"] = stats.is_fake_mode ? 1 : 0;
     if (stats.current_limit) writer["current-limit"] = stats.current_limit;
     writer["enabled-seconds"] = stats.enabled_epochs;
+
+    if (stats.has_gradient) {
+        auto gradient = writer["gradient"];
+        gradient["estimated-limit"] = stats.estimated_limit;
+        gradient["short-timings-ms"] = stats.short_timings_ms;
+        gradient["long-timings-ms"] = stats.long_timings_ms;
+        gradient["gradient"] = stats.gradient;
+    }
 }
 
 Controller::Controller(const std::string& name, Sensor& sensor, Limiter& limiter, Stats& stats, const Config& config)
@@ -136,6 +136,11 @@ std::shared_ptr<easy> easy::GetBoundBlocking(multi& multi_handle) const {
     return std::make_shared<easy>(cloned, &multi_handle);
 }
 
+void easy::Rebind(multi& multi_handle) {
+    UASSERT(!multi_registered_);
+    multi_ = &multi_handle;
+}
+
 easy* easy::from_native(native::CURL* native_easy) {
     easy* easy_handle = nullptr;
     native::curl_easy_getinfo(native_easy, native::CURLINFO_PRIVATE, &easy_handle);
@@ -412,6 +417,17 @@ std::optional<std::string_view> easy::FindHeaderByName(std::string_view name) co
     return FindHeaderByNameImpl(headers_, name);
 }
 
+std::string easy::GetHeadersString() const {
+    std::string result;
+    if (headers_) {
+        headers_->ForEach([&result](std::string_view header) {
+            result.append(header);
+            result.append("\r\n");
+        });
+    }
+    return result;
+}
+
 void easy::add_header(const char* header) {
     std::error_code ec;
     add_header(header, ec);
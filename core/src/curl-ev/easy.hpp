@@ -215,6 +215,8 @@ public:
     std::shared_ptr<easy> GetBoundBlocking(multi&) const;
 
     const multi* GetMulti() const { return multi_; }
+    // Moves an easy that is not performing to another multi
+    void Rebind(multi& multi_handle);
 
     inline native::CURL* native_handle() { return handle_; }
     engine::ev::ThreadControl& GetThreadControl();
@@ -431,6 +433,8 @@ public:
     void set_headers(std::shared_ptr<string_list> headers);
     void set_headers(std::shared_ptr<string_list> headers, std::error_code& ec);
     std::optional<std::string_view> FindHeaderByName(std::string_view name) const;
+    /// Request headers separated by "\r\n"
+    std::string GetHeadersString() const;
     void add_proxy_header(
         std::string_view name,
         std::string_view value,
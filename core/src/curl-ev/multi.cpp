@@ -38,6 +38,10 @@ const char* GetSetterName(native::CURLMoption option) {
             return "SetMaxHostConnections";
         case native::CURLMOPT_MAXCONNECTS:
             return "SetConnectionCacheSize";
+#if LIBCURL_VERSION_NUM >= 0x074300
+        case native::CURLMOPT_MAX_CONCURRENT_STREAMS:
+            return "SetMaxConcurrentStreams";
+#endif
         default:
             return "<unknown setter>";
     }
@@ -141,6 +145,14 @@ void multi::SetMaxHostConnections(long value) { SetOptionAsync(native::CURLMOPT_
 
 void multi::SetConnectionCacheSize(long value) { SetOptionAsync(native::CURLMOPT_MAXCONNECTS, value); }
 
+void multi::SetMaxConcurrentStreams([[maybe_unused]] long value) {
+#if LIBCURL_VERSION_NUM >= 0x074300
+    SetOptionAsync(native::CURLMOPT_MAX_CONCURRENT_STREAMS, value);
+#else
+    LOG_WARNING() << "SetMaxConcurrentStreams requires libcurl 7.67.0 or newer, ignored";
+#endif
+}
+
 void multi::add_handle(native::CURL* native_easy) {
     std::error_code ec{static_cast<errc::MultiErrorCode>(native::curl_multi_add_handle(handle_, native_easy))};
     throw_error(ec, "add_handle");
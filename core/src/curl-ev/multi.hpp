@@ -56,6 +56,7 @@ public:
     void SetMultiplexingEnabled(bool);
     void SetMaxHostConnections(long);
     void SetConnectionCacheSize(long);
+    void SetMaxConcurrentStreams(long);
 
 private:
     void add_handle(native::CURL* native_easy);
@@ -47,6 +47,11 @@ public:
         return std::nullopt;
     }
 
+    template <typename Func>
+    void ForEach(const Func& func) const {
+        for (const auto& list_elem : list_elements_) func(std::string_view{list_elem.value});
+    }
+
     template <typename Pred>
     bool ReplaceFirstIf(const Pred& pred, std::string&& new_value) {
         for (auto& list_elem : list_elements_) {
@@ -6,37 +6,84 @@
 
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
+#include <userver/utils/atomic.hpp>
+#include <userver/utils/statistics/writer.hpp>
 
+#include <engine/task/cpu_topology.hpp>
 #include <utils/sys_info.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+namespace {
+
+constexpr std::array<StackSize, kStackSizesCount> kStackSizes{StackSize::kSmall, StackSize::kDefault, StackSize::kLarge};
+
+std::size_t RoundUpToPageSize(std::size_t size) {
+    const auto page_size = utils::sys_info::GetPageSize();
+    return (size + page_size - 1) & ~(page_size - 1);
+}
+
+std::size_t GetConfiguredStackSize(const PoolConfig& config, StackSize stack_size) {
+    switch (stack_size) {
+        case StackSize::kSmall:
+            return config.small_stack_size;
+        case StackSize::kDefault:
+            return config.stack_size;
+        case StackSize::kLarge:
+            return config.large_stack_size;
+    }
+    UINVARIANT(false, "Unexpected stack size class");
+}
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer, const StackSizeClassStats& stats) {
+    writer["stack-size"] = stats.stack_size;
+    if (auto coro_stats = writer["coroutines"]) {
+        coro_stats["active"] = stats.active_coroutines;
+        coro_stats["total"] = stats.total_coroutines;
+    }
+    if (auto stack_usage_stats = writer["stack-usage"]) {
+        stack_usage_stats["max-usage-percent"] = stats.max_stack_usage_pct;
+        stack_usage_stats["suggested-stack-size"] = stats.suggested_stack_size;
+    }
+}
+
+Pool::SizeClass::SizeClass(std::size_t stack_size, std::size_t nodes_count, std::size_t max_size)
+    : stack_size(stack_size), stack_allocator(stack_size), used_coroutines(nodes_count, max_size) {}
+
 Pool::Pool(PoolConfig config, Executor executor)
     : config_(FixupConfig(std::move(config))),
       executor_(executor),
       local_coroutine_move_size_((config_.local_cache_size + 1) / 2),
-      stack_allocator_(config_.stack_size),
-      stack_usage_monitor_(config_.stack_size),
-      initial_coroutines_(config_.initial_size),
-      used_coroutines_(config_.max_size),
-      idle_coroutines_num_(config_.initial_size),
-      total_coroutines_num_(0) {
+      nodes_count_(config_.numa_aware ? impl::CpuTopology::Get().GetNodesCount() : 1),
+      initial_coroutines_(config_.initial_size) {
     UASSERT(local_coroutine_move_size_ <= config_.local_cache_size);
+
+    for (const auto stack_size : kStackSizes) {
+        const auto configured_stack_size = GetConfiguredStackSize(config_, stack_size);
+        if (configured_stack_size == 0) continue;
+        size_classes_[ToIndex(stack_size)] =
+            std::make_unique<SizeClass>(configured_stack_size, nodes_count_, config_.max_size);
+    }
+
     moodycamel::ProducerToken token(initial_coroutines_);
 
     stack_usage_monitor_.Start();
 
+    auto& default_class = GetSizeClass(StackSize::kDefault);
     for (std::size_t i = 0; i < config_.initial_size; ++i) {
-        bool ok = initial_coroutines_.enqueue(token, CreateCoroutine(/*quiet =*/true));
+        bool ok = initial_coroutines_.enqueue(token, CreateCoroutine(default_class, /*quiet =*/true));
         UINVARIANT(ok, "Failed to allocate the initial coro pool");
     }
+    default_class.idle_coroutines_num = config_.initial_size;
 }
 
 Pool::~Pool() = default;
 
-typename Pool::CoroutinePtr Pool::GetCoroutine() {
+typename Pool::CoroutinePtr Pool::GetCoroutine(StackSize stack_size) {
     struct CoroutineMover {
         std::optional<Coroutine>& result;
 
@@ -48,84 +95,124 @@ typename Pool::CoroutinePtr Pool::GetCoroutine() {
     std::optional<Coroutine> coroutine;
     CoroutineMover mover{coroutine};
 
+    stack_size = Resolve(stack_size);
+    auto& size_class = GetSizeClass(stack_size);
+    auto& buffer = local_cache_.buffers[ToIndex(stack_size)];
+
     // First try to dequeue from 'working set': if we can get a coroutine
     // from there we are happy, because we saved on minor-page-faulting (thus
     // increasing resident memory usage) a not-yet-de-virtualized coroutine stack.
-    if (!local_coro_buffer_.empty() || TryPopulateLocalCache()) {
-        coroutine = std::move(local_coro_buffer_.back());
-        local_coro_buffer_.pop_back();
-    } else if (initial_coroutines_.try_dequeue(mover)) {
-        --idle_coroutines_num_;
+    if (!buffer.empty() || TryPopulateLocalCache(stack_size)) {
+        coroutine = std::move(buffer.back());
+        buffer.pop_back();
+    } else if (stack_size == StackSize::kDefault && initial_coroutines_.try_dequeue(mover)) {
+        --size_class.idle_coroutines_num;
+    } else if (TryDequeueUsed(stack_size, mover)) {
+        // Reusing a stack of a remote node is still better than growing RSS
+        --size_class.idle_coroutines_num;
     } else {
-        coroutine.emplace(CreateCoroutine());
+        coroutine.emplace(CreateCoroutine(size_class));
     }
 
-    return CoroutinePtr(std::move(*coroutine), *this);
+    return CoroutinePtr(std::move(*coroutine), *this, stack_size);
 }
 
 void Pool::PutCoroutine(CoroutinePtr&& coroutine_ptr) {
+    const auto stack_size = coroutine_ptr.GetStackSize();
+    auto& size_class = GetSizeClass(stack_size);
+
     if (config_.local_cache_size == 0) {
         const bool ok =
             // We only ever return coroutines into our 'working set'.
-            used_coroutines_.enqueue(GetUsedPoolToken<moodycamel::ProducerToken>(), std::move(coroutine_ptr.Get()));
+            size_class.used_coroutines[local_cache_.node].enqueue(
+                GetUsedPoolToken<moodycamel::ProducerToken>(stack_size), std::move(coroutine_ptr.Get())
+            );
         if (ok) {
-            ++idle_coroutines_num_;
+            ++size_class.idle_coroutines_num;
         }
         return;
     }
 
-    if (local_coro_buffer_.size() >= config_.local_cache_size) {
-        DepopulateLocalCache();
+    auto& buffer = local_cache_.buffers[ToIndex(stack_size)];
+    if (buffer.size() >= config_.local_cache_size) {
+        DepopulateLocalCache(stack_size);
     }
 
-    local_coro_buffer_.push_back(std::move(coroutine_ptr.Get()));
+    buffer.push_back(std::move(coroutine_ptr.Get()));
 }
 
 PoolStats Pool::GetStats() const {
     PoolStats stats;
-    stats.active_coroutines =
-        total_coroutines_num_.load() - (used_coroutines_.size_approx() + initial_coroutines_.size_approx());
-    stats.total_coroutines = std::max(total_coroutines_num_.load(), stats.active_coroutines);
+    for (const auto stack_size : kStackSizes) {
+        if (!size_classes_[ToIndex(stack_size)]) continue;
+        const auto& size_class = GetSizeClass(stack_size);
+
+        std::size_t idle_coroutines = 0;
+        for (const auto& queue : size_class.used_coroutines) idle_coroutines += queue.size_approx();
+        if (stack_size == StackSize::kDefault) idle_coroutines += initial_coroutines_.size_approx();
+
+        auto& class_stats = stats.size_classes[ToIndex(stack_size)];
+        const auto total_coroutines = size_class.total_coroutines_num.load();
+        class_stats.stack_size = size_class.stack_size;
+        class_stats.active_coroutines = total_coroutines - idle_coroutines;
+        class_stats.total_coroutines = std::max(total_coroutines, class_stats.active_coroutines);
+        class_stats.max_stack_usage_pct = size_class.max_stack_usage_pct.load();
+        if (stack_usage_monitor_.IsActive()) {
+            class_stats.suggested_stack_size = SuggestStackSize(size_class.stack_size, class_stats.max_stack_usage_pct);
+        }
+
+        stats.active_coroutines += class_stats.active_coroutines;
+        stats.total_coroutines += class_stats.total_coroutines;
+    }
     stats.max_stack_usage_pct = stack_usage_monitor_.GetMaxStackUsagePct();
     stats.is_stack_usage_monitor_active = stack_usage_monitor_.IsActive();
     return stats;
 }
 
-void Pool::PrepareLocalCache() { local_coro_buffer_.reserve(config_.local_cache_size); }
+void Pool::PrepareLocalCache() {
+    // Worker threads are expected to be pinned to CPUs for the node to stay
+    // the same, otherwise the stacks drift to the nodes the threads migrate to
+    local_cache_.node = config_.numa_aware ? impl::CpuTopology::Get().GetCurrentNode() : 0;
+    UASSERT(local_cache_.node < nodes_count_);
+
+    for (const auto stack_size : kStackSizes) {
+        if (!size_classes_[ToIndex(stack_size)]) continue;
+        local_cache_.buffers[ToIndex(stack_size)].reserve(config_.local_cache_size);
+    }
+}
 
 void Pool::ClearLocalCache() {
-    const std::size_t current_idle_coroutines_num = idle_coroutines_num_.load();
+    for (const auto stack_size : kStackSizes) {
+        if (!size_classes_[ToIndex(stack_size)]) continue;
+        ClearLocalCache(stack_size);
+    }
+}
+
+void Pool::ClearLocalCache(StackSize stack_size) {
+    auto& size_class = GetSizeClass(stack_size);
+    auto& buffer = local_cache_.buffers[ToIndex(stack_size)];
+    const std::size_t current_idle_coroutines_num = size_class.idle_coroutines_num.load();
     std::size_t return_to_pool_from_local_cache_num = 0;
 
     if (current_idle_coroutines_num < config_.max_size) {
         return_to_pool_from_local_cache_num =
-            std::min(config_.max_size - current_idle_coroutines_num, local_coro_buffer_.size());
-
-        const bool ok = used_coroutines_.enqueue_bulk(
-            GetUsedPoolToken<moodycamel::ProducerToken>(),
-            std::make_move_iterator(local_coro_buffer_.begin()),
-            return_to_pool_from_local_cache_num
-        );
-        if (ok) {
-            idle_coroutines_num_.fetch_add(return_to_pool_from_local_cache_num);
-        } else {
-            return_to_pool_from_local_cache_num = 0;
-        }
+            EnqueueUsed(stack_size, std::min(config_.max_size - current_idle_coroutines_num, buffer.size()));
     }
 
-    total_coroutines_num_ -= local_coro_buffer_.size() - return_to_pool_from_local_cache_num;
-    local_coro_buffer_.clear();
+    size_class.total_coroutines_num -= buffer.size() - return_to_pool_from_local_cache_num;
+    buffer.clear();
 }
 
-Pool::Coroutine Pool::CreateCoroutine(bool quiet) {
+Pool::Coroutine Pool::CreateCoroutine(SizeClass& size_class, bool quiet) {
     try {
-        Coroutine coroutine(stack_allocator_, executor_);
-        const auto new_total = ++total_coroutines_num_;
+        Coroutine coroutine(size_class.stack_allocator, executor_);
+        const auto new_total = ++size_class.total_coroutines_num;
         if (!quiet) {
-            LOG_DEBUG() << "Created a coroutine #" << new_total << '/' << config_.max_size;
+            LOG_DEBUG() << "Created a coroutine #" << new_total << '/' << config_.max_size << " with a stack of "
+                        << size_class.stack_size << " bytes";
         }
 
-        stack_usage_monitor_.Register(coroutine);
+        stack_usage_monitor_.Register(coroutine, size_class.stack_size);
 
         return coroutine;
     } catch (const std::bad_alloc&) {
@@ -137,79 +224,131 @@ Pool::Coroutine Pool::CreateCoroutine(bool quiet) {
             // boost/context/posix/protected_fixedsize_stack.hpp
             LOG_ERROR() << "Failed to allocate a coroutine (ENOMEM), current "
                            "coroutines count: "
-                        << total_coroutines_num_.load() << "; are you hitting the vm.max_map_count limit?";
+                        << size_class.total_coroutines_num.load() << "; are you hitting the vm.max_map_count limit?";
         }
 
         throw;
     }
 }
 
-void Pool::OnCoroutineDestruction() noexcept { --total_coroutines_num_; }
+void Pool::OnCoroutineDestruction(StackSize stack_size) noexcept {
+    --GetSizeClass(stack_size).total_coroutines_num;
+}
 
-bool Pool::TryPopulateLocalCache() {
+bool Pool::TryPopulateLocalCache(StackSize stack_size) {
     if (local_coroutine_move_size_ == 0) return false;
 
-    const std::size_t dequeued_num = used_coroutines_.try_dequeue_bulk(
-        GetUsedPoolToken<moodycamel::ConsumerToken>(),
-        std::back_inserter(local_coro_buffer_),
+    auto& size_class = GetSizeClass(stack_size);
+    const std::size_t dequeued_num = size_class.used_coroutines[local_cache_.node].try_dequeue_bulk(
+        GetUsedPoolToken<moodycamel::ConsumerToken>(stack_size),
+        std::back_inserter(local_cache_.buffers[ToIndex(stack_size)]),
         local_coroutine_move_size_
     );
     if (dequeued_num == 0) return false;
 
-    idle_coroutines_num_.fetch_sub(dequeued_num);
+    size_class.idle_coroutines_num.fetch_sub(dequeued_num);
     return true;
 }
 
-void Pool::DepopulateLocalCache() {
-    const std::size_t current_idle_coroutines_num = idle_coroutines_num_.load();
+void Pool::DepopulateLocalCache(StackSize stack_size) {
+    auto& size_class = GetSizeClass(stack_size);
+    auto& buffer = local_cache_.buffers[ToIndex(stack_size)];
+    const std::size_t current_idle_coroutines_num = size_class.idle_coroutines_num.load();
     std::size_t return_to_pool_from_local_cache_num = 0;
 
     if (current_idle_coroutines_num < config_.max_size) {
-        return_to_pool_from_local_cache_num =
-            std::min(config_.max_size - current_idle_coroutines_num, local_coroutine_move_size_);
-
-        const bool ok = used_coroutines_.enqueue_bulk(
-            GetUsedPoolToken<moodycamel::ProducerToken>(),
-            std::make_move_iterator(local_coro_buffer_.end() - return_to_pool_from_local_cache_num),
-            return_to_pool_from_local_cache_num
+        return_to_pool_from_local_cache_num = EnqueueUsed(
+            stack_size, std::min(config_.max_size - current_idle_coroutines_num, local_coroutine_move_size_)
         );
-        if (ok) {
-            idle_coroutines_num_.fetch_add(return_to_pool_from_local_cache_num);
-        } else {
-            return_to_pool_from_local_cache_num = 0;
-        }
     }
 
-    total_coroutines_num_ -= local_coroutine_move_size_ - return_to_pool_from_local_cache_num;
-    local_coro_buffer_.erase(local_coro_buffer_.end() - local_coroutine_move_size_, local_coro_buffer_.end());
+    size_class.total_coroutines_num -= local_coroutine_move_size_ - return_to_pool_from_local_cache_num;
+    buffer.erase(buffer.end() - local_coroutine_move_size_, buffer.end());
 }
 
-std::size_t Pool::GetStackSize() const { return config_.stack_size; }
+std::size_t Pool::EnqueueUsed(StackSize stack_size, std::size_t count) {
+    auto& size_class = GetSizeClass(stack_size);
+    auto& buffer = local_cache_.buffers[ToIndex(stack_size)];
+    const bool ok = size_class.used_coroutines[local_cache_.node].enqueue_bulk(
+        GetUsedPoolToken<moodycamel::ProducerToken>(stack_size),
+        std::make_move_iterator(buffer.end() - count),
+        count
+    );
+    if (!ok) return 0;
+
+    size_class.idle_coroutines_num.fetch_add(count);
+    return count;
+}
+
+template <typename Mover>
+bool Pool::TryDequeueUsed(StackSize stack_size, Mover& mover) {
+    auto& size_class = GetSizeClass(stack_size);
+    // The local node queue is checked first, as the bulk dequeue is disabled
+    // without the local cache
+    for (std::size_t i = 0; i < nodes_count_; ++i) {
+        if (size_class.used_coroutines[(local_cache_.node + i) % nodes_count_].try_dequeue(mover)) return true;
+    }
+    return false;
+}
+
+std::size_t Pool::GetStackSize(StackSize stack_size) const { return GetSizeClass(stack_size).stack_size; }
 
 PoolConfig Pool::FixupConfig(PoolConfig&& config) {
-    const auto page_size = utils::sys_info::GetPageSize();
-    config.stack_size = (config.stack_size + page_size - 1) & ~(page_size - 1);
+    config.stack_size = RoundUpToPageSize(config.stack_size);
+    config.small_stack_size = RoundUpToPageSize(config.small_stack_size);
+    config.large_stack_size = RoundUpToPageSize(config.large_stack_size);
+
+    UINVARIANT(config.stack_size != 0, "coro_pool.stack_size must be positive");
+    UINVARIANT(
+        config.small_stack_size == 0 || config.small_stack_size < config.stack_size,
+        "coro_pool.small_stack_size must be less than coro_pool.stack_size"
+    );
+    UINVARIANT(
+        config.large_stack_size == 0 || config.large_stack_size > config.stack_size,
+        "coro_pool.large_stack_size must be greater than coro_pool.stack_size"
+    );
 
     return std::move(config);
 }
 
+StackSize Pool::Resolve(StackSize stack_size) const noexcept {
+    return size_classes_[ToIndex(stack_size)] ? stack_size : StackSize::kDefault;
+}
+
+Pool::SizeClass& Pool::GetSizeClass(StackSize stack_size) noexcept {
+    return *size_classes_[ToIndex(Resolve(stack_size))];
+}
+
+const Pool::SizeClass& Pool::GetSizeClass(StackSize stack_size) const noexcept {
+    return *size_classes_[ToIndex(Resolve(stack_size))];
+}
+
 void Pool::RegisterThread() { stack_usage_monitor_.RegisterThread(); }
 
-void Pool::AccountStackUsage() { stack_usage_monitor_.AccountStackUsage(); }
+void Pool::AccountStackUsage(StackSize stack_size) {
+    const auto usage_pct = stack_usage_monitor_.AccountStackUsage();
+    if (usage_pct) {
+        utils::AtomicMax(GetSizeClass(stack_size).max_stack_usage_pct, *usage_pct);
+    }
+}
 
 template <typename Token>
-Token& Pool::GetUsedPoolToken() {
-    thread_local Token token(used_coroutines_);
-    return token;
+Token& Pool::GetUsedPoolToken(StackSize stack_size) {
+    // The node of the thread does not change after PrepareLocalCache
+    thread_local std::array<std::optional<Token>, kStackSizesCount> tokens;
+    auto& token = tokens[ToIndex(stack_size)];
+    if (!token) token.emplace(GetSizeClass(stack_size).used_coroutines[local_cache_.node]);
+    return *token;
 }
 
 //////////////////////////////////////////////////////////////
 
-Pool::CoroutinePtr::CoroutinePtr(Pool::Coroutine&& coro, Pool& pool) noexcept : coro_(std::move(coro)), pool_(&pool) {}
+Pool::CoroutinePtr::CoroutinePtr(Pool::Coroutine&& coro, Pool& pool, StackSize stack_size) noexcept
+    : coro_(std::move(coro)), pool_(&pool), stack_size_(stack_size) {}
 
 Pool::CoroutinePtr::~CoroutinePtr() {
     UASSERT(pool_);
-    if (coro_) pool_->OnCoroutineDestruction();
+    if (coro_) pool_->OnCoroutineDestruction(stack_size_);
 }
 
 Pool::Coroutine& Pool::CoroutinePtr::Get() noexcept {
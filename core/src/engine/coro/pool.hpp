@@ -1,6 +1,8 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <memory>
 #include <vector>
 
 #include <moodycamel/concurrentqueue.h>
@@ -8,6 +10,8 @@
 #include <engine/coro/pool_config.hpp>
 #include <engine/coro/pool_stats.hpp>
 #include <engine/coro/stack_usage_monitor.hpp>
+#include <userver/engine/task/stack_size.hpp>
+#include <userver/utils/fixed_array.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -25,63 +29,102 @@ public:
     Pool(PoolConfig config, Executor executor);
     ~Pool();
 
-    CoroutinePtr GetCoroutine();
+    CoroutinePtr GetCoroutine(StackSize stack_size = StackSize::kDefault);
     void PutCoroutine(CoroutinePtr&& coroutine_ptr);
     PoolStats GetStats() const;
-    std::size_t GetStackSize() const;
+    std::size_t GetStackSize(StackSize stack_size = StackSize::kDefault) const;
     void PrepareLocalCache();
     void ClearLocalCache();
 
     void RegisterThread();
-    void AccountStackUsage();
+    void AccountStackUsage(StackSize stack_size);
 
 private:
+    // Some pointers arithmetic in StackUsageMonitor depends on this.
+    // If you change the allocator, adjust the math there accordingly.
+    using StackAllocator = boost::coroutines2::protected_fixedsize_stack;
+
+    // Coroutines with the stacks of the same size
+    struct SizeClass final {
+        SizeClass(std::size_t stack_size, std::size_t nodes_count, std::size_t max_size);
+
+        const std::size_t stack_size;
+        StackAllocator stack_allocator;
+
+        // We aim to reuse coroutines as much as possible,
+        // because since coroutine stack is a mmap-ed chunk of memory and not
+        // actually an allocated memory we don't want to de-virtualize that memory
+        // excessively.
+        //
+        // Stack pages are allocated on the NUMA node of the thread that touches
+        // them first, so the coroutines are returned to the queue of the node
+        // they were run on and are reused there. There is a single queue if the
+        // pool is not NUMA aware.
+        utils::FixedArray<moodycamel::ConcurrentQueue<Coroutine>> used_coroutines;
+
+        std::atomic<std::size_t> idle_coroutines_num{0};
+        std::atomic<std::size_t> total_coroutines_num{0};
+        std::atomic<std::uint16_t> max_stack_usage_pct{0};
+    };
+
+    // Reduces contention by allowing bulk operations on used_coroutines.
+    // Coroutines in buffers are counted as used in statistics.
+    struct LocalCache final {
+        // NUMA node of the thread, zero-initialized as the cache is thread_local
+        std::size_t node;
+        std::array<std::vector<Coroutine>, kStackSizesCount> buffers;
+    };
+
     static PoolConfig FixupConfig(PoolConfig&& config);
 
-    Coroutine CreateCoroutine(bool quiet = false);
-    void OnCoroutineDestruction() noexcept;
+    // Disabled size classes are replaced with StackSize::kDefault
+    StackSize Resolve(StackSize stack_size) const noexcept;
+    SizeClass& GetSizeClass(StackSize stack_size) noexcept;
+    const SizeClass& GetSizeClass(StackSize stack_size) const noexcept;
 
-    bool TryPopulateLocalCache();
-    void DepopulateLocalCache();
+    Coroutine CreateCoroutine(SizeClass& size_class, bool quiet = false);
+    void OnCoroutineDestruction(StackSize stack_size) noexcept;
+
+    // stack_size must be resolved in the functions below
+    bool TryPopulateLocalCache(StackSize stack_size);
+    void DepopulateLocalCache(StackSize stack_size);
+    void ClearLocalCache(StackSize stack_size);
+    // Moves `count` coroutines from the end of the local cache to the used
+    // coroutines of the local node, returns the number of moved coroutines
+    std::size_t EnqueueUsed(StackSize stack_size, std::size_t count);
+
+    template <typename Mover>
+    bool TryDequeueUsed(StackSize stack_size, Mover& mover);
 
     template <typename Token>
-    Token& GetUsedPoolToken();
+    Token& GetUsedPoolToken(StackSize stack_size);
 
     const PoolConfig config_;
     const Executor executor_;
 
-    // Maximum number of coroutines exchanged between used_coroutines_ for thread
+    // Maximum number of coroutines exchanged between used_coroutines for thread
     // local coroutine cache.
     const std::size_t local_coroutine_move_size_;
 
-    // Reduces contention by allowing bulk operations on used_coroutines_.
-    // Coroutines in local_coro_buffer_ are counted as used in statistics.
+    const std::size_t nodes_count_;
+
     // Unprotected thread_local is OK here, because coro::Pool is always used
     // outside of any coroutine.
-    static inline thread_local std::vector<Coroutine> local_coro_buffer_;
+    static inline thread_local LocalCache local_cache_;
 
-    boost::coroutines2::protected_fixedsize_stack stack_allocator_;
-    // Some pointers arithmetic in StackUsageMonitor depends on this.
-    // If you change the allocator, adjust the math there accordingly.
-    static_assert(std::is_same_v<decltype(stack_allocator_), boost::coroutines2::protected_fixedsize_stack>);
     StackUsageMonitor stack_usage_monitor_;
 
-    // We aim to reuse coroutines as much as possible,
-    // because since coroutine stack is a mmap-ed chunk of memory and not actually
-    // an allocated memory we don't want to de-virtualize that memory excessively.
-    //
-    // The same could've been achieved with some LIFO container, but apparently
-    // we don't have a container handy enough to not just use 2 queues.
-    moodycamel::ConcurrentQueue<Coroutine> initial_coroutines_;
-    moodycamel::ConcurrentQueue<Coroutine> used_coroutines_;
+    // Indexed by ToIndex(StackSize), nullptr for the disabled size classes
+    std::array<std::unique_ptr<SizeClass>, kStackSizesCount> size_classes_;
 
-    std::atomic<std::size_t> idle_coroutines_num_;
-    std::atomic<std::size_t> total_coroutines_num_;
+    // Preallocated coroutines of the default size class, their stacks are not
+    // touched yet.
+    moodycamel::ConcurrentQueue<Coroutine> initial_coroutines_;
 };
 
 class Pool::CoroutinePtr final {
 public:
-    CoroutinePtr(Coroutine&& coro, Pool& pool) noexcept;
+    CoroutinePtr(Coroutine&& coro, Pool& pool, StackSize stack_size) noexcept;
 
     CoroutinePtr(CoroutinePtr&&) noexcept = default;
     CoroutinePtr& operator=(CoroutinePtr&&) noexcept = default;
@@ -90,11 +133,14 @@ public:
 
     Coroutine& Get() noexcept;
 
+    StackSize GetStackSize() const noexcept { return stack_size_; }
+
     void ReturnToPool() &&;
 
 private:
     Coroutine coro_;
     Pool* pool_;
+    StackSize stack_size_;
 };
 
 }  // namespace engine::coro
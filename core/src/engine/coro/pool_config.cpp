@@ -9,7 +9,10 @@ PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolCo
     config.initial_size = value["initial_size"].As<size_t>(config.initial_size);
     config.max_size = value["max_size"].As<size_t>(config.max_size);
     config.stack_size = value["stack_size"].As<size_t>(config.stack_size);
+    config.small_stack_size = value["small_stack_size"].As<size_t>(config.small_stack_size);
+    config.large_stack_size = value["large_stack_size"].As<size_t>(config.large_stack_size);
     config.local_cache_size = value["local_cache_size"].As<size_t>(config.local_cache_size);
+    config.numa_aware = value["numa_aware"].As<bool>(config.numa_aware);
     return config;
 }
 
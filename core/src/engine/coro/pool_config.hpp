@@ -13,7 +13,11 @@ struct PoolConfig {
     std::size_t initial_size = 1000;
     std::size_t max_size = 4000;
     std::size_t stack_size = 256 * 1024ULL;
+    // 0 - the size class is disabled and its tasks use stack_size
+    std::size_t small_stack_size = 0;
+    std::size_t large_stack_size = 0;
     std::size_t local_cache_size = 8;
+    bool numa_aware = false;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<PoolConfig>);
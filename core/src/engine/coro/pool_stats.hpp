@@ -1,19 +1,52 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 
+#include <userver/engine/task/stack_size.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+inline constexpr std::size_t kStackSizesCount = 3;
+
+constexpr std::size_t ToIndex(StackSize stack_size) noexcept { return static_cast<std::size_t>(stack_size); }
+
+struct StackSizeClassStats {
+    // 0 if the size class is disabled
+    size_t stack_size = 0;
+    size_t active_coroutines = 0;
+    size_t total_coroutines = 0;
+    std::uint16_t max_stack_usage_pct = 0;
+    // Stack size that fits the observed usage, 0 if the usage is not monitored
+    size_t suggested_stack_size = 0;
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const StackSizeClassStats& stats);
+
 struct PoolStats {
     size_t active_coroutines = 0;
     size_t total_coroutines = 0;
     std::uint16_t max_stack_usage_pct = 0;
     bool is_stack_usage_monitor_active = false;
+    // Indexed by ToIndex(StackSize)
+    std::array<StackSizeClassStats, kStackSizesCount> size_classes{};
 };
 
+inline StackSizeClassStats& operator+=(StackSizeClassStats& lhs, const StackSizeClassStats& rhs) {
+    lhs.stack_size = std::max(lhs.stack_size, rhs.stack_size);
+    lhs.active_coroutines += rhs.active_coroutines;
+    lhs.total_coroutines += rhs.total_coroutines;
+    lhs.max_stack_usage_pct = std::max(lhs.max_stack_usage_pct, rhs.max_stack_usage_pct);
+    lhs.suggested_stack_size = std::max(lhs.suggested_stack_size, rhs.suggested_stack_size);
+    return lhs;
+}
+
 inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
     lhs.active_coroutines += rhs.active_coroutines;
     lhs.total_coroutines += rhs.total_coroutines;
@@ -21,6 +54,9 @@ inline PoolStats& operator+=(PoolStats& lhs, const PoolStats& rhs) {
         lhs.max_stack_usage_pct = rhs.max_stack_usage_pct;
     }
     lhs.is_stack_usage_monitor_active |= rhs.is_stack_usage_monitor_active;
+    for (std::size_t i = 0; i < kStackSizesCount; ++i) {
+        lhs.size_classes[i] += rhs.size_classes[i];
+    }
     return lhs;
 }
 
@@ -1,5 +1,7 @@
 #include <engine/coro/stack_usage_monitor.hpp>
 
+#include <algorithm>
+
 #include <coroutines/coroutine.hpp>
 
 #include <engine/task/task_context.hpp>
@@ -64,6 +66,14 @@ USERVER_NAMESPACE_BEGIN
 
 namespace engine::coro {
 
+namespace {
+
+// Stack usage marks are placed every kStackUsageMarkStepPct percents of the
+// stack, so the usage is known with this resolution
+constexpr std::uint16_t kStackUsageMarkStepPct = 15;
+
+}  // namespace
+
 const void* GetCoroCbPtr(const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro) noexcept {
     return boost::coroutines2::detail::pull_coroutine<boost::coroutines2::detail::FriendHijackTag>::GetCbPtr(coro);
 }
@@ -263,9 +273,7 @@ private:
 
 class StackUsageMonitor::Impl final {
 public:
-    explicit Impl(std::size_t coro_stack_size) : coro_stack_size_{coro_stack_size} {
-        UASSERT(coro_stack_size % kPageSize == 0);
-    }
+    Impl() = default;
     ~Impl() { Stop(); }
 
     void Start() {
@@ -365,13 +373,14 @@ public:
         is_active_ = false;
     }
 
-    void Register(const void* cb_ptr) {
+    void Register(const void* cb_ptr, std::size_t stack_size) {
         if (!is_active_) {
             return;
         }
 
+        UASSERT(stack_size % kPageSize == 0);
         const auto stack_begin = GetStackBegin(cb_ptr);
-        const auto stack_pages_count = coro_stack_size_ / kPageSize;
+        const auto stack_pages_count = stack_size / kPageSize;
 
         const auto add_stack_usage_mark = [this, stack_begin, stack_pages_count](std::size_t usage_pct) {
             const auto mark_offset = kPageSize * (stack_pages_count * usage_pct / 100);
@@ -398,7 +407,7 @@ public:
         // Just a bunch of reasonably scattered marks, could be changed.
         // Don't forget to adjust `kStackUsagePctThresholdToLogStacktrace` as well
         // if you do so.
-        for (std::size_t usage_pct = 15; usage_pct <= 90; usage_pct += 15) {
+        for (std::size_t usage_pct = kStackUsageMarkStepPct; usage_pct <= 90; usage_pct += kStackUsageMarkStepPct) {
             // 15, 30, 45, 60, 75, 90
             add_stack_usage_mark(usage_pct);
         }
@@ -468,12 +477,12 @@ public:
         }
     }
 
-    void AccountStackUsage() {
+    std::optional<std::uint16_t> AccountStackUsage() {
         UASSERT(!current_task::GetCurrentTaskContextUnchecked());
 
         auto usage_info = stack_usage_info.Use();
         if (!usage_info->actionable) {
-            return;
+            return std::nullopt;
         }
 
         const auto usage_pct = usage_info->usage_pct;
@@ -496,6 +505,7 @@ public:
         utils::AtomicMax(max_stack_usage_pct_, usage_info->usage_pct);
 
         usage_info->actionable = false;
+        return usage_pct;
     }
 
     std::uint16_t GetMaxStackUsagePct() const { return max_stack_usage_pct_.load(); }
@@ -592,7 +602,6 @@ private:
     boost::container::small_vector<std::pair<int, pthread_t>, 32> thread_id_to_pthread_id_{};
     boost::container::small_vector<void*, 32> threads_alt_stacks{};
 
-    std::size_t coro_stack_size_;
     std::thread monitor_thread_;
     FdHolder monitor_fd_{};
     FdHolder stop_fd_{};
@@ -605,16 +614,14 @@ private:
 
 class StackUsageMonitor::Impl final {
 public:
-    explicit Impl(std::size_t) {}
-
     void Start() {}
     void Stop() {}
 
-    void Register(const void*) {}
+    void Register(const void*, std::size_t) {}
 
     void RegisterThread() {}
 
-    void AccountStackUsage() {}
+    std::optional<std::uint16_t> AccountStackUsage() { return std::nullopt; }
 
     std::uint16_t GetMaxStackUsagePct() const noexcept { return 0; }
     bool IsActive() const noexcept { return false; }
@@ -622,7 +629,7 @@ public:
 
 #endif
 
-StackUsageMonitor::StackUsageMonitor(std::size_t coro_stack_size) : impl_{coro_stack_size} {}
+StackUsageMonitor::StackUsageMonitor() = default;
 
 StackUsageMonitor::~StackUsageMonitor() { Stop(); }
 
@@ -630,8 +637,11 @@ void StackUsageMonitor::Start() { impl_->Start(); }
 
 void StackUsageMonitor::Stop() { impl_->Stop(); }
 
-void StackUsageMonitor::Register(const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro) {
-    impl_->Register(GetCoroCbPtr(coro));
+void StackUsageMonitor::Register(
+    const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro,
+    std::size_t stack_size
+) {
+    impl_->Register(GetCoroCbPtr(coro), stack_size);
 }
 
 void StackUsageMonitor::RegisterThread() { impl_->RegisterThread(); }
@@ -645,7 +655,7 @@ impl::CountedCoroutinePtr* StackUsageMonitor::GetCurrentTaskCoroutine() noexcept
     return &current_task->GetCoroutinePtr();
 }
 
-void StackUsageMonitor::AccountStackUsage() { impl_->AccountStackUsage(); }
+std::optional<std::uint16_t> StackUsageMonitor::AccountStackUsage() { return impl_->AccountStackUsage(); }
 
 std::uint16_t StackUsageMonitor::GetMaxStackUsagePct() const noexcept { return impl_->GetMaxStackUsagePct(); }
 
@@ -680,6 +690,15 @@ __attribute__((noinline)) std::size_t GetCurrentTaskStackUsageBytes() noexcept {
     return reinterpret_cast<std::uintptr_t>(coro_stack_begin) - reinterpret_cast<std::uintptr_t>(stack_pointer);
 }
 
+std::size_t SuggestStackSize(std::size_t stack_size, std::uint16_t max_usage_pct) noexcept {
+    // The usage is somewhere below the next mark
+    const std::size_t usage_upper_bound_pct = std::min<std::size_t>(max_usage_pct + kStackUsageMarkStepPct, 100);
+    const std::size_t suggested = stack_size * usage_upper_bound_pct / 100 * 2;
+
+    const auto page_size = utils::sys_info::GetPageSize();
+    return (suggested + page_size - 1) / page_size * page_size;
+}
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <optional>
 
 #include <coroutines/coroutine.hpp>
 
@@ -17,19 +19,20 @@ namespace engine::coro {
 
 class StackUsageMonitor final {
 public:
-    explicit StackUsageMonitor(std::size_t coro_stack_size);
+    StackUsageMonitor();
     ~StackUsageMonitor();
 
     void Start();
     void Stop();
 
-    void Register(const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro);
+    void Register(const boost::coroutines2::coroutine<impl::TaskContext*>::push_type& coro, std::size_t stack_size);
 
     void RegisterThread();
 
     static impl::CountedCoroutinePtr* GetCurrentTaskCoroutine() noexcept;
 
-    void AccountStackUsage();
+    // Returns the stack usage of the last step of the task, if it hit a mark
+    std::optional<std::uint16_t> AccountStackUsage();
     std::uint16_t GetMaxStackUsagePct() const noexcept;
     bool IsActive() const noexcept;
 
@@ -42,6 +45,10 @@ private:
 
 std::size_t GetCurrentTaskStackUsageBytes() noexcept;
 
+// Stack size that fits the observed max usage of `stack_size` stacks twice,
+// rounded up to the page size
+std::size_t SuggestStackSize(std::size_t stack_size, std::uint16_t max_usage_pct) noexcept;
+
 }  // namespace engine::coro
 
 USERVER_NAMESPACE_END
@@ -11,6 +11,7 @@
 #include <userver/utils/rand.hpp>
 
 #include <logging/logging_test.hpp>
+#include <utils/sys_info.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -82,4 +83,15 @@ UTEST_F(StackUsageMonitorTest, BacktraceLogging) {
     EXPECT_THAT(logged_string, testing::HasSubstr("[start of coroutine]"));
 }
 
+TEST(StackUsageMonitor, SuggestStackSize) {
+    const auto page_size = utils::sys_info::GetPageSize();
+    const auto stack_size = 100 * page_size;
+
+    // Usage below the first mark is below 15%, twice that is 30%
+    EXPECT_EQ(engine::coro::SuggestStackSize(stack_size, 0), 30 * page_size);
+    EXPECT_EQ(engine::coro::SuggestStackSize(stack_size, 30), 90 * page_size);
+    // Stacks that are almost full get a bigger suggestion
+    EXPECT_EQ(engine::coro::SuggestStackSize(stack_size, 90), 200 * page_size);
+}
+
 USERVER_NAMESPACE_END
@@ -0,0 +1,402 @@
+#include <engine/ev/io_uring.hpp>
+
+#include <build_config.hpp>
+
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <userver/engine/task/cancel.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+
+#include <engine/ev/thread_control.hpp>
+#include <utils/check_syscall.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+IoUringOperation::IoUringOperation(
+    Type type,
+    int fd,
+    void* buf,
+    std::size_t len,
+    const std::atomic<bool>& fd_closed
+) noexcept
+    : fd_closed_(fd_closed), buf_(buf), len_(len), fd_(fd), type_(type) {
+    UASSERT(type_ != Type::kSendMsg);
+}
+
+IoUringOperation::IoUringOperation(
+    int fd,
+    struct iovec* list,
+    std::size_t list_size,
+    const std::atomic<bool>& fd_closed
+) noexcept
+    : fd_closed_(fd_closed), buf_(nullptr), len_(0), fd_(fd), type_(Type::kSendMsg) {
+    msg_.msg_iov = list;
+    msg_.msg_iovlen = list_size;
+}
+
+std::optional<int> IoUringOperation::Run(ThreadControl& control, Deadline deadline) {
+    UASSERT(control.GetIoUring());
+    control_ = &control;
+    control.RunPayloadInEvLoopAsync(*this);
+
+    if (event_.WaitUntil(deadline) == FutureStatus::kReady) {
+        return result_;
+    }
+
+    // The kernel may still write into the buffer, so we have to wait for the
+    // request to complete before leaving.
+    control.RunInEvLoopSync([this] { control_->GetIoUring()->Cancel(*this); });
+    event_.WaitNonCancellable();
+
+    if (result_ == -ECANCELED) return std::nullopt;
+    return result_;
+}
+
+void IoUringOperation::DoPerformAndRelease() {
+    UASSERT(control_);
+    auto* io_uring = control_->GetIoUring();
+    UASSERT(io_uring);
+    io_uring->Submit(*this);
+}
+
+void IoUringOperation::Complete(int result) noexcept {
+    UASSERT(!completed_);
+    completed_ = true;
+    result_ = result;
+    event_.Send();
+    // *this may be destroyed at this point
+}
+
+#ifdef HAVE_IO_URING
+
+namespace {
+
+// Completions with this user_data (e.g. of cancellation requests) are ignored
+constexpr std::uint64_t kIgnoredUserData = 0;
+
+constexpr std::uint8_t kRequiredOps[] = {
+    IORING_OP_RECV,
+    IORING_OP_SEND,
+    IORING_OP_SENDMSG,
+    IORING_OP_ASYNC_CANCEL,
+    // Not used, but came with Linux 5.19 together with IORING_ASYNC_CANCEL_FD
+    // that does not have its own probe.
+    IORING_OP_SOCKET,
+};
+
+constexpr unsigned kRequiredFeatures = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP;
+
+int IoUringSetup(std::uint32_t entries, io_uring_params& params) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+}
+
+int IoUringEnter(int fd, unsigned to_submit, unsigned min_complete, unsigned flags) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int IoUringRegister(int fd, unsigned opcode, void* arg, unsigned nr_args) noexcept {
+    return static_cast<int>(::syscall(__NR_io_uring_register, fd, opcode, arg, nr_args));
+}
+
+unsigned LoadAcquire(const unsigned* ptr) noexcept { return __atomic_load_n(ptr, __ATOMIC_ACQUIRE); }
+
+void StoreRelease(unsigned* ptr, unsigned value) noexcept { __atomic_store_n(ptr, value, __ATOMIC_RELEASE); }
+
+template <typename T>
+T* Offset(void* base, std::uint32_t offset) noexcept {
+    return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+class MappedRegion final {
+public:
+    MappedRegion(int fd, std::size_t size, off_t offset) : size_(size) {
+        ptr_ = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+        if (ptr_ == MAP_FAILED) {
+            const auto err_value = errno;
+            throw std::system_error(
+                std::error_code(err_value, std::system_category()), "Error while mapping io_uring rings"
+            );
+        }
+    }
+
+    MappedRegion(const MappedRegion&) = delete;
+    MappedRegion& operator=(const MappedRegion&) = delete;
+
+    ~MappedRegion() { ::munmap(ptr_, size_); }
+
+    void* Get() const noexcept { return ptr_; }
+
+private:
+    void* ptr_{nullptr};
+    std::size_t size_;
+};
+
+class RingFd final {
+public:
+    explicit RingFd(int fd) noexcept : fd_(fd) {}
+
+    RingFd(const RingFd&) = delete;
+    RingFd& operator=(const RingFd&) = delete;
+
+    ~RingFd() { ::close(fd_); }
+
+    int Get() const noexcept { return fd_; }
+
+private:
+    const int fd_;
+};
+
+bool DoCheckSupport() noexcept {
+    io_uring_params params{};
+    const int fd = IoUringSetup(2, params);
+    if (fd == -1) {
+        const auto err_value = errno;
+        LOG_INFO() << "io_uring is not available: " << std::error_code(err_value, std::system_category()).message();
+        return false;
+    }
+    const RingFd ring_fd{fd};
+
+    if ((params.features & kRequiredFeatures) != kRequiredFeatures) {
+        LOG_INFO() << "io_uring is not available: kernel lacks the required features";
+        return false;
+    }
+
+    constexpr unsigned kMaxOps = 256;
+    std::vector<char> storage(sizeof(io_uring_probe) + kMaxOps * sizeof(io_uring_probe_op));
+    auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+    if (IoUringRegister(ring_fd.Get(), IORING_REGISTER_PROBE, probe, kMaxOps) == -1) {
+        LOG_INFO() << "io_uring is not available: failed to probe the supported operations";
+        return false;
+    }
+
+    for (const auto op : kRequiredOps) {
+        if (op >= probe->ops_len || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+            LOG_INFO() << "io_uring is not available: operation " << static_cast<int>(op) << " is not supported";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}  // namespace
+
+struct IoUring::Impl final {
+    explicit Impl(int fd, const io_uring_params& params)
+        : ring_fd(fd),
+          rings(
+              fd,
+              std::max(
+                  params.sq_off.array + params.sq_entries * sizeof(unsigned),
+                  params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe)
+              ),
+              IORING_OFF_SQ_RING
+          ),
+          sqes_region(fd, params.sq_entries * sizeof(io_uring_sqe), IORING_OFF_SQES),
+          sq_head(Offset<unsigned>(rings.Get(), params.sq_off.head)),
+          sq_tail(Offset<unsigned>(rings.Get(), params.sq_off.tail)),
+          sq_flags(Offset<unsigned>(rings.Get(), params.sq_off.flags)),
+          sq_array(Offset<unsigned>(rings.Get(), params.sq_off.array)),
+          sq_mask(*Offset<unsigned>(rings.Get(), params.sq_off.ring_mask)),
+          sq_entries(params.sq_entries),
+          sqes(static_cast<io_uring_sqe*>(sqes_region.Get())),
+          cq_head(Offset<unsigned>(rings.Get(), params.cq_off.head)),
+          cq_tail(Offset<unsigned>(rings.Get(), params.cq_off.tail)),
+          cq_mask(*Offset<unsigned>(rings.Get(), params.cq_off.ring_mask)),
+          cqes(Offset<io_uring_cqe>(rings.Get(), params.cq_off.cqes)),
+          local_sq_tail(*sq_tail) {}
+
+    RingFd ring_fd;
+    MappedRegion rings;
+    MappedRegion sqes_region;
+
+    unsigned* const sq_head;
+    unsigned* const sq_tail;
+    unsigned* const sq_flags;
+    unsigned* const sq_array;
+    const unsigned sq_mask;
+    const unsigned sq_entries;
+    io_uring_sqe* const sqes;
+
+    unsigned* const cq_head;
+    unsigned* const cq_tail;
+    const unsigned cq_mask;
+    io_uring_cqe* const cqes;
+
+    // SQEs in [*sq_tail, local_sq_tail) are filled, but not published yet
+    unsigned local_sq_tail;
+    unsigned to_submit{0};
+};
+
+bool IoUring::IsSupported() noexcept {
+    static const bool kIsSupported = DoCheckSupport();
+    return kIsSupported;
+}
+
+IoUring::IoUring(std::uint32_t entries) {
+    io_uring_params params{};
+    params.flags = IORING_SETUP_SUBMIT_ALL;
+    const int fd = utils::CheckSyscall(IoUringSetup(entries, params), "setting up io_uring, entries={}", entries);
+
+    try {
+        impl_ = std::make_unique<Impl>(fd, params);
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+}
+
+IoUring::~IoUring() = default;
+
+int IoUring::GetFd() const noexcept { return impl_->ring_fd.Get(); }
+
+io_uring_sqe* IoUring::GetSqe() noexcept {
+    auto& impl = *impl_;
+    while (impl.local_sq_tail - LoadAcquire(impl.sq_head) >= impl.sq_entries) {
+        Flush();
+    }
+
+    const unsigned index = impl.local_sq_tail & impl.sq_mask;
+    impl.sq_array[index] = index;
+    ++impl.local_sq_tail;
+    ++impl.to_submit;
+
+    auto* sqe = &impl.sqes[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    return sqe;
+}
+
+void IoUring::Submit(IoUringOperation& op) noexcept {
+    if (op.fd_closed_.load()) {
+        op.Complete(-ECANCELED);
+        return;
+    }
+
+    auto* sqe = GetSqe();
+    sqe->fd = op.fd_;
+    switch (op.type_) {
+        case IoUringOperation::Type::kRecv:
+            sqe->opcode = IORING_OP_RECV;
+            sqe->addr = reinterpret_cast<std::uintptr_t>(op.buf_);
+            sqe->len = std::min<std::size_t>(op.len_, std::numeric_limits<std::uint32_t>::max());
+            break;
+        case IoUringOperation::Type::kSend:
+            sqe->opcode = IORING_OP_SEND;
+            sqe->addr = reinterpret_cast<std::uintptr_t>(op.buf_);
+            sqe->len = std::min<std::size_t>(op.len_, std::numeric_limits<std::uint32_t>::max());
+            sqe->msg_flags = MSG_NOSIGNAL;
+            break;
+        case IoUringOperation::Type::kSendMsg:
+            sqe->opcode = IORING_OP_SENDMSG;
+            sqe->addr = reinterpret_cast<std::uintptr_t>(&op.msg_);
+            sqe->len = 1;
+            sqe->msg_flags = MSG_NOSIGNAL;
+            break;
+    }
+    sqe->user_data = reinterpret_cast<std::uintptr_t>(&op);
+}
+
+void IoUring::Cancel(IoUringOperation& op) noexcept {
+    if (op.completed_) return;
+
+    auto* sqe = GetSqe();
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = reinterpret_cast<std::uintptr_t>(&op);
+    sqe->user_data = kIgnoredUserData;
+}
+
+void IoUring::CancelFd(int fd) noexcept {
+    auto* sqe = GetSqe();
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = fd;
+    sqe->cancel_flags = IORING_ASYNC_CANCEL_FD | IORING_ASYNC_CANCEL_ALL;
+    sqe->user_data = kIgnoredUserData;
+    Flush();
+}
+
+void IoUring::Flush() noexcept {
+    auto& impl = *impl_;
+    if (!impl.to_submit) return;
+
+    StoreRelease(impl.sq_tail, impl.local_sq_tail);
+    while (impl.to_submit) {
+        const int submitted = IoUringEnter(impl.ring_fd.Get(), impl.to_submit, 0, 0);
+        if (submitted >= 0) {
+            UASSERT(static_cast<unsigned>(submitted) <= impl.to_submit);
+            impl.to_submit -= submitted;
+            continue;
+        }
+
+        const auto err_value = errno;
+        if (err_value == EAGAIN || err_value == EBUSY) {
+            // CQ overflow backlog is full, make some room
+            Reap();
+        } else if (err_value != EINTR) {
+            utils::impl::AbortWithStacktrace(fmt::format(
+                "io_uring_enter failed: {}", std::error_code(err_value, std::system_category()).message()
+            ));
+        }
+    }
+}
+
+void IoUring::Reap() noexcept {
+    auto& impl = *impl_;
+    for (;;) {
+        unsigned head = *impl.cq_head;
+        const unsigned tail = LoadAcquire(impl.cq_tail);
+        for (; head != tail; ++head) {
+            const auto& cqe = impl.cqes[head & impl.cq_mask];
+            if (cqe.user_data == kIgnoredUserData) continue;
+            reinterpret_cast<IoUringOperation*>(cqe.user_data)->Complete(cqe.res);
+        }
+        StoreRelease(impl.cq_head, head);
+
+        if (!(LoadAcquire(impl.sq_flags) & IORING_SQ_CQ_OVERFLOW)) break;
+        // Move the overflown completions into the CQ
+        IoUringEnter(impl.ring_fd.Get(), 0, 0, IORING_ENTER_GETEVENTS);
+    }
+}
+
+#else
+
+struct IoUring::Impl final {};
+
+bool IoUring::IsSupported() noexcept { return false; }
+
+IoUring::IoUring(std::uint32_t) { UINVARIANT(false, "io_uring is not supported on this platform"); }
+
+IoUring::~IoUring() = default;
+
+int IoUring::GetFd() const noexcept { return -1; }
+
+void IoUring::Submit(IoUringOperation&) noexcept { UASSERT(false); }
+
+void IoUring::Cancel(IoUringOperation&) noexcept { UASSERT(false); }
+
+void IoUring::CancelFd(int) noexcept { UASSERT(false); }
+
+void IoUring::Flush() noexcept {}
+
+void IoUring::Reap() noexcept {}
+
+#endif
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include <userver/engine/deadline.hpp>
+#include <userver/engine/single_use_event.hpp>
+
+#include <engine/ev/async_payload_base.hpp>
+
+struct io_uring_sqe;
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::ev {
+
+class ThreadControl;
+
+/// A single io_uring request of a coroutine. Lives on the stack of the waiting
+/// coroutine, is submitted and completed on the ev thread that owns the ring.
+class IoUringOperation final : public SingleShotAsyncPayload<IoUringOperation> {
+public:
+    enum class Type : std::uint8_t {
+        kRecv,
+        kSend,
+        kSendMsg,
+    };
+
+    /// `fd_closed` is checked on the ev thread right before the submission,
+    /// the request is completed with ECANCELED if it is set.
+    IoUringOperation(Type type, int fd, void* buf, std::size_t len, const std::atomic<bool>& fd_closed) noexcept;
+
+    IoUringOperation(int fd, struct iovec* list, std::size_t list_size, const std::atomic<bool>& fd_closed) noexcept;
+
+    /// Submits the request to the ring of `control` and waits for its
+    /// completion. Returns the `cqe->res` of the request, or std::nullopt if
+    /// the request was cancelled due to the deadline or task cancellation.
+    [[nodiscard]] std::optional<int> Run(ThreadControl& control, Deadline deadline);
+
+private:
+    friend class SingleShotAsyncPayload<IoUringOperation>;
+    friend class IoUring;
+
+    void DoPerformAndRelease();
+    void Complete(int result) noexcept;
+
+    ThreadControl* control_{nullptr};
+    const std::atomic<bool>& fd_closed_;
+    struct msghdr msg_ {};
+    void* buf_;
+    std::size_t len_;
+    int fd_;
+    int result_{0};
+    Type type_;
+    bool completed_{false};  // accessed only from the ev thread
+    engine::SingleUseEvent event_;
+};
+
+/// io_uring instance bound to an ev::Thread. All the methods except the
+/// constructor and IsSupported() must be called on the owning ev thread.
+///
+/// Submissions are batched: requests are put into the SQ as they come and the
+/// whole batch is passed to the kernel in Flush() once per ev loop iteration.
+/// Completions are reaped when the ring fd becomes readable in the ev loop.
+class IoUring final {
+public:
+    /// Returns true if the running kernel supports all the io_uring features
+    /// required by the engine.
+    static bool IsSupported() noexcept;
+
+    explicit IoUring(std::uint32_t entries);
+    ~IoUring();
+
+    IoUring(IoUring&&) = delete;
+    IoUring& operator=(IoUring&&) = delete;
+
+    int GetFd() const noexcept;
+
+    void Submit(IoUringOperation& op) noexcept;
+
+    /// Cancels the request of `op` if it was not completed yet.
+    void Cancel(IoUringOperation& op) noexcept;
+
+    /// Cancels all the requests for `fd` and flushes the SQ immediately, so
+    /// that `fd` could be closed right after the call.
+    void CancelFd(int fd) noexcept;
+
+    /// Passes all the pending submissions to the kernel.
+    void Flush() noexcept;
+
+    /// Processes all the available completions.
+    void Reap() noexcept;
+
+private:
+    struct Impl;
+
+    ::io_uring_sqe* GetSqe() noexcept;
+
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace engine::ev
+
+USERVER_NAMESPACE_END
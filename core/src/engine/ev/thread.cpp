@@ -25,16 +25,28 @@ const auto kDeferredInterval = kMinDurationToDefer - utils::datetime::SteadyCoar
 // Check the time at least twice per collect interval
 const auto kCpuStatsThrottle = static_cast<std::size_t>(kCpuStatsCollectInterval / kDeferredInterval / 2);
 
+// SQ is flushed on overflow, so this limits only the batch size
+constexpr std::uint32_t kIoUringEntries = 512;
+
 }  // namespace
 
-Thread::Thread(const std::string& thread_name) : Thread(thread_name, EventLoop::EvLoopType::kNewLoop) {}
+Thread::Thread(const std::string& thread_name) : Thread(thread_name, EventLoop::EvLoopType::kNewLoop, false) {}
 
 Thread::Thread(const std::string& thread_name, UseDefaultEvLoop)
-    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop) {}
+    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop, false) {}
+
+Thread::Thread(const std::string& thread_name, UseIoUring)
+    : Thread(thread_name, EventLoop::EvLoopType::kNewLoop, true) {}
+
+Thread::Thread(const std::string& thread_name, UseDefaultEvLoop, UseIoUring)
+    : Thread(thread_name, EventLoop::EvLoopType::kDefaultLoop, true) {}
 
-Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type)
+Thread::Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, bool use_io_uring)
     : event_loop_(ev_loop_type), name_{thread_name}, cpu_stats_storage_{kCpuStatsCollectInterval, kCpuStatsThrottle} {
     UASSERT_MSG(kDeferredInterval > std::chrono::milliseconds{4}, "Timer events would happen too often");
+    if (use_io_uring) {
+        io_uring_ = std::make_unique<IoUring>(kIoUringEntries);
+    }
     Start();
 }
 
@@ -109,6 +121,12 @@ void Thread::Start() {
     ev_timer_init(&defer_timer_, UpdateTimersWatcher, 0.0, defer_duration.count());
     ev_timer_start(loop, &defer_timer_);
 
+    if (io_uring_) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast)
+        ev_io_init(&watch_io_uring_, IoUringWatcher, io_uring_->GetFd(), EV_READ);
+        ev_io_start(loop, &watch_io_uring_);
+    }
+
     is_running_ = true;
     thread_ = std::thread([this] {
         utils::SetCurrentThreadName(name_);
@@ -130,6 +148,10 @@ void Thread::RunEvLoop() {
         AcquireImpl();
         event_loop_.RunOnce();
         UpdateLoopWatcherImpl();
+        if (io_uring_) {
+            // All the submissions of this loop iteration go in one syscall
+            io_uring_->Flush();
+        }
         cpu_stats_storage_.Collect();
         ReleaseImpl();
     }
@@ -137,6 +159,9 @@ void Thread::RunEvLoop() {
     ev_async_stop(GetEvLoop(), &watch_update_);
     ev_async_stop(GetEvLoop(), &watch_break_);
     ev_timer_stop(GetEvLoop(), &defer_timer_);
+    if (io_uring_) {
+        ev_io_stop(GetEvLoop(), &watch_io_uring_);
+    }
 }
 
 void Thread::UpdateLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
@@ -162,6 +187,13 @@ void Thread::UpdateLoopWatcherImpl() {
     }
 }
 
+void Thread::IoUringWatcher(struct ev_loop* loop, ev_io*, int) noexcept {
+    auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
+    UASSERT(ev_thread != nullptr);
+    UASSERT(ev_thread->io_uring_);
+    ev_thread->io_uring_->Reap();
+}
+
 void Thread::BreakLoopWatcher(struct ev_loop* loop, ev_async*, int) noexcept {
     auto* ev_thread = static_cast<Thread*>(ev_userdata(loop));
     UASSERT(ev_thread != nullptr);
@@ -12,6 +12,7 @@
 
 #include <engine/ev/async_payload_base.hpp>
 #include <engine/ev/event_loop.hpp>
+#include <engine/ev/io_uring.hpp>
 #include <userver/concurrent/impl/intrusive_mpsc_queue.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
@@ -27,8 +28,13 @@ public:
     struct UseDefaultEvLoop {};
     static constexpr UseDefaultEvLoop kUseDefaultEvLoop{};
 
+    struct UseIoUring {};
+    static constexpr UseIoUring kUseIoUring{};
+
     explicit Thread(const std::string& thread_name);
     Thread(const std::string& thread_name, UseDefaultEvLoop);
+    Thread(const std::string& thread_name, UseIoUring);
+    Thread(const std::string& thread_name, UseDefaultEvLoop, UseIoUring);
 
     ~Thread();
 
@@ -45,11 +51,14 @@ public:
 
     bool IsInEvThread() const;
 
+    // Returns nullptr if the thread was created without io_uring
+    IoUring* GetIoUring() const noexcept { return io_uring_.get(); }
+
     std::uint8_t GetCurrentLoadPercent() const;
     const std::string& GetName() const;
 
 private:
-    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type);
+    Thread(const std::string& thread_name, EventLoop::EvLoopType ev_loop_type, bool use_io_uring);
 
     void RegisterInEvLoop(AsyncPayloadBase& payload);
 
@@ -61,6 +70,7 @@ private:
     static void UpdateLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
     static void UpdateTimersWatcher(struct ev_loop*, ev_timer* w, int) noexcept;
     void UpdateLoopWatcherImpl();
+    static void IoUringWatcher(struct ev_loop*, ev_io* w, int) noexcept;
     static void BreakLoopWatcher(struct ev_loop*, ev_async* w, int) noexcept;
     void BreakLoopWatcherImpl();
 
@@ -81,6 +91,9 @@ private:
     ev_async watch_update_{};
     ev_async watch_break_{};
 
+    std::unique_ptr<IoUring> io_uring_;
+    ev_io watch_io_uring_{};
+
     const std::string name_;
     utils::statistics::ThreadCpuStatsStorage cpu_stats_storage_;
     bool is_running_{false};
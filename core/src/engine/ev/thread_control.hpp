@@ -112,6 +112,7 @@ private:
 }  // namespace impl
 
 class Thread;
+class IoUring;
 
 class ThreadControlBase {
 public:
@@ -139,6 +140,9 @@ public:
 
     bool IsInEvThread() const noexcept;
 
+    /// Returns nullptr if the ev thread does not own an io_uring.
+    IoUring* GetIoUring() const noexcept;
+
 protected:
     explicit ThreadControlBase(Thread& thread) noexcept;
 
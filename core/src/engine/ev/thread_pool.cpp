@@ -2,6 +2,7 @@
 
 #include <fmt/format.h>
 
+#include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
 #include "thread.hpp"
@@ -17,10 +18,20 @@ ThreadPool::ThreadPool(ThreadPoolConfig config, UseDefaultEvLoop)
     : ThreadPool(std::move(config), !config.ev_default_loop_disabled) {}
 
 ThreadPool::ThreadPool(ThreadPoolConfig config, bool use_ev_default_loop) : use_ev_default_loop_(use_ev_default_loop) {
+    const bool use_io_uring = config.io_uring && IoUring::IsSupported();
+    if (config.io_uring && !use_io_uring) {
+        LOG_WARNING() << "io_uring was requested for '" << config.thread_name
+                      << "' ev threads, but is not supported by the kernel. Falling back to epoll";
+    }
+
     threads_ = utils::GenerateFixedArray(config.threads, [&](std::size_t index) {
         const auto thread_name = fmt::format("{}_{}", config.thread_name, index);
-        return (use_ev_default_loop && index == 0) ? Thread(thread_name, Thread::kUseDefaultEvLoop)
-                                                   : Thread(thread_name);
+        const bool use_default_loop = use_ev_default_loop && index == 0;
+        if (use_io_uring) {
+            return use_default_loop ? Thread(thread_name, Thread::kUseDefaultEvLoop, Thread::kUseIoUring)
+                                    : Thread(thread_name, Thread::kUseIoUring);
+        }
+        return use_default_loop ? Thread(thread_name, Thread::kUseDefaultEvLoop) : Thread(thread_name);
     });
 
     default_controls_.controls = utils::GenerateFixedArray(threads_.size(), [this](std::size_t index) {
@@ -44,6 +55,11 @@ std::size_t ThreadPool::GetSize() const { return threads_.size(); }
 
 ThreadControl& ThreadPool::NextThread() { return default_controls_.Next(); }
 
+ThreadControl& ThreadPool::GetThread(std::size_t index) {
+    UASSERT(index < default_controls_.controls.size());
+    return default_controls_.controls[index];
+}
+
 TimerThreadControl& ThreadPool::NextTimerThread() { return timer_controls_.Next(); }
 
 ThreadControl& ThreadPool::GetEvDefaultLoopThread() {
@@ -28,6 +28,8 @@ public:
 
     ThreadControl& NextThread();
 
+    ThreadControl& GetThread(std::size_t index);
+
     TimerThreadControl& NextTimerThread();
 
     ThreadControl& GetEvDefaultLoopThread();
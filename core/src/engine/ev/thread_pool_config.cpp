@@ -8,6 +8,7 @@ ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<
     ThreadPoolConfig config;
     config.threads = value["threads"].As<std::size_t>(config.threads);
     config.thread_name = value["thread_name"].As<std::string>(config.thread_name);
+    config.io_uring = value["io_uring"].As<bool>(config.io_uring);
     return config;
 }
 
@@ -13,6 +13,7 @@ struct ThreadPoolConfig {
     std::size_t threads = 2;
     std::string thread_name = "event-worker";
     bool ev_default_loop_disabled = false;
+    bool io_uring = false;
 };
 
 ThreadPoolConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<ThreadPoolConfig>);
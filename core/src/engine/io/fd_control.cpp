@@ -59,6 +59,15 @@ Direction::SingleUserGuard::SingleUserGuard(Direction& dir) : dir_(dir) { dir_.p
 Direction::SingleUserGuard::~SingleUserGuard() { dir_.poller_.SwitchStateToReadyToUse(); }
 #endif  // #ifndef NDEBUG
 
+void Direction::CancelIoUring(int fd) noexcept {
+    UASSERT(fd_closed_);
+    if (!io_uring_in_flight_) return;
+
+    auto* io_uring = thread_control_.GetIoUring();
+    UASSERT(io_uring);
+    thread_control_.RunInEvLoopSync([io_uring, fd]() noexcept { io_uring->CancelFd(fd); });
+}
+
 // Write operations on socket usually do not block, so it makes sense to reuse
 // the same ThreadControl for the sake of better balancing of ev threads.
 FdControl::FdControl(const ev::ThreadControl& control) : read_(control), write_(control) {}
@@ -71,8 +80,10 @@ FdControl::~FdControl() {
     }
 }
 
-FdControlHolder FdControl::Adopt(int fd) {
-    FdControlHolder fd_control{new FdControl(current_task::GetEventThread())};
+FdControlHolder FdControl::Adopt(int fd) { return Adopt(fd, current_task::GetEventThread()); }
+
+FdControlHolder FdControl::Adopt(int fd, const ev::ThreadControl& control) {
+    FdControlHolder fd_control{new FdControl(control)};
     // TODO: add conditional CLOEXEC set
     SetCloexec(fd);
     SetNonblock(fd);
@@ -87,6 +98,8 @@ void FdControl::Close() {
     Invalidate();
 
     const auto fd = Fd();
+    read_.CancelIoUring(fd);
+    write_.CancelIoUring(fd);
     if (::close(fd) == -1) {
         const auto error_code = errno;
         std::error_code ec(error_code, std::system_category());
@@ -12,6 +12,8 @@
 #include <userver/logging/log.hpp>
 #include <userver/utils/assert.hpp>
 
+#include <engine/ev/io_uring.hpp>
+#include <engine/ev/thread_control.hpp>
 #include <engine/task/task_context.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 
@@ -99,24 +101,72 @@ public:
         const Context&... context
     );
 
+    // Whether the ev thread of this direction owns an io_uring
+    bool HasIoUring() const noexcept { return thread_control_.GetIoUring() != nullptr; }
+
+    // Same as PerformIo, but the operations that would block are submitted to
+    // the io_uring of the ev thread instead of waiting for fd readiness.
+    // Must be used only if HasIoUring().
+    template <typename IoFunc, typename... Context>
+    size_t PerformIoUring(
+        SingleUserGuard& guard,
+        IoFunc&& io_func,
+        ev::IoUringOperation::Type type,
+        void* buf,
+        size_t len,
+        TransferMode mode,
+        Deadline deadline,
+        const Context&... context
+    );
+
+    // Same as PerformIoV, the blocking part is done via IORING_OP_SENDMSG.
+    // Must be used only if HasIoUring().
+    template <typename IoFunc, typename... Context>
+    size_t PerformIoUringV(
+        SingleUserGuard& guard,
+        IoFunc&& io_func,
+        struct iovec* list,
+        std::size_t list_size,
+        TransferMode mode,
+        Deadline deadline,
+        const Context&... context
+    );
+
     engine::impl::ContextAccessor* TryGetContextAccessor() noexcept { return poller_.TryGetContextAccessor(); }
 
 private:
     friend class FdControl;
-    explicit Direction(const ev::ThreadControl& control) : poller_(control) {}
+    explicit Direction(const ev::ThreadControl& control) : poller_(control), thread_control_(control) {}
 
-    void Reset(int fd, Kind kind) { poller_.Reset(fd, kind); }
+    void Reset(int fd, Kind kind) {
+        poller_.Reset(fd, kind);
+        fd_closed_ = false;
+    }
 
     void WakeupWaiters() { poller_.WakeupWaiters(); }
 
     // does not notify
-    void Invalidate() { poller_.Invalidate(); }
+    void Invalidate() {
+        poller_.Invalidate();
+        fd_closed_ = true;
+    }
+
+    // Cancels the in-flight io_uring request, must be called after Invalidate()
+    // and before closing the fd
+    void CancelIoUring(int fd) noexcept;
 
     template <typename... Context>
     ErrorMode
     TryHandleError(int error_code, size_t processed_bytes, TransferMode mode, Deadline deadline, Context&... context);
 
+    // Returns the result of the syscall-like operation, sets errno on error
+    template <typename... Context>
+    ssize_t RunIoUring(ev::IoUringOperation& op, size_t processed_bytes, Deadline deadline, Context&... context);
+
     FdPoller poller_;
+    ev::ThreadControl thread_control_;
+    std::atomic<bool> fd_closed_{true};
+    std::atomic<bool> io_uring_in_flight_{false};
 };
 
 class FdControl final {
@@ -124,6 +174,9 @@ public:
     // fd will be silently forced to nonblocking mode
     static FdControlHolder Adopt(int fd);
 
+    // same as Adopt(int), but the fd is served by the specified ev thread
+    static FdControlHolder Adopt(int fd, const ev::ThreadControl& control);
+
     explicit FdControl(const ev::ThreadControl& control);
     ~FdControl();
 
@@ -273,6 +326,138 @@ size_t Direction::PerformIo(
     return pos - begin;
 }
 
+inline bool IsWouldBlock(int error_code) noexcept {
+    return error_code == EWOULDBLOCK
+#if EWOULDBLOCK != EAGAIN
+           || error_code == EAGAIN
+#endif
+        ;
+}
+
+template <typename... Context>
+ssize_t
+Direction::RunIoUring(ev::IoUringOperation& op, size_t processed_bytes, Deadline deadline, Context&... context) {
+    if (current_task::ShouldCancel()) {
+        throw(IoCancelled(/*bytes_transferred =*/processed_bytes) << ... << context);
+    }
+    if (deadline.IsReached()) {
+        throw(IoTimeout(/*bytes_transferred =*/processed_bytes) << ... << context);
+    }
+
+    // Pairs with the fd_closed_ store in Invalidate() and the
+    // io_uring_in_flight_ load in CancelIoUring()
+    io_uring_in_flight_ = true;
+    const auto result = op.Run(thread_control_, deadline);
+    io_uring_in_flight_ = false;
+
+    if (!result) {
+        if (current_task::ShouldCancel()) {
+            throw(IoCancelled(/*bytes_transferred =*/processed_bytes) << ... << context);
+        } else {
+            throw(IoTimeout(/*bytes_transferred =*/processed_bytes) << ... << context);
+        }
+    }
+    if (*result == -ECANCELED && !IsValid()) {
+        throw((IoException() << "Fd closed during ") << ... << context);
+    }
+    if (*result < 0) {
+        errno = -*result;
+        return -1;
+    }
+    return *result;
+}
+
+template <typename IoFunc, typename... Context>
+size_t Direction::PerformIoUring(
+    SingleUserGuard&,
+    IoFunc&& io_func,
+    ev::IoUringOperation::Type type,
+    void* buf,
+    size_t len,
+    TransferMode mode,
+    Deadline deadline,
+    const Context&... context
+) {
+    UASSERT(HasIoUring());
+    char* const begin = static_cast<char*>(buf);
+    char* const end = begin + len;
+
+    char* pos = begin;
+
+    while (pos < end) {
+        // Optimistic attempt first, it is cheaper than a round trip via the ring
+        // if the socket is ready
+        auto chunk_size = io_func(Fd(), pos, end - pos);
+        if (chunk_size < 0 && IsWouldBlock(errno)) {
+            if (pos != begin && mode != TransferMode::kWhole) {
+                break;
+            }
+            ev::IoUringOperation op(type, Fd(), pos, end - pos, fd_closed_);
+            chunk_size = RunIoUring(op, pos - begin, deadline, context...);
+        }
+
+        if (chunk_size > 0) {
+            pos += chunk_size;
+            if (mode == TransferMode::kOnce) {
+                break;
+            }
+        } else if (!chunk_size || TryHandleError(errno, pos - begin, mode, deadline, context...) == ErrorMode::kFatal) {
+            break;
+        }
+    }
+    return pos - begin;
+}
+
+template <typename IoFunc, typename... Context>
+size_t Direction::PerformIoUringV(
+    SingleUserGuard&,
+    IoFunc&& io_func,
+    struct iovec* list,
+    std::size_t list_size,
+    TransferMode mode,
+    Deadline deadline,
+    const Context&... context
+) {
+    UASSERT(HasIoUring());
+    UASSERT(list_size > 0);
+    UASSERT(list_size <= IOV_MAX);
+    std::size_t processed_bytes = 0;
+    do {
+        auto chunk_size = io_func(Fd(), list, list_size);
+        if (chunk_size < 0 && IsWouldBlock(errno)) {
+            if (processed_bytes != 0 && mode != TransferMode::kWhole) {
+                break;
+            }
+            ev::IoUringOperation op(Fd(), list, list_size, fd_closed_);
+            chunk_size = RunIoUring(op, processed_bytes, deadline, context...);
+        }
+
+        if (chunk_size > 0) {
+            processed_bytes += chunk_size;
+            if (mode == TransferMode::kOnce) {
+                break;
+            }
+            std::size_t offset = chunk_size;
+            while (list_size > 0) {
+                const std::size_t len = list->iov_len;
+                if (offset >= len) {
+                    ++list;
+                    offset -= len;
+                    --list_size;
+                    UASSERT(list_size != 0 || offset == 0);
+                } else {
+                    list->iov_len -= offset;
+                    list->iov_base = static_cast<char*>(list->iov_base) + offset;
+                    break;
+                }
+            }
+        } else if (!chunk_size || TryHandleError(errno, processed_bytes, mode, deadline, context...) == ErrorMode::kFatal) {
+            break;
+        }
+    } while (list_size != 0);
+    return processed_bytes;
+}
+
 }  // namespace engine::io::impl
 
 USERVER_NAMESPACE_END
@@ -26,8 +26,8 @@ namespace {
 constexpr size_t kMaxStackSizeVector = 32;
 
 // MAC_COMPAT: does not accept flags in type
-impl::FdControlHolder MakeSocket(AddrDomain domain, SocketType type) {
-    return impl::FdControl::Adopt(utils::CheckSyscallCustomException<IoSystemError>(
+int MakeSocketFd(AddrDomain domain, SocketType type) {
+    return utils::CheckSyscallCustomException<IoSystemError>(
         ::socket(
             static_cast<int>(domain),
 #ifdef SOCK_NONBLOCK
@@ -40,7 +40,7 @@ impl::FdControlHolder MakeSocket(AddrDomain domain, SocketType type) {
             /* protocol=*/0
         ),
         "creating socket"
-    ));
+    );
 }
 
 template <typename Format, typename... Args>
@@ -129,7 +129,14 @@ void FillIoSendData(const IoData* data, struct iovec* dst, std::size_t count) {
 
 }  // namespace
 
-Socket::Socket(AddrDomain domain, SocketType type) : domain_(domain), fd_control_(MakeSocket(domain, type)) {
+Socket::Socket(AddrDomain domain, SocketType type)
+    : Socket(impl::FdControl::Adopt(MakeSocketFd(domain, type)), domain) {}
+
+Socket::Socket(AddrDomain domain, SocketType type, ev::ThreadControl& ev_thread)
+    : Socket(impl::FdControl::Adopt(MakeSocketFd(domain, type), ev_thread), domain) {}
+
+Socket::Socket(impl::FdControlHolder fd_control, AddrDomain domain)
+    : domain_(domain), fd_control_(std::move(fd_control)) {
     SetReadableContextAccessor(fd_control_->Read().TryGetContextAccessor());
     SetWritableContextAccessor(fd_control_->Write().TryGetContextAccessor());
 }
@@ -240,6 +247,19 @@ size_t Socket::RecvSome(void* buf, size_t len, Deadline deadline) {
     auto& dir = fd_control_->Read();
     dir.ResetReady();
     impl::Direction::SingleUserGuard guard(dir);
+    if (dir.HasIoUring()) {
+        return dir.PerformIoUring(
+            guard,
+            &RecvWrapper,
+            ev::IoUringOperation::Type::kRecv,
+            buf,
+            len,
+            impl::TransferMode::kOnce,
+            deadline,
+            "RecvSome from ",
+            peername_
+        );
+    }
     return dir.PerformIo(
         guard, &RecvWrapper, buf, len, impl::TransferMode::kOnce, deadline, "RecvSome from ", peername_
     );
@@ -252,6 +272,19 @@ size_t Socket::RecvAll(void* buf, size_t len, Deadline deadline) {
     auto& dir = fd_control_->Read();
     dir.ResetReady();
     impl::Direction::SingleUserGuard guard(dir);
+    if (dir.HasIoUring()) {
+        return dir.PerformIoUring(
+            guard,
+            &RecvWrapper,
+            ev::IoUringOperation::Type::kRecv,
+            buf,
+            len,
+            impl::TransferMode::kWhole,
+            deadline,
+            "RecvAll from ",
+            peername_
+        );
+    }
     return dir.PerformIo(
         guard, &RecvWrapper, buf, len, impl::TransferMode::kWhole, deadline, "RecvAll from ", peername_
     );
@@ -307,6 +340,18 @@ size_t Socket::SendAll(const struct iovec* list, std::size_t list_size, Deadline
     auto& dir = fd_control_->Write();
     dir.ResetReady();
     impl::Direction::SingleUserGuard guard(dir);
+    if (dir.HasIoUring()) {
+        return dir.PerformIoUringV(
+            guard,
+            &writev,
+            const_cast<struct iovec*>(list),  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+            list_size,
+            impl::TransferMode::kWhole,
+            deadline,
+            "SendAll to ",
+            peername_
+        );
+    }
     return dir.PerformIoV(
         guard,
         &writev,
@@ -326,6 +371,19 @@ size_t Socket::SendAll(const void* buf, size_t len, Deadline deadline) {
     auto& dir = fd_control_->Write();
     dir.ResetReady();
     impl::Direction::SingleUserGuard guard(dir);
+    if (dir.HasIoUring()) {
+        return dir.PerformIoUring(
+            guard,
+            &SendWrapper,
+            ev::IoUringOperation::Type::kSend,
+            const_cast<void*>(buf),  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+            len,
+            impl::TransferMode::kWhole,
+            deadline,
+            "SendAll to ",
+            peername_
+        );
+    }
     return dir.PerformIo(
         guard,
         &SendWrapper,
@@ -382,7 +440,11 @@ size_t Socket::SendAllTo(const Sockaddr& dest_addr, const void* buf, size_t len,
     );
 }
 
-Socket Socket::Accept(Deadline deadline) {
+Socket Socket::Accept(Deadline deadline) { return AcceptImpl(deadline, nullptr); }
+
+Socket Socket::Accept(Deadline deadline, ev::ThreadControl& ev_thread) { return AcceptImpl(deadline, &ev_thread); }
+
+Socket Socket::AcceptImpl(Deadline deadline, ev::ThreadControl* ev_thread) {
     if (!IsValid()) {
         throw IoException("Attempt to Accept from closed socket");
     }
@@ -402,7 +464,8 @@ Socket Socket::Accept(Deadline deadline) {
 
         UASSERT(len <= buf.Capacity());
         if (fd != -1) {
-            auto peersock = Socket(fd);
+            auto peersock = ev_thread ? Socket(impl::FdControl::Adopt(fd, *ev_thread), AddrDomain::kUnspecified)
+                                      : Socket(fd);
             peersock.peername_ = buf;
             return peersock;
         }
@@ -23,6 +23,12 @@ namespace {
 
 constexpr auto kDeadlineMaxTime = std::chrono::seconds{60};
 
+engine::TaskProcessorPoolsConfig MakePoolsConfig(const benchmark::State& state) {
+    engine::TaskProcessorPoolsConfig config;
+    config.ev_io_uring = state.range(0) != 0;
+    return config;
+}
+
 }  // namespace
 
 void socket_send_all(benchmark::State& state) {
@@ -75,6 +81,35 @@ void socket_send_all_v(benchmark::State& state) {
 }
 BENCHMARK(socket_send_all_v);
 
+// Every read blocks, so this compares the epoll and io_uring wait paths
+void socket_ping_pong(benchmark::State& state) {
+    engine::RunStandalone(2, MakePoolsConfig(state), [&]() {
+        const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
+        internal::net::TcpListener listener;
+        auto [server, client] = listener.MakeSocketPair(test_deadline);
+        auto task_echo = engine::AsyncNoSpan(
+            [test_deadline](auto&& server) {
+                std::array<char, 128> buf = {};
+                for (;;) {
+                    const auto received = server.RecvSome(buf.data(), buf.size(), test_deadline);
+                    if (!received) break;
+                    [[maybe_unused]] auto sent = server.SendAll(buf.data(), received, test_deadline);
+                }
+            },
+            std::move(server)
+        );
+        std::array<char, 128> buf = {};
+        for ([[maybe_unused]] auto _ : state) {
+            auto transferred = client.SendAll("ping", 4, test_deadline);
+            transferred += client.RecvAll(buf.data(), 4, test_deadline);
+            benchmark::DoNotOptimize(transferred);
+        }
+        client.Close();
+        task_echo.Get();
+    });
+}
+BENCHMARK(socket_ping_pong)->ArgName("io_uring")->Arg(0)->Arg(1);
+
 [[maybe_unused]] void socket_send_all_v_range(benchmark::State& state) {
     engine::RunStandalone(2, [&]() {
         const auto test_deadline = Deadline::FromDuration(kDeadlineMaxTime);
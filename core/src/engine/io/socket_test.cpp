@@ -15,11 +15,14 @@
 #include <userver/engine/io/sockaddr.hpp>
 #include <userver/engine/io/socket.hpp>
 #include <userver/engine/mutex.hpp>
+#include <userver/engine/run_standalone.hpp>
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/wait_any.hpp>
 #include <userver/internal/net/net_listener.hpp>
 
+#include <engine/ev/io_uring.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace {
@@ -29,6 +32,12 @@ using Deadline = engine::Deadline;
 using TcpListener = internal::net::TcpListener;
 using UdpListener = internal::net::UdpListener;
 
+engine::TaskProcessorPoolsConfig MakeIoUringPoolsConfig() {
+    engine::TaskProcessorPoolsConfig config;
+    config.ev_io_uring = true;
+    return config;
+}
+
 }  // namespace
 
 UTEST(Socket, ConnectFail) {
@@ -483,4 +492,70 @@ UTEST(Socket, WriteALot) {
     }
 }
 
+TEST(Socket, IoUringRecvSend) {
+    if (!engine::ev::IoUring::IsSupported()) {
+        GTEST_SKIP() << "io_uring is not supported by the kernel";
+    }
+
+    engine::RunStandalone(2, MakeIoUringPoolsConfig(), [] {
+        const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+        TcpListener listener;
+        auto [server, client] = listener.MakeSocketPair(deadline);
+
+        auto echo_task = engine::AsyncNoSpan([&server = server, deadline] {
+            std::array<char, 16> buf{};
+            const auto received = server.RecvAll(buf.data(), 10, deadline);
+            EXPECT_EQ(received, 10);
+            EXPECT_EQ(server.SendAll(buf.data(), received, deadline), received);
+        });
+
+        EXPECT_EQ(client.SendAll("01234", 5, deadline), 5);
+        engine::SleepFor(std::chrono::milliseconds{10});
+        EXPECT_EQ(client.SendAll({{"567", 3}, {"89", 2}}, deadline), 5);
+
+        std::array<char, 16> buf{};
+        EXPECT_EQ(client.RecvAll(buf.data(), 10, deadline), 10);
+        EXPECT_EQ(std::string_view(buf.data(), 10), "0123456789");
+        echo_task.Get();
+    });
+}
+
+TEST(Socket, IoUringTimeoutAndCancel) {
+    if (!engine::ev::IoUring::IsSupported()) {
+        GTEST_SKIP() << "io_uring is not supported by the kernel";
+    }
+
+    engine::RunStandalone(2, MakeIoUringPoolsConfig(), [] {
+        const auto test_deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+        TcpListener listener;
+        auto [server, client] = listener.MakeSocketPair(test_deadline);
+
+        std::array<char, 16> buf{};
+        UEXPECT_THROW(
+            [[maybe_unused]] auto received =
+                server.RecvSome(buf.data(), buf.size(), Deadline::FromDuration(std::chrono::milliseconds{10})),
+            io::IoTimeout
+        );
+
+        auto recv_task = engine::AsyncNoSpan([&server = server, &buf, test_deadline] {
+            [[maybe_unused]] auto received = server.RecvSome(buf.data(), buf.size(), test_deadline);
+        });
+        engine::SleepFor(std::chrono::milliseconds{10});
+        recv_task.RequestCancel();
+        UEXPECT_THROW(recv_task.Get(), io::IoCancelled);
+
+        std::vector<char> big_buf(client.GetOption(SOL_SOCKET, SO_SNDBUF) * 16);
+        auto send_task = engine::AsyncNoSpan([&client = client, &big_buf, test_deadline] {
+            [[maybe_unused]] auto sent = client.SendAll(big_buf.data(), big_buf.size(), test_deadline);
+        });
+        engine::SleepFor(std::chrono::milliseconds{10});
+        send_task.RequestCancel();
+        UEXPECT_THROW(send_task.Get(), io::IoCancelled);
+
+        // The socket is still usable after the cancelled operations
+        EXPECT_EQ(client.SendAll("x", 1, test_deadline), 1);
+        EXPECT_GT(server.RecvSome(buf.data(), buf.size(), test_deadline), 0);
+    });
+}
+
 USERVER_NAMESPACE_END
@@ -2,6 +2,7 @@
 
 #include <array>
 #include <thread>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/impl/task_local_storage.hpp>
@@ -42,6 +43,46 @@ void async_comparisons_coro(benchmark::State& state) {
 }
 BENCHMARK(async_comparisons_coro)->RangeMultiplier(2)->Range(1, 32);
 
+void async_comparisons_non_suspending(benchmark::State& state) {
+    engine::RunStandalone(state.range(0), [&] {
+        std::uint64_t constructed_joined_count = 0;
+        for ([[maybe_unused]] auto _ : state) {
+            engine::NonSuspendingAsyncNoSpan([] {}).Wait();
+            ++constructed_joined_count;
+        }
+        benchmark::DoNotOptimize(constructed_joined_count);
+    });
+}
+BENCHMARK(async_comparisons_non_suspending)->RangeMultiplier(2)->Range(1, 32);
+
+// Fan-out of many tiny tasks, as in request handlers that split work
+template <bool NonSuspending>
+void async_fan_out(benchmark::State& state) {
+    engine::RunStandalone(4, [&] {
+        std::vector<engine::TaskWithResult<std::uint64_t>> tasks;
+        tasks.reserve(state.range(0));
+
+        for ([[maybe_unused]] auto _ : state) {
+            for (std::int64_t i = 0; i < state.range(0); ++i) {
+                auto payload = [i] { return static_cast<std::uint64_t>(i) * i; };
+                if constexpr (NonSuspending) {
+                    tasks.push_back(engine::NonSuspendingAsyncNoSpan(payload));
+                } else {
+                    tasks.push_back(engine::AsyncNoSpan(payload));
+                }
+            }
+
+            std::uint64_t sum = 0;
+            for (auto& task : tasks) sum += task.Get();
+            benchmark::DoNotOptimize(sum);
+            tasks.clear();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    });
+}
+BENCHMARK_TEMPLATE(async_fan_out, false)->RangeMultiplier(8)->Range(8, 4096);
+BENCHMARK_TEMPLATE(async_fan_out, true)->RangeMultiplier(8)->Range(8, 4096);
+
 void wrap_call_single(benchmark::State& state) {
     engine::RunStandalone([&] {
         for ([[maybe_unused]] auto _ : state) {
@@ -1,6 +1,7 @@
 #include <userver/utest/utest.hpp>
 
 #include <atomic>
+#include <vector>
 
 #include <userver/engine/async.hpp>
 #include <userver/engine/sleep.hpp>
@@ -235,6 +236,50 @@ UTEST(Async, Critical) {
     EXPECT_TRUE(task.Get());
 }
 
+UTEST(Async, NonSuspending) {
+    auto& parent = engine::current_task::GetCurrentTaskContext();
+    auto task = engine::NonSuspendingAsyncNoSpan(
+        [&parent](int x) {
+            EXPECT_FALSE(parent.IsCurrent());
+            // runs on the stack of the worker thread
+            EXPECT_FALSE(engine::current_task::GetCurrentTaskContext().GetCoroutinePtr());
+            return x * 2;
+        },
+        21
+    );
+    EXPECT_EQ(task.Get(), 42);
+
+    auto throwing_task = engine::NonSuspendingAsyncNoSpan([] { throw std::runtime_error("error"); });
+    UEXPECT_THROW(throwing_task.Get(), std::runtime_error);
+}
+
+UTEST(Async, NonSuspendingWaitsForFinishedTask) {
+    auto finished = engine::AsyncNoSpan([] { return 1; });
+    finished.Wait();
+
+    auto task = engine::NonSuspendingAsyncNoSpan([&finished] { return finished.Get() + 1; });
+    EXPECT_EQ(task.Get(), 2);
+}
+
+UTEST_MT(Async, NonSuspendingFanOut, 4) {
+    constexpr std::size_t kTasksCount = 1000;
+    std::atomic<std::size_t> performed{0};
+
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.reserve(kTasksCount);
+    for (std::size_t i = 0; i < kTasksCount; ++i) {
+        tasks.push_back(engine::NonSuspendingAsyncNoSpan([&performed] { ++performed; }));
+    }
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_EQ(performed.load(), kTasksCount);
+}
+
+UTEST_DEATH(AsyncDeathTest, NonSuspendingSleep) {
+    auto task = engine::NonSuspendingAsyncNoSpan([] { engine::SleepFor(std::chrono::milliseconds{1}); });
+    UEXPECT_DEATH(task.Get(), "attempted to suspend");
+}
+
 UTEST(Async, Emplace) {
     using namespace std::string_literals;
 
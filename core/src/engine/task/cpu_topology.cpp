@@ -0,0 +1,198 @@
+#include <engine/task/cpu_topology.hpp>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <tuple>
+
+#include <fmt/format.h>
+
+#include <userver/fs/blocking/read.hpp>
+#include <userver/logging/log.hpp>
+#include <userver/utils/assert.hpp>
+#include <userver/utils/from_string.hpp>
+#include <userver/utils/strerror.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+namespace {
+
+constexpr std::string_view kSysCpuPath = "/sys/devices/system/cpu";
+constexpr std::string_view kSysNodePath = "/sys/devices/system/node";
+
+std::vector<std::uint32_t> GetAllowedCpus() {
+    std::vector<std::uint32_t> result;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (::sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (std::uint32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) result.push_back(cpu);
+        }
+    }
+#endif
+    // MAC_COMPAT: no affinity masks
+    if (result.empty()) {
+        const auto count = std::max(1U, std::thread::hardware_concurrency());
+        for (std::uint32_t cpu = 0; cpu < count; ++cpu) result.push_back(cpu);
+    }
+    return result;
+}
+
+std::string ReadSysFile(const std::string& path) { return utils::text::Trim(fs::blocking::ReadFileContents(path)); }
+
+std::string_view TrimSpaces(std::string_view str) {
+    const auto begin = str.find_first_not_of(" \t\n");
+    if (begin == std::string_view::npos) return {};
+    return str.substr(begin, str.find_last_not_of(" \t\n") - begin + 1);
+}
+
+// Returns the raw NUMA node id for each CPU id, CPUs without a node are on node 0
+std::vector<std::uint32_t> ReadCpuNodes() {
+    std::vector<std::uint32_t> cpu_nodes;
+    const auto online_path = fmt::format("{}/online", kSysNodePath);
+    if (!fs::blocking::FileExists(online_path)) return cpu_nodes;
+
+    for (const auto node : ParseCpuList(ReadSysFile(online_path))) {
+        const auto cpus = ParseCpuList(ReadSysFile(fmt::format("{}/node{}/cpulist", kSysNodePath, node)));
+        for (const auto cpu : cpus) {
+            if (cpu >= cpu_nodes.size()) cpu_nodes.resize(cpu + 1, 0);
+            cpu_nodes[cpu] = node;
+        }
+    }
+    return cpu_nodes;
+}
+
+void ReadCacheDomains(CpuTopology::Cpu& cpu) {
+    cpu.l2_domain = cpu.id;
+    cpu.l3_domain = cpu.id;
+    for (std::size_t index = 0;; ++index) {
+        const auto cache_path = fmt::format("{}/cpu{}/cache/index{}", kSysCpuPath, cpu.id, index);
+        if (!fs::blocking::FileExists(cache_path + "/level")) break;
+
+        const auto level = utils::FromString<int>(ReadSysFile(cache_path + "/level"));
+        if (level != 2 && level != 3) continue;
+
+        const auto shared = ParseCpuList(ReadSysFile(cache_path + "/shared_cpu_list"));
+        if (shared.empty()) continue;
+        (level == 2 ? cpu.l2_domain : cpu.l3_domain) = *std::min_element(shared.begin(), shared.end());
+    }
+}
+
+std::vector<CpuTopology::Cpu> DetectCpus() {
+    const auto allowed = GetAllowedCpus();
+
+    std::vector<CpuTopology::Cpu> cpus;
+    cpus.reserve(allowed.size());
+    for (const auto id : allowed) {
+        cpus.push_back({id, 0, id, id});
+    }
+
+    try {
+        const auto cpu_nodes = ReadCpuNodes();
+        for (auto& cpu : cpus) {
+            if (cpu.id < cpu_nodes.size()) cpu.node = cpu_nodes[cpu.id];
+            ReadCacheDomains(cpu);
+        }
+    } catch (const std::exception& ex) {
+        LOG_WARNING() << "Failed to detect CPU topology, treating all the CPUs as equidistant: " << ex;
+        for (auto& cpu : cpus) {
+            cpu = {cpu.id, 0, cpu.id, cpu.id};
+        }
+    }
+
+    return cpus;
+}
+
+}  // namespace
+
+const CpuTopology& CpuTopology::Get() {
+    static const CpuTopology kTopology{DetectCpus()};
+    return kTopology;
+}
+
+CpuTopology::CpuTopology(std::vector<Cpu> cpus) : cpus_(std::move(cpus)) {
+    UINVARIANT(!cpus_.empty(), "CPU topology must contain at least one CPU");
+
+    // Make node indices dense, as they are used as indices of per-node data
+    std::vector<std::uint32_t> nodes;
+    for (const auto& cpu : cpus_) nodes.push_back(cpu.node);
+    std::sort(nodes.begin(), nodes.end());
+    nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    for (auto& cpu : cpus_) {
+        cpu.node = static_cast<std::uint32_t>(std::lower_bound(nodes.begin(), nodes.end(), cpu.node) - nodes.begin());
+    }
+    nodes_count_ = nodes.size();
+
+    std::sort(cpus_.begin(), cpus_.end(), [](const Cpu& lhs, const Cpu& rhs) {
+        return std::tie(lhs.node, lhs.l3_domain, lhs.l2_domain, lhs.id) <
+               std::tie(rhs.node, rhs.l3_domain, rhs.l2_domain, rhs.id);
+    });
+}
+
+const CpuTopology::Cpu& CpuTopology::GetWorkerCpu(std::size_t worker_index) const noexcept {
+    return cpus_[worker_index % cpus_.size()];
+}
+
+CpuTopology::Distance CpuTopology::GetDistance(const Cpu& lhs, const Cpu& rhs) noexcept {
+    if (lhs.node != rhs.node) return Distance::kRemoteNode;
+    if (lhs.l2_domain == rhs.l2_domain) return Distance::kSharedL2;
+    if (lhs.l3_domain == rhs.l3_domain) return Distance::kSharedL3;
+    return Distance::kSameNode;
+}
+
+std::size_t CpuTopology::GetCurrentNode() const noexcept {
+#ifdef __linux__
+    const int current_cpu = ::sched_getcpu();
+    if (current_cpu < 0) return 0;
+    for (const auto& cpu : cpus_) {
+        if (cpu.id == static_cast<std::uint32_t>(current_cpu)) return cpu.node;
+    }
+#endif
+    return 0;
+}
+
+std::vector<std::uint32_t> ParseCpuList(std::string_view cpu_list) {
+    std::vector<std::uint32_t> result;
+    while (!cpu_list.empty()) {
+        const auto comma_pos = cpu_list.find(',');
+        const auto range = TrimSpaces(cpu_list.substr(0, comma_pos));
+        cpu_list.remove_prefix(comma_pos == std::string_view::npos ? cpu_list.size() : comma_pos + 1);
+        if (range.empty()) continue;
+
+        const auto dash_pos = range.find('-');
+        const auto first = utils::FromString<std::uint32_t>(range.substr(0, dash_pos));
+        const auto last =
+            dash_pos == std::string_view::npos ? first : utils::FromString<std::uint32_t>(range.substr(dash_pos + 1));
+        if (last < first) {
+            throw std::runtime_error(fmt::format("Invalid CPU range '{}'", range));
+        }
+        for (auto cpu = first; cpu <= last; ++cpu) result.push_back(cpu);
+    }
+    return result;
+}
+
+void SetCurrentThreadCpuAffinity(std::uint32_t cpu) noexcept {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    const int res = ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+    if (res != 0) {
+        LOG_ERROR() << "Failed to pin the thread to CPU " << cpu << ": " << utils::strerror(res);
+    }
+#else
+    // MAC_COMPAT: no thread affinity
+    (void)cpu;
+#endif
+}
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine::impl {
+
+/// Cache and NUMA placement of the CPUs available to the process
+class CpuTopology final {
+public:
+    struct Cpu {
+        std::uint32_t id{0};
+        // Dense index of the NUMA node, in [0, GetNodesCount())
+        std::uint32_t node{0};
+        // Cache domains are identified by the smallest CPU id sharing the cache
+        std::uint32_t l3_domain{0};
+        std::uint32_t l2_domain{0};
+    };
+
+    /// How far the CPUs are from each other, in the order of stealing preference
+    enum class Distance : std::uint8_t {
+        kSharedL2,
+        kSharedL3,
+        kSameNode,
+        kRemoteNode,
+    };
+
+    static constexpr std::size_t kDistancesCount = 4;
+
+    /// Topology of the CPUs from the affinity mask of the process, detected once
+    static const CpuTopology& Get();
+
+    explicit CpuTopology(std::vector<Cpu> cpus);
+
+    /// CPUs ordered by node, then by L3 and L2 domains
+    const std::vector<Cpu>& GetCpus() const noexcept { return cpus_; }
+
+    std::size_t GetNodesCount() const noexcept { return nodes_count_; }
+
+    /// CPU to pin the worker with `worker_index` to, workers are placed
+    /// compactly so that neighbour workers share caches
+    const Cpu& GetWorkerCpu(std::size_t worker_index) const noexcept;
+
+    static Distance GetDistance(const Cpu& lhs, const Cpu& rhs) noexcept;
+
+    /// Node of the CPU the current thread runs on, 0 if it is unknown
+    std::size_t GetCurrentNode() const noexcept;
+
+private:
+    std::vector<Cpu> cpus_;
+    std::size_t nodes_count_{1};
+};
+
+/// Parses the Linux cpulist format, e.g. "0-3,8,10-11"
+std::vector<std::uint32_t> ParseCpuList(std::string_view cpu_list);
+
+/// Binds the current thread to a single CPU, logs an error on failure
+void SetCurrentThreadCpuAffinity(std::uint32_t cpu) noexcept;
+
+}  // namespace engine::impl
+
+USERVER_NAMESPACE_END
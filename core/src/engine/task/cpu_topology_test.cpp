@@ -0,0 +1,70 @@
+#include <engine/task/cpu_topology.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using engine::impl::CpuTopology;
+using Distance = CpuTopology::Distance;
+
+std::vector<std::uint32_t> GetIds(const CpuTopology& topology) {
+    std::vector<std::uint32_t> result;
+    for (const auto& cpu : topology.GetCpus()) result.push_back(cpu.id);
+    return result;
+}
+
+}  // namespace
+
+TEST(CpuTopology, ParseCpuList) {
+    using engine::impl::ParseCpuList;
+
+    EXPECT_THAT(ParseCpuList(""), testing::IsEmpty());
+    EXPECT_THAT(ParseCpuList("0"), testing::ElementsAre(0));
+    EXPECT_THAT(ParseCpuList("0-3\n"), testing::ElementsAre(0, 1, 2, 3));
+    EXPECT_THAT(ParseCpuList("0-1,8,10-11"), testing::ElementsAre(0, 1, 8, 10, 11));
+    EXPECT_ANY_THROW(ParseCpuList("3-1"));
+    EXPECT_ANY_THROW(ParseCpuList("a"));
+}
+
+TEST(CpuTopology, Order) {
+    // 2 nodes with raw ids 1 and 3, SMT siblings are N and N + 4
+    const CpuTopology topology{{
+        {0, 1, 0, 0},
+        {1, 1, 0, 1},
+        {2, 3, 2, 2},
+        {3, 3, 2, 3},
+        {4, 1, 0, 0},
+        {5, 1, 0, 1},
+        {6, 3, 2, 2},
+        {7, 3, 2, 3},
+    }};
+
+    EXPECT_EQ(topology.GetNodesCount(), 2);
+    EXPECT_THAT(GetIds(topology), testing::ElementsAre(0, 4, 1, 5, 2, 6, 3, 7));
+    EXPECT_EQ(topology.GetWorkerCpu(0).node, 0);
+    EXPECT_EQ(topology.GetWorkerCpu(4).node, 1);
+    EXPECT_EQ(topology.GetWorkerCpu(9).id, 4);
+}
+
+TEST(CpuTopology, Distance) {
+    const CpuTopology::Cpu cpu{0, 0, 0, 0};
+
+    EXPECT_EQ(CpuTopology::GetDistance(cpu, {1, 0, 0, 0}), Distance::kSharedL2);
+    EXPECT_EQ(CpuTopology::GetDistance(cpu, {2, 0, 0, 2}), Distance::kSharedL3);
+    EXPECT_EQ(CpuTopology::GetDistance(cpu, {3, 0, 3, 3}), Distance::kSameNode);
+    EXPECT_EQ(CpuTopology::GetDistance(cpu, {4, 1, 0, 0}), Distance::kRemoteNode);
+}
+
+TEST(CpuTopology, Detect) {
+    const auto& topology = CpuTopology::Get();
+    EXPECT_FALSE(topology.GetCpus().empty());
+    EXPECT_GE(topology.GetNodesCount(), 1);
+    for (const auto& cpu : topology.GetCpus()) {
+        EXPECT_LT(cpu.node, topology.GetNodesCount());
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,30 @@
+#include <engine/task/deadline_task_queue.hpp>
+
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+void DeadlineTaskQueue::Push(impl::TaskContext* context, Deadline deadline) {
+    UASSERT(context);
+    UASSERT(deadline.IsReachable());
+
+    const std::lock_guard lock{mutex_};
+    items_.push(Item{deadline, next_order_++, context});
+    size_.store(items_.size(), std::memory_order_relaxed);
+}
+
+impl::TaskContext* DeadlineTaskQueue::TryPop() {
+    const std::lock_guard lock{mutex_};
+    if (items_.empty()) return nullptr;
+
+    auto* const context = items_.top().context;
+    items_.pop();
+    size_.store(items_.size(), std::memory_order_relaxed);
+    return context;
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+#include <userver/engine/deadline.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace impl {
+class TaskContext;
+}  // namespace impl
+
+/// Earliest deadline first queue of tasks, tasks with equal deadlines are
+/// popped in FIFO order
+class DeadlineTaskQueue final {
+public:
+    void Push(impl::TaskContext* context, Deadline deadline);
+
+    // Returns nullptr if the queue is empty
+    impl::TaskContext* TryPop();
+
+    std::size_t GetSizeApproximate() const noexcept { return size_.load(std::memory_order_relaxed); }
+
+private:
+    struct Item final {
+        Deadline deadline;
+        std::uint64_t order;
+        impl::TaskContext* context;
+    };
+
+    struct Later final {
+        bool operator()(const Item& lhs, const Item& rhs) const noexcept {
+            if (lhs.deadline == rhs.deadline) return lhs.order > rhs.order;
+            return rhs.deadline < lhs.deadline;
+        }
+    };
+
+    std::mutex mutex_;
+    std::priority_queue<Item, std::vector<Item>, Later> items_;
+    std::uint64_t next_order_{0};
+    std::atomic<std::size_t> size_{0};
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
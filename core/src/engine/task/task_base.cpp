@@ -10,6 +10,8 @@
 #include <userver/engine/async.hpp>
 #include <userver/engine/impl/task_context_holder.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/stack_size.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/utils/assert.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -149,12 +151,39 @@ bool IsTaskProcessorThread() noexcept { return GetCurrentTaskContextUnchecked()
 
 TaskProcessor& GetTaskProcessor() { return GetCurrentTaskContext().GetTaskProcessor(); }
 
-std::size_t GetStackSize() { return GetTaskProcessor().GetTaskProcessorPools()->GetCoroPool().GetStackSize(); }
+std::size_t GetStackSize() {
+    auto& context = GetCurrentTaskContext();
+    return context.GetTaskProcessor().GetTaskProcessorPools()->GetCoroPool().GetStackSize(context.GetStackSize());
+}
 
 ev::ThreadControl& GetEventThread() { return GetTaskProcessor().EventThreadPool().NextThread(); }
 
+TaskPriority GetPriority() noexcept { return GetCurrentTaskContext().GetPriority(); }
+
+void SetPriority(TaskPriority priority) noexcept { GetCurrentTaskContext().SetPriority(priority); }
+
 }  // namespace current_task
 
+TaskPriorityScope::TaskPriorityScope(TaskPriority priority)
+    : context_(current_task::GetCurrentTaskContext()), old_priority_(context_.GetPriority()) {
+    context_.SetPriority(priority);
+}
+
+TaskPriorityScope::~TaskPriorityScope() {
+    UASSERT(context_.IsCurrent());
+    context_.SetPriority(old_priority_);
+}
+
+StackSizeScope::StackSizeScope(StackSize stack_size)
+    : context_(current_task::GetCurrentTaskContext()), old_stack_size_(context_.GetNewTasksStackSize()) {
+    context_.SetNewTasksStackSize(stack_size);
+}
+
+StackSizeScope::~StackSizeScope() {
+    UASSERT(context_.IsCurrent());
+    context_.SetNewTasksStackSize(old_stack_size_);
+}
+
 namespace impl {
 
 std::uint64_t GetCreatedTaskCount(TaskProcessor& task_processor) {
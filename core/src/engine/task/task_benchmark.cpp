@@ -1,12 +1,15 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <concurrent/impl/latch.hpp>
 #include <engine/impl/standalone.hpp>
@@ -18,6 +21,7 @@
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
 #include <userver/engine/task/single_threaded_task_processors_pool.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <utils/impl/parallelize_benchmark.hpp>
 
@@ -194,4 +198,64 @@ void engine_tasks_from_another_task_processor(benchmark::State& state) {
 }
 BENCHMARK(engine_tasks_from_another_task_processor)->RangeMultiplier(2)->Range(2, 32)->Arg(6)->Arg(12);
 
+// Measures the latency of short high priority tasks on a task processor
+// saturated by bulk low priority tasks. Tail latency is reported in counters.
+void engine_task_priority_mixed_load(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        engine::TaskProcessorConfig proc_config;
+        proc_config.name = "benchmark";
+        proc_config.thread_name = "benchmark";
+        proc_config.worker_threads = 2;
+        proc_config.task_priorities = state.range(0) != 0;
+        engine::TaskProcessor task_processor(
+            std::move(proc_config), engine::current_task::GetTaskProcessor().GetTaskProcessorPools()
+        );
+
+        constexpr std::size_t kBulkTasksCount = 64;
+        constexpr int kBulkWorkIterations = 2000;
+
+        std::atomic<bool> keep_running{true};
+        std::vector<engine::TaskWithResult<void>> bulk_tasks;
+        bulk_tasks.reserve(kBulkTasksCount);
+        {
+            const engine::TaskPriorityScope low_priority{engine::TaskPriority::kLow};
+            for (std::size_t i = 0; i < kBulkTasksCount; ++i) {
+                bulk_tasks.push_back(engine::AsyncNoSpan(task_processor, [&keep_running] {
+                    while (keep_running) {
+                        for (int j = 0; j < kBulkWorkIterations; ++j) {
+                            benchmark::DoNotOptimize(j);
+                        }
+                        engine::Yield();
+                    }
+                }));
+            }
+        }
+
+        const engine::TaskPriorityScope high_priority{engine::TaskPriority::kHigh};
+        std::vector<std::chrono::steady_clock::duration> latencies;
+        for ([[maybe_unused]] auto _ : state) {
+            const auto start = std::chrono::steady_clock::now();
+            engine::AsyncNoSpan(task_processor, [] {}).Wait();
+            latencies.push_back(std::chrono::steady_clock::now() - start);
+        }
+
+        keep_running = false;
+        for (auto& task : bulk_tasks) {
+            task.Wait();
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+        const auto percentile_us = [&latencies](double percentile) {
+            const auto index = static_cast<std::size_t>(percentile / 100 * (latencies.size() - 1));
+            return std::chrono::duration<double, std::micro>(latencies[index]).count();
+        };
+        if (!latencies.empty()) {
+            state.counters["p50_us"] = percentile_us(50);
+            state.counters["p99_us"] = percentile_us(99);
+            state.counters["p99.9_us"] = percentile_us(99.9);
+        }
+    });
+}
+BENCHMARK(engine_task_priority_mixed_load)->ArgName("priorities")->Arg(0)->Arg(1);
+
 USERVER_NAMESPACE_END
@@ -75,6 +75,11 @@ namespace {
 
 auto ReadableTaskId(const TaskContext* task) noexcept { return logging::HexShort(task ? task->GetTaskId() : 0); }
 
+StackSize GetStackSizeForNewTask() noexcept {
+    auto* const parent = current_task::GetCurrentTaskContextUnchecked();
+    return parent ? parent->GetNewTasksStackSize() : StackSize::kDefault;
+}
+
 class CurrentTaskScope final {
 public:
     explicit CurrentTaskScope(TaskContext& context, EhGlobals& eh_store) : eh_store_(eh_store) {
@@ -105,18 +110,25 @@ TaskContext::TaskContext(
     Task::Importance importance,
     Task::WaitMode wait_type,
     Deadline deadline,
+    bool non_suspending,
     utils::impl::WrappedCallBase& payload
 )
     : task_processor_(task_processor),
       task_counter_token_(task_processor_.GetTaskCounter()),
       is_critical_(importance == Task::Importance::kCritical),
+      is_non_suspending_(non_suspending),
+      stack_size_(GetStackSizeForNewTask()),
       payload_(&payload),
       finish_waiters_(wait_type),
       cancel_deadline_(deadline),
       trace_csw_left_(task_processor_.GetTaskTraceMaxCswForNewTask()) {
     UASSERT(payload_);
-    LOG_TRACE() << "task with task_id=" << ReadableTaskId(current_task::GetCurrentTaskContextUnchecked())
-                << " created task with task_id=" << ReadableTaskId(this) << logging::LogExtra::Stacktrace();
+    auto* const parent = current_task::GetCurrentTaskContextUnchecked();
+    if (parent) {
+        priority_.store(parent->GetPriority(), std::memory_order_relaxed);
+    }
+    LOG_TRACE() << "task with task_id=" << ReadableTaskId(parent) << " created task with task_id="
+                << ReadableTaskId(this) << logging::LogExtra::Stacktrace();
 
     TsanReleaseBarrier();
 }
@@ -193,8 +205,11 @@ void TaskContext::DoStep() {
     if (IsFinished()) return;
 
     SleepState::Flags clear_flags{SleepFlags::kSleeping};
-    if (!coro_) {
-        coro_ = task_processor_.GetCoroutine();
+    if (is_non_suspending_) {
+        // The task never sleeps, so DoStep is only called once
+        clear_flags |= SleepFlags::kWakeupByBootstrap;
+    } else if (!coro_) {
+        coro_ = task_processor_.GetCoroutine(stack_size_);
         clear_flags |= SleepFlags::kWakeupByBootstrap;
         ArmCancellationTimer();
     }
@@ -206,9 +221,17 @@ void TaskContext::DoStep() {
         CurrentTaskScope current_task_scope(*this, eh_globals_);
         try {
             SetState(Task::State::kRunning);
-            auto& coro_ref = *coro_;
-            TsanAcquireBarrier();
-            coro_ref(this);
+            if (is_non_suspending_) {
+                // No coroutine stack and no context switch, the payload runs on
+                // the stack of the worker thread
+                TsanAcquireBarrier();
+                yield_reason_ = YieldReason::kNone;
+                RunPayload();
+            } else {
+                auto& coro_ref = *coro_;
+                TsanAcquireBarrier();
+                coro_ref(this);
+            }
         } catch (...) {
             uncaught = std::current_exception();
         }
@@ -282,6 +305,16 @@ void TaskContext::SetBackground(bool is_background) {
     is_background_ = is_background;
 }
 
+void TaskContext::SetPriority(TaskPriority priority) noexcept {
+    UASSERT(IsCurrent());
+    priority_.store(priority, std::memory_order_relaxed);
+}
+
+void TaskContext::SetNewTasksStackSize(StackSize stack_size) noexcept {
+    UASSERT(IsCurrent());
+    new_tasks_stack_size_ = stack_size;
+}
+
 TaskContext::WakeupSource TaskContext::Sleep(WaitStrategy& wait_strategy, Deadline deadline) {
     UASSERT(IsCurrent());
     UASSERT(state_ == Task::State::kRunning);
@@ -311,6 +344,13 @@ TaskContext::WakeupSource TaskContext::Sleep(WaitStrategy& wait_strategy, Deadli
     const bool has_deadline = deadline.IsReachable() && (!IsCancellable() || deadline < cancel_deadline_);
     if (has_deadline) ArmDeadlineTimer(deadline, sleep_epoch);
 
+    if (is_non_suspending_) {
+        utils::impl::AbortWithStacktrace(
+            "A task started via NonSuspendingAsyncNoSpan attempted to suspend. Such tasks run on the stack "
+            "of the worker thread and must not wait for anything, use AsyncNoSpan instead"
+        );
+    }
+
     yield_reason_ = YieldReason::kTaskWaiting;
     UASSERT(task_pipe_);
     TraceStateTransition(Task::State::kSuspended);
@@ -461,46 +501,50 @@ void TaskContext::CoroFunc(TaskPipe& task_pipe) {
         context->yield_reason_ = YieldReason::kNone;
         context->task_pipe_ = &task_pipe;
 
-        context->ProfilerStartExecution();
+        context->RunPayload();
 
-        // We only let tasks ran with CriticalAsync enter function body, others
-        // get terminated ASAP.
-        if (context->IsCancelRequested() && !context->WasStartedAsCritical()) {
-            context->SetCancellable(false);
-            // It is important to destroy payload here as someone may want
-            // to synchronize in its dtor (e.g. lambda closure).
+        context->task_pipe_ = nullptr;
+        context->TsanAcquireBarrier();
+    }
+}
+
+void TaskContext::RunPayload() {
+    ProfilerStartExecution();
+
+    // We only let tasks ran with CriticalAsync enter function body, others
+    // get terminated ASAP.
+    if (IsCancelRequested() && !WasStartedAsCritical()) {
+        SetCancellable(false);
+        // It is important to destroy payload here as someone may want
+        // to synchronize in its dtor (e.g. lambda closure).
+        {
+            LocalStorageGuard local_storage_guard(*this);
+            ResetPayload();
+        }
+        yield_reason_ = YieldReason::kTaskCancelled;
+    } else {
+        try {
             {
-                LocalStorageGuard local_storage_guard(*context);
-                context->ResetPayload();
-            }
-            context->yield_reason_ = YieldReason::kTaskCancelled;
-        } else {
-            try {
-                {
-                    // Destroy contents of LocalStorage in the coroutine
-                    // as dtors may want to schedule
-                    LocalStorageGuard local_storage_guard(*context);
-
-                    context->TraceStateTransition(Task::State::kRunning);
-                    context->payload_->Perform();
-                }
-                context->yield_reason_ = YieldReason::kTaskComplete;
-            } catch (const CoroUnwinder&) {
-                context->yield_reason_ = YieldReason::kTaskCancelled;
-            } catch (...) {
-                utils::impl::AbortWithStacktrace(
-                    "An exception that is not derived from std::exception has been "
-                    "thrown: " +
-                    boost::current_exception_diagnostic_information() + " Such exceptions are not supported by userver."
-                );
+                // Destroy contents of LocalStorage in the coroutine
+                // as dtors may want to schedule
+                LocalStorageGuard local_storage_guard(*this);
+
+                TraceStateTransition(Task::State::kRunning);
+                payload_->Perform();
             }
+            yield_reason_ = YieldReason::kTaskComplete;
+        } catch (const CoroUnwinder&) {
+            yield_reason_ = YieldReason::kTaskCancelled;
+        } catch (...) {
+            utils::impl::AbortWithStacktrace(
+                "An exception that is not derived from std::exception has been "
+                "thrown: " +
+                boost::current_exception_diagnostic_information() + " Such exceptions are not supported by userver."
+            );
         }
-
-        context->ProfilerStopExecution();
-
-        context->task_pipe_ = nullptr;
-        context->TsanAcquireBarrier();
     }
+
+    ProfilerStopExecution();
 }
 
 void TaskContext::SetCancelDeadline(Deadline deadline) {
@@ -23,7 +23,9 @@
 #include <userver/engine/impl/task_local_storage.hpp>
 #include <userver/engine/impl/wait_list_fwd.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/stack_size.hpp>
 #include <userver/engine/task/task.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/utils/flags.hpp>
 #include <userver/utils/impl/wrapped_call_base.hpp>
@@ -80,7 +82,14 @@ public:
         kBootstrap = static_cast<uint32_t>(SleepFlags::kWakeupByBootstrap),
     };
 
-    TaskContext(TaskProcessor&, Task::Importance, Task::WaitMode, Deadline, utils::impl::WrappedCallBase& payload);
+    TaskContext(
+        TaskProcessor&,
+        Task::Importance,
+        Task::WaitMode,
+        Deadline,
+        bool non_suspending,
+        utils::impl::WrappedCallBase& payload
+    );
 
     ~TaskContext() noexcept;
 
@@ -134,6 +143,16 @@ public:
     void SetBackground(bool);
     bool IsBackground() const noexcept { return is_background_; };
 
+    // may be read by the task processor queue from any thread
+    TaskPriority GetPriority() const noexcept { return priority_.load(std::memory_order_relaxed); }
+
+    StackSize GetStackSize() const noexcept { return stack_size_; }
+    // stack size of the tasks started by this task, must only be used from this context
+    StackSize GetNewTasksStackSize() const noexcept { return new_tasks_stack_size_; }
+    void SetNewTasksStackSize(StackSize stack_size) noexcept;
+    // must only be called from this context
+    void SetPriority(TaskPriority) noexcept;
+
     // causes this to yield and wait for wakeup
     // must only be called from this context
     // "spurious wakeups" may be caused by wakeup queueing
@@ -160,6 +179,7 @@ public:
     void SetQueueWaitTimepoint(std::chrono::steady_clock::time_point tp) { task_queue_wait_timepoint_ = tp; }
 
     void SetCancelDeadline(Deadline deadline);
+    Deadline GetCancelDeadline() const noexcept { return cancel_deadline_; }
 
     bool HasLocalStorage() const noexcept;
     task_local::Storage& GetLocalStorage() noexcept;
@@ -192,6 +212,9 @@ private:
     bool WasStartedAsCritical() const;
     void SetState(Task::State);
 
+    // runs the payload and sets yield_reason_, either in a coroutine or inline
+    void RunPayload();
+
     void Schedule();
     static bool ShouldSchedule(SleepState::Flags flags, WakeupSource source);
 
@@ -207,8 +230,13 @@ private:
     TaskProcessor& task_processor_;
     TaskCounter::Token task_counter_token_;
     const bool is_critical_;
+    // runs without a coroutine, see engine::NonSuspendingAsyncNoSpan
+    const bool is_non_suspending_;
     bool is_cancellable_{true};
     bool is_background_{false};
+    std::atomic<TaskPriority> priority_{TaskPriority::kNormal};
+    const StackSize stack_size_;
+    StackSize new_tasks_stack_size_{StackSize::kDefault};
     bool within_sleep_{false};
     EhGlobals eh_globals_;
 
@@ -16,6 +16,7 @@
 #include <utils/statistics/thread_statistics.hpp>
 
 #include <engine/task/counted_coroutine_ptr.hpp>
+#include <engine/task/cpu_topology.hpp>
 #include <engine/task/task_context.hpp>
 #include <engine/task/task_processor_pools.hpp>
 
@@ -172,12 +173,21 @@ void TaskProcessor::Adopt(impl::TaskContext& context) { detached_contexts_->Add(
 
 ev::ThreadPool& TaskProcessor::EventThreadPool() { return pools_->EventThreadPool(); }
 
-impl::CountedCoroutinePtr TaskProcessor::GetCoroutine() { return {pools_->GetCoroPool().GetCoroutine(), *this}; }
+impl::CountedCoroutinePtr TaskProcessor::GetCoroutine(StackSize stack_size) {
+    return {pools_->GetCoroPool().GetCoroutine(stack_size), *this};
+}
 
 std::size_t TaskProcessor::GetTaskQueueSize() const {
     return std::visit([](auto&& arg) { return arg.GetSizeApproximate(); }, task_queue_);
 }
 
+std::optional<WorkerParkingStats> TaskProcessor::GetWorkerParkingStats() const {
+    if (!config_.adaptive_spinning) return std::nullopt;
+    return std::visit(
+        [](auto&& arg) -> std::optional<WorkerParkingStats> { return arg.GetWorkerParkingStats(); }, task_queue_
+    );
+}
+
 void TaskProcessor::SetSettings(const TaskProcessorSettings& settings) {
     sensor_task_queue_wait_time_ = settings.sensor_wait_queue_time_limit;
 
@@ -284,6 +294,10 @@ void TaskProcessor::PrepareWorkerThread(std::size_t index) noexcept {
             break;
     }
 
+    if (config_.pin_worker_threads) {
+        impl::SetCurrentThreadCpuAffinity(impl::CpuTopology::Get().GetWorkerCpu(index).id);
+    }
+
     std::visit([index](auto& obj) { obj.PrepareWorker(index); }, task_queue_);
 
     pools_->GetCoroPool().PrepareLocalCache();
@@ -315,7 +329,7 @@ void TaskProcessor::ProcessTasks() noexcept {
             has_failed = true;
         }
 
-        pools_->GetCoroPool().AccountStackUsage();
+        pools_->GetCoroPool().AccountStackUsage(context->GetStackSize());
 
         if (has_failed || context->IsFinished()) {
             context->FinishDetached();
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <variant>
 #include <vector>
@@ -16,6 +17,7 @@
 #include <engine/task/work_stealing_queue/task_queue.hpp>
 #include <userver/concurrent/impl/interference_shield.hpp>
 #include <userver/engine/impl/detached_tasks_sync_block.hpp>
+#include <userver/engine/task/stack_size.hpp>
 #include <userver/logging/logger.hpp>
 #include <utils/statistics/thread_statistics.hpp>
 
@@ -44,7 +46,7 @@ public:
 
     void Adopt(impl::TaskContext& context);
 
-    impl::CountedCoroutinePtr GetCoroutine();
+    impl::CountedCoroutinePtr GetCoroutine(StackSize stack_size);
 
     ev::ThreadPool& EventThreadPool();
 
@@ -58,6 +60,10 @@ public:
 
     std::size_t GetTaskQueueSize() const;
 
+    // std::nullopt if the task queue does not use WorkerSemaphore or
+    // adaptive-spinning is off
+    std::optional<WorkerParkingStats> GetWorkerParkingStats() const;
+
     std::size_t GetWorkerCount() const { return workers_.size(); }
 
     void SetSettings(const TaskProcessorSettings& settings);
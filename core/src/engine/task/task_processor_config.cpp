@@ -62,7 +62,26 @@ TaskProcessorConfig Parse(const yaml_config::YamlConfig& value, formats::parse::
     config.thread_name = value["thread_name"].As<std::string>({});
     config.os_scheduling = value["os-scheduling"].As<OsScheduling>(config.os_scheduling);
     config.spinning_iterations = value["spinning-iterations"].As<int>(config.spinning_iterations);
+    config.adaptive_spinning = value["adaptive-spinning"].As<bool>(config.adaptive_spinning);
     config.task_processor_queue = value["task-processor-queue"].As<TaskQueueType>(config.task_processor_queue);
+    config.pin_worker_threads = value["pin-worker-threads"].As<bool>(config.pin_worker_threads);
+    config.task_priorities = value["task-priorities"].As<bool>(config.task_priorities);
+    config.deadline_scheduling = value["deadline-scheduling"].As<bool>(config.deadline_scheduling);
+    if (config.deadline_scheduling && config.task_processor_queue != TaskQueueType::kGlobalTaskQueue) {
+        throw std::runtime_error(fmt::format(
+            "deadline-scheduling is only supported by the global-task-queue, "
+            "see task-processor-queue option of {}",
+            value.GetPath()
+        ));
+    }
+
+    if (config.adaptive_spinning && config.task_processor_queue != TaskQueueType::kGlobalTaskQueue) {
+        throw std::runtime_error(fmt::format(
+            "adaptive-spinning is only supported by the global-task-queue, "
+            "see task-processor-queue option of {}",
+            value.GetPath()
+        ));
+    }
 
     const auto task_trace = value["task-trace"];
     if (!task_trace.IsMissing()) {
@@ -32,7 +32,11 @@ struct TaskProcessorConfig {
     std::string thread_name;
     OsScheduling os_scheduling{OsScheduling::kNormal};
     int spinning_iterations{1000};
+    bool adaptive_spinning{false};
     TaskQueueType task_processor_queue{TaskQueueType::kGlobalTaskQueue};
+    bool pin_worker_threads{false};
+    bool task_priorities{false};
+    bool deadline_scheduling{false};
 
     std::size_t task_trace_every{1000};
     std::size_t task_trace_max_csw{0};
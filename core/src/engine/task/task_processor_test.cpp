@@ -1,15 +1,47 @@
 #include <engine/task/task_processor.hpp>
 
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include <engine/task/task_processor_config.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/run_standalone.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/task_base.hpp>
+#include <userver/engine/task/task_priority.hpp>
 #include <userver/engine/task/task_with_result.hpp>
 #include <userver/utest/utest.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
+namespace {
+
+engine::TaskProcessor MakeSingleThreadedTaskProcessor(engine::TaskProcessorConfig config) {
+    config.name = "single-threaded";
+    config.thread_name = "single-threaded";
+    config.worker_threads = 1;
+    return engine::TaskProcessor(std::move(config), engine::current_task::GetTaskProcessor().GetTaskProcessorPools());
+}
+
+// Occupies the only worker of `task_processor` until the returned flag is set
+engine::TaskWithResult<void> BlockWorker(engine::TaskProcessor& task_processor, std::atomic<bool>& release) {
+    std::atomic<bool> started{false};
+    auto task = engine::AsyncNoSpan(task_processor, [&started, &release] {
+        started = true;
+        while (!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    while (!started) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return task;
+}
+
+}  // namespace
+
 UTEST(TaskProcessor, Overload) {
     engine::TaskProcessorSettings settings;
     settings.overload_action = engine::TaskProcessorSettings::OverloadAction::kCancel;
@@ -48,6 +80,84 @@ UTEST(TaskProcessor, Overload) {
     }
 }
 
+UTEST(TaskProcessor, PriorityIsInherited) {
+    EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kNormal);
+    {
+        const engine::TaskPriorityScope scope{engine::TaskPriority::kLow};
+        EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kLow);
+
+        auto task = engine::AsyncNoSpan([] { return engine::current_task::GetPriority(); });
+        EXPECT_EQ(task.Get(), engine::TaskPriority::kLow);
+    }
+    EXPECT_EQ(engine::current_task::GetPriority(), engine::TaskPriority::kNormal);
+}
+
+UTEST(TaskProcessor, HigherPriorityFirst) {
+    engine::TaskProcessorConfig config;
+    config.task_priorities = true;
+    auto task_processor = MakeSingleThreadedTaskProcessor(std::move(config));
+
+    std::atomic<bool> release{false};
+    auto blocker = BlockWorker(task_processor, release);
+
+    std::mutex mutex;
+    std::vector<engine::TaskPriority> order;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    using P = engine::TaskPriority;
+    for (const auto priority : {P::kLow, P::kNormal, P::kHigh}) {
+        const engine::TaskPriorityScope scope{priority};
+        for (int i = 0; i < 3; ++i) {
+            tasks.push_back(engine::AsyncNoSpan(task_processor, [&] {
+                const std::lock_guard lock{mutex};
+                order.push_back(engine::current_task::GetPriority());
+            }));
+        }
+    }
+
+    release = true;
+    blocker.Get();
+    for (auto& task : tasks) task.Get();
+
+    EXPECT_EQ(
+        order,
+        (std::vector<P>{P::kHigh, P::kHigh, P::kHigh, P::kNormal, P::kNormal, P::kNormal, P::kLow, P::kLow, P::kLow})
+    );
+}
+
+UTEST(TaskProcessor, EarliestDeadlineFirst) {
+    engine::TaskProcessorConfig config;
+    config.deadline_scheduling = true;
+    auto task_processor = MakeSingleThreadedTaskProcessor(std::move(config));
+
+    std::atomic<bool> release{false};
+    auto blocker = BlockWorker(task_processor, release);
+
+    constexpr int kTasksCount = 5;
+    const auto base = std::chrono::steady_clock::now() + std::chrono::minutes{1};
+
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<engine::TaskWithResult<void>> tasks;
+    tasks.push_back(engine::AsyncNoSpan(task_processor, [&] {
+        const std::lock_guard lock{mutex};
+        order.push_back(-1);
+    }));
+    for (int i = kTasksCount - 1; i >= 0; --i) {
+        const auto deadline = engine::Deadline::FromTimePoint(base + std::chrono::milliseconds{i});
+        tasks.push_back(engine::AsyncNoSpan(task_processor, deadline, [&, i] {
+            const std::lock_guard lock{mutex};
+            order.push_back(i);
+        }));
+    }
+
+    release = true;
+    blocker.Get();
+    for (auto& task : tasks) task.Get();
+
+    // Tasks without a deadline go after the ones with deadlines
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4, -1}));
+}
+
 UTEST_MT(TaskProcessor, MetricsAliveAndRunning, 2) {
     auto& task_counter = engine::current_task::GetTaskProcessor().GetTaskCounter();
 
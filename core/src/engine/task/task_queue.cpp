@@ -7,11 +7,26 @@ USERVER_NAMESPACE_BEGIN
 namespace engine {
 
 namespace {
-constexpr std::size_t kSemaphoreInitialCount = 0;
-}
+
+// Once in this number of pops the queues are visited from the lowest priority
+// to the highest one, so that the lower priorities are not starved
+constexpr std::size_t kReversePriorityPopPeriod = 16;
+}  // namespace
+
+struct TaskQueue::ConsumerTokens final {
+    explicit ConsumerTokens(TaskQueue& queue)
+        : normal(queue.queue_), high(queue.high_priority_queue_), low(queue.low_priority_queue_) {}
+
+    moodycamel::ConsumerToken normal;
+    moodycamel::ConsumerToken high;
+    moodycamel::ConsumerToken low;
+    std::size_t pops_count{0};
+};
 
 TaskQueue::TaskQueue(const TaskProcessorConfig& config)
-    : queue_semaphore_(kSemaphoreInitialCount, config.spinning_iterations) {}
+    : task_priorities_(config.task_priorities),
+      deadline_scheduling_(config.deadline_scheduling),
+      queue_semaphore_(config) {}
 
 void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
     UASSERT(context);
@@ -21,11 +36,11 @@ void TaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
 
 boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
     // Current thread handles only a single TaskProcessor, so it's safe to store
-    // a token for the task processor in a thread-local variable.
-    thread_local moodycamel::ConsumerToken token(queue_);
+    // tokens for the task processor in a thread-local variable.
+    thread_local ConsumerTokens tokens(*this);
 
     boost::intrusive_ptr<impl::TaskContext> context{
-        DoPopBlocking(token),
+        DoPopBlocking(tokens),
         /* add_ref= */ false};
 
     if (!context) {
@@ -38,31 +53,86 @@ boost::intrusive_ptr<impl::TaskContext> TaskQueue::PopBlocking() {
 
 void TaskQueue::StopProcessing() { DoPush(nullptr); }
 
-std::size_t TaskQueue::GetSizeApproximate() const noexcept { return queue_.size_approx(); }
+std::size_t TaskQueue::GetSizeApproximate() const noexcept {
+    return queue_.size_approx() + high_priority_queue_.size_approx() + low_priority_queue_.size_approx() +
+           deadline_queue_.GetSizeApproximate();
+}
 
 void TaskQueue::PrepareWorker(std::size_t) {}
 
+WorkerParkingStats TaskQueue::GetWorkerParkingStats() const noexcept { return queue_semaphore_.GetStats(); }
+
 void TaskQueue::DoPush(impl::TaskContext* context) {
+    if (!context || (!task_priorities_ && !deadline_scheduling_)) {
+        queue_.enqueue(context);
+    } else {
+        const auto priority = task_priorities_ ? context->GetPriority() : TaskPriority::kNormal;
+        const auto deadline = context->GetCancelDeadline();
+
+        if (deadline_scheduling_ && priority != TaskPriority::kLow && deadline.IsReachable()) {
+            deadline_queue_.Push(context, deadline);
+        } else if (priority == TaskPriority::kHigh) {
+            high_priority_queue_.enqueue(context);
+        } else if (priority == TaskPriority::kLow) {
+            low_priority_queue_.enqueue(context);
+        } else {
+            queue_.enqueue(context);
+        }
+    }
+
     // This piece of code is copy-pasted from
     // moodycamel::BlockingConcurrentQueue::enqueue
-    queue_.enqueue(context);
-    queue_semaphore_.signal();
+    queue_semaphore_.Signal();
 }
 
-impl::TaskContext* TaskQueue::DoPopBlocking(moodycamel::ConsumerToken& token) {
+impl::TaskContext* TaskQueue::DoPopBlocking(ConsumerTokens& tokens) {
     impl::TaskContext* context{};
 
     // This piece of code is copy-pasted from
     // moodycamel::BlockingConcurrentQueue::wait_dequeue
-    queue_semaphore_.wait();
-    while (!queue_.try_dequeue(token, context)) {
-        // Can happen when another consumer steals our item in exchange for another
-        // item in a Moodycamel sub-queue that we have already passed.
+    queue_semaphore_.Wait();
+    if (!task_priorities_ && !deadline_scheduling_) {
+        while (!queue_.try_dequeue(tokens.normal, context)) {
+            // Can happen when another consumer steals our item in exchange for another
+            // item in a Moodycamel sub-queue that we have already passed.
+        }
+        return context;
     }
 
+    // The semaphore guarantees that there is a task for us in one of the
+    // queues. The task may be a nullptr stop signal.
+    while (!TryPopByPriority(tokens, context)) {
+    }
     return context;
 }
 
+bool TaskQueue::TryPopByPriority(ConsumerTokens& tokens, impl::TaskContext*& context) {
+    static constexpr std::size_t kQueuesCount = 4;
+    const bool reverse = (++tokens.pops_count % kReversePriorityPopPeriod == 0);
+
+    for (std::size_t i = 0; i < kQueuesCount; ++i) {
+        // Queues from the most urgent to the least one
+        switch (reverse ? kQueuesCount - 1 - i : i) {
+            case 0:
+                if (deadline_scheduling_ && deadline_queue_.GetSizeApproximate() != 0) {
+                    context = deadline_queue_.TryPop();
+                    if (context) return true;
+                }
+                break;
+            case 1:
+                if (high_priority_queue_.try_dequeue(tokens.high, context)) return true;
+                break;
+            case 2:
+                if (queue_.try_dequeue(tokens.normal, context)) return true;
+                break;
+            case 3:
+                if (low_priority_queue_.try_dequeue(tokens.low, context)) return true;
+                break;
+        }
+    }
+    return false;
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
@@ -1,10 +1,11 @@
 #pragma once
 
 #include <moodycamel/blockingconcurrentqueue.h>
-#include <moodycamel/lightweightsemaphore.h>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
+#include <engine/task/deadline_task_queue.hpp>
 #include <engine/task/task_processor_config.hpp>
+#include <engine/task/worker_semaphore.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -29,13 +30,28 @@ public:
 
     void PrepareWorker(std::size_t index);
 
+    WorkerParkingStats GetWorkerParkingStats() const noexcept;
+
 private:
+    struct ConsumerTokens;
+
     void DoPush(impl::TaskContext* context);
 
-    impl::TaskContext* DoPopBlocking(moodycamel::ConsumerToken& token);
+    impl::TaskContext* DoPopBlocking(ConsumerTokens& tokens);
+
+    bool TryPopByPriority(ConsumerTokens& tokens, impl::TaskContext*& context);
+
+    const bool task_priorities_;
+    const bool deadline_scheduling_;
 
+    // Contains all the tasks if neither priorities nor deadline scheduling
+    // are enabled, kNormal priority tasks otherwise
     moodycamel::ConcurrentQueue<impl::TaskContext*> queue_;
-    moodycamel::LightweightSemaphore queue_semaphore_;
+    moodycamel::ConcurrentQueue<impl::TaskContext*> high_priority_queue_;
+    moodycamel::ConcurrentQueue<impl::TaskContext*> low_priority_queue_;
+    DeadlineTaskQueue deadline_queue_;
+    // Counts the tasks in all the queues
+    WorkerSemaphore queue_semaphore_;
 };
 
 }  // namespace engine
@@ -11,6 +11,7 @@
 #include <userver/engine/single_consumer_event.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/engine/task/cancel.hpp>
+#include <userver/engine/task/stack_size.hpp>
 #include <userver/engine/task/task.hpp>
 #include <utils/sys_info.hpp>
 
@@ -295,6 +296,31 @@ TEST(Task, CoroStackSizeSet) {
     });
 }
 
+TEST(Task, StackSizeClasses) {
+    const auto page_size = utils::sys_info::GetPageSize();
+    engine::TaskProcessorPoolsConfig config{};
+    config.small_coro_stack_size = 16 * page_size;
+    config.coro_stack_size = 64 * page_size;
+    engine::RunStandalone(1, config, [&] {
+        EXPECT_EQ(engine::current_task::GetStackSize(), 64 * page_size);
+
+        {
+            const engine::StackSizeScope stack_size_scope{engine::StackSize::kSmall};
+            engine::AsyncNoSpan([&] {
+                EXPECT_EQ(engine::current_task::GetStackSize(), 16 * page_size);
+                // The scope applies to the tasks of the current task only
+                engine::AsyncNoSpan([&] { EXPECT_EQ(engine::current_task::GetStackSize(), 64 * page_size); }).Get();
+            }).Get();
+
+            // Disabled size classes fall back to the default stacks
+            const engine::StackSizeScope large_stack_size_scope{engine::StackSize::kLarge};
+            engine::AsyncNoSpan([&] { EXPECT_EQ(engine::current_task::GetStackSize(), 64 * page_size); }).Get();
+        }
+
+        engine::AsyncNoSpan([&] { EXPECT_EQ(engine::current_task::GetStackSize(), 64 * page_size); }).Get();
+    });
+}
+
 // ASAN has issues with stacks of more than ~4MB, so we use 3MB stacks here
 TEST(Task, UseMediumStack) {
     engine::TaskProcessorPoolsConfig config{};
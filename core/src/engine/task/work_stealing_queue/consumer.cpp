@@ -50,10 +50,16 @@ Consumer::Consumer(WorkStealingTaskQueue& owner, ConsumersManager& consumers_man
       rnd_(utils::Rand()),
       steps_count_(rnd_()),
       global_queue_token_(owner_.global_queue_.CreateConsumerToken()),
-      background_queue_token_(owner.background_queue_.CreateConsumerToken()) {}
+      background_queue_token_(owner.background_queue_.CreateConsumerToken()),
+      high_priority_queue_token_(owner.high_priority_queue_.CreateConsumerToken()) {
+    overflow_queue_tokens_.reserve(owner_.overflow_queues_.size());
+    for (auto& queue : owner_.overflow_queues_) {
+        overflow_queue_tokens_.push_back(queue.CreateConsumerToken());
+    }
+}
 
 void Consumer::Push(impl::TaskContext* ctx) {
-    if (ctx && ctx->IsBackground()) {
+    if (ctx && owner_.IsBackgroundOrLowPriority(*ctx)) {
         owner_.background_queue_.Push(background_queue_token_, ctx);
         return;
     }
@@ -81,6 +87,22 @@ WorkStealingTaskQueue* Consumer::GetOwner() const noexcept { return &owner_; }
 
 void Consumer::SetIndex(std::size_t index) noexcept { inner_index_ = index; }
 
+void Consumer::SetStealingOrder(std::size_t node, std::vector<std::size_t> victims, StealingTierEnds tier_ends) {
+    UASSERT(owner_.overflow_queues_.size() == 0 || node < owner_.overflow_queues_.size());
+    UASSERT(tier_ends.back() == victims.size());
+    node_ = node;
+    victims_ = std::move(victims);
+    victims_tier_ends_ = tier_ends;
+}
+
+GlobalQueue& Consumer::GetOverflowQueue() noexcept {
+    return owner_.overflow_queues_.size() == 0 ? owner_.global_queue_ : owner_.overflow_queues_[node_];
+}
+
+GlobalQueue::Token& Consumer::GetOverflowQueueToken() noexcept {
+    return overflow_queue_tokens_.empty() ? global_queue_token_ : overflow_queue_tokens_[node_];
+}
+
 bool Consumer::IsStopped() const noexcept { return consumers_manager_.IsStopped(); }
 
 void Consumer::EmptySurplusQueue(impl::TaskContext* extra) {
@@ -92,10 +114,11 @@ void Consumer::EmptySurplusQueue(impl::TaskContext* extra) {
     // First, we fill the local queue with the maximum number of tasks
     const size_t pushed_shift = local_queue_.PushBulk(utils::span(steal_buffer_.data(), free_tasks_count));
 
-    // Second, we push the remaining tasks to the global queue
+    // Second, we push the remaining tasks to the global queue of our node
     if (pushed_shift < free_tasks_count) {
-        owner_.global_queue_.PushBulk(
-            global_queue_token_, utils::span(steal_buffer_.data() + pushed_shift, free_tasks_count - pushed_shift)
+        GetOverflowQueue().PushBulk(
+            GetOverflowQueueToken(),
+            utils::span(steal_buffer_.data() + pushed_shift, free_tasks_count - pushed_shift)
         );
     }
 }
@@ -104,22 +127,15 @@ impl::TaskContext*
 Consumer::StealFromAnotherConsumerOrGlobalQueue(const std::size_t attempts, std::size_t to_steal_count) {
     std::size_t stealed_size = 0;
     for (std::size_t i = 0; i < attempts && to_steal_count > 0 && stealed_size == 0; ++i) {
-        std::size_t start_index = rnd_() % owner_.consumers_count_;
-        for (std::size_t shift = 0; shift < owner_.consumers_count_ && to_steal_count > 0 && stealed_size == 0;
-             ++shift) {
-            std::size_t index = (start_index + shift) % owner_.consumers_count_;
-            Consumer* victim = &owner_.consumers_[index];
-            if (victim == this) {
-                continue;
-            }
-            const std::size_t tasks_count =
-                victim->Steal(utils::span(steal_buffer_.data() + stealed_size, to_steal_count));
-            stealed_size += tasks_count;
-            to_steal_count -= tasks_count;
-        }
+        const std::size_t tasks_count = StealFromNearestConsumer(to_steal_count);
+        stealed_size += tasks_count;
+        to_steal_count -= tasks_count;
 
         if (stealed_size == 0) {
             impl::TaskContext* ctx = owner_.global_queue_.TryPop(global_queue_token_);
+            if (!ctx) {
+                ctx = TryPopFromRemoteOverflowQueues();
+            }
             if (ctx) {
                 steal_buffer_[stealed_size++] = ctx;
                 to_steal_count--;
@@ -164,17 +180,45 @@ std::size_t Consumer::Steal(utils::span<impl::TaskContext*> buffer) {
     );
 }
 
-impl::TaskContext* Consumer::TryPopFromOwnerQueue(const bool is_global) {
-    GlobalQueue* queue = &owner_.global_queue_;
-    GlobalQueue::Token* token = &global_queue_token_;
-    if (!is_global) {
-        queue = &owner_.background_queue_;
-        token = &background_queue_token_;
+std::size_t Consumer::StealFromNearestConsumer(std::size_t to_steal_count) {
+    // Victims of each tier are visited starting from a random one, so that
+    // the stealing consumers do not contend on the same victim
+    std::size_t tier_begin = 0;
+    for (const std::size_t tier_end : victims_tier_ends_) {
+        const std::size_t tier_size = tier_end - tier_begin;
+        if (tier_size == 0) {
+            continue;
+        }
+        const std::size_t start_index = rnd_() % tier_size;
+        for (std::size_t shift = 0; shift < tier_size; ++shift) {
+            Consumer& victim = owner_.consumers_[victims_[tier_begin + (start_index + shift) % tier_size]];
+            const std::size_t tasks_count = victim.Steal(utils::span(steal_buffer_.data(), to_steal_count));
+            if (tasks_count) {
+                return tasks_count;
+            }
+        }
+        tier_begin = tier_end;
+    }
+    return 0;
+}
+
+impl::TaskContext* Consumer::TryPopFromRemoteOverflowQueues() {
+    const std::size_t nodes_count = owner_.overflow_queues_.size();
+    for (std::size_t shift = 1; shift < nodes_count; ++shift) {
+        const std::size_t node = (node_ + shift) % nodes_count;
+        impl::TaskContext* ctx = owner_.overflow_queues_[node].TryPop(overflow_queue_tokens_[node]);
+        if (ctx) {
+            return ctx;
+        }
     }
+    return nullptr;
+}
+
+impl::TaskContext* Consumer::TryPopFromOwnerQueue(GlobalQueue& queue, GlobalQueue::Token& token) {
     const std::size_t consumers_count = owner_.consumers_count_;
     std::size_t steal_size =
-        std::min((queue->GetSizeApproximateDelayed() + consumers_count) / consumers_count, kConsumerStealBufferSize);
-    steal_size = queue->PopBulk(*token, utils::span(steal_buffer_.data(), steal_size));
+        std::min((queue.GetSizeApproximateDelayed() + consumers_count) / consumers_count, kConsumerStealBufferSize);
+    steal_size = queue.PopBulk(token, utils::span(steal_buffer_.data(), steal_size));
     if (steal_size == 0) {
         return nullptr;
     }
@@ -194,17 +238,30 @@ impl::TaskContext* Consumer::ProbabilisticPopFromOwnerQueues() {
         if (context) {
             return context;
         }
+        if (!overflow_queue_tokens_.empty()) {
+            context = GetOverflowQueue().TryPop(GetOverflowQueueToken());
+            if (context) {
+                return context;
+            }
+        }
     }
 
     return nullptr;
 }
 
 impl::TaskContext* Consumer::TryPop() {
-    impl::TaskContext* context = TryPopFromOwnerQueue(/* is_global */ true);
+    impl::TaskContext* context = TryPopFromOwnerQueue(owner_.global_queue_, global_queue_token_);
     if (context) {
         return context;
     }
 
+    if (!overflow_queue_tokens_.empty()) {
+        context = TryPopFromOwnerQueue(GetOverflowQueue(), GetOverflowQueueToken());
+        if (context) {
+            return context;
+        }
+    }
+
     if (consumers_manager_.AllowStealing()) {
         context = StealFromAnotherConsumerOrGlobalQueue(steal_attempts_count_, kDefaultStealSize);
         bool last = consumers_manager_.StopStealing();
@@ -218,7 +275,7 @@ impl::TaskContext* Consumer::TryPop() {
         }
     }
 
-    context = TryPopFromOwnerQueue(/* is_global */ false);
+    context = TryPopFromOwnerQueue(owner_.background_queue_, background_queue_token_);
     if (context) {
         return context;
     }
@@ -260,7 +317,12 @@ impl::TaskContext* Consumer::TryPopLocal() {
 
 impl::TaskContext* Consumer::DoPop() {
     ++steps_count_;
-    impl::TaskContext* context = ProbabilisticPopFromOwnerQueues();
+    impl::TaskContext* context = owner_.TryPopHighPriority(high_priority_queue_token_);
+    if (context) {
+        return context;
+    }
+
+    context = ProbabilisticPopFromOwnerQueues();
     if (context) {
         return context;
     }
@@ -4,6 +4,9 @@
 #include <condition_variable>
 #include <cstddef>
 #include <random>
+#include <vector>
+
+#include <engine/task/cpu_topology.hpp>
 
 #include <engine/task/work_stealing_queue/global_queue.hpp>
 #include <engine/task/work_stealing_queue/local_queue.hpp>
@@ -35,8 +38,17 @@ private:
     friend ConsumersManager;
     friend WorkStealingTaskQueue;
 
+    // Ends of the victims ranges for each impl::CpuTopology::Distance
+    using StealingTierEnds = std::array<std::size_t, impl::CpuTopology::kDistancesCount>;
+
     void SetIndex(std::size_t index) noexcept;
 
+    void SetStealingOrder(std::size_t node, std::vector<std::size_t> victims, StealingTierEnds tier_ends);
+
+    GlobalQueue& GetOverflowQueue() noexcept;
+
+    GlobalQueue::Token& GetOverflowQueueToken() noexcept;
+
     bool IsStopped() const noexcept;
 
     void EmptySurplusQueue(impl::TaskContext* extra);
@@ -45,7 +57,11 @@ private:
 
     std::size_t Steal(utils::span<impl::TaskContext*> buffer);
 
-    impl::TaskContext* TryPopFromOwnerQueue(const bool is_global);
+    std::size_t StealFromNearestConsumer(std::size_t to_steal_count);
+
+    impl::TaskContext* TryPopFromRemoteOverflowQueues();
+
+    impl::TaskContext* TryPopFromOwnerQueue(GlobalQueue& queue, GlobalQueue::Token& token);
 
     impl::TaskContext* ProbabilisticPopFromOwnerQueues();
 
@@ -73,6 +89,10 @@ private:
     ConsumersManager& consumers_manager_;
     const std::size_t steal_attempts_count_;
     std::size_t inner_index_{0};
+    std::size_t node_{0};
+    // Other consumers, nearest first
+    std::vector<std::size_t> victims_;
+    StealingTierEnds victims_tier_ends_{};
     // kConsumerStealBufferSize + 1 for extra task in push
     std::array<impl::TaskContext*, kConsumerStealBufferSize + 1> steal_buffer_{};
     std::minstd_rand rnd_;
@@ -80,6 +100,8 @@ private:
     std::atomic<std::int32_t> sleep_counter_{0};
     GlobalQueue::Token global_queue_token_;
     GlobalQueue::Token background_queue_token_;
+    GlobalQueue::Token high_priority_queue_token_;
+    std::vector<GlobalQueue::Token> overflow_queue_tokens_;
 #ifndef __linux__
     std::condition_variable cv_;
     std::mutex mutex_;
@@ -1,8 +1,12 @@
 #include <engine/task/work_stealing_queue/task_queue.hpp>
 
+#include <algorithm>
+#include <vector>
+
 #include <userver/utils/assert.hpp>
 #include <userver/utils/rand.hpp>
 
+#include <engine/task/cpu_topology.hpp>
 #include <engine/task/task_context.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -17,13 +21,18 @@ thread_local Consumer* localConsumer = nullptr;
 
 WorkStealingTaskQueue::WorkStealingTaskQueue(const TaskProcessorConfig& config)
     : consumers_count_(config.worker_threads),
+      nodes_count_(config.pin_worker_threads ? impl::CpuTopology::Get().GetNodesCount() : 1),
+      task_priorities_(config.task_priorities),
       global_queue_(consumers_count_),
       background_queue_(consumers_count_),
+      high_priority_queue_(consumers_count_),
+      overflow_queues_(nodes_count_ > 1 ? nodes_count_ : 0, consumers_count_),
       consumers_(config.worker_threads, *this, consumers_manager_),
       consumers_manager_(consumers_count_) {
     for (size_t i = 0; i < consumers_count_; ++i) {
         consumers_[i].SetIndex(i);
     }
+    InitStealingOrder(config.pin_worker_threads);
 }
 
 void WorkStealingTaskQueue::Push(boost::intrusive_ptr<impl::TaskContext>&& context) {
@@ -51,6 +60,10 @@ std::size_t WorkStealingTaskQueue::GetSizeApproximate() const noexcept {
     }
     size += global_queue_.GetSizeApproximate();
     size += background_queue_.GetSizeApproximate();
+    size += high_priority_queue_.GetSizeApproximate();
+    for (const auto& queue : overflow_queues_) {
+        size += queue.GetSizeApproximate();
+    }
     return size;
 }
 
@@ -64,9 +77,12 @@ void WorkStealingTaskQueue::DoPush(impl::TaskContext* context) {
     {
         Consumer* consumer = GetConsumer();
 
-        if (consumer != nullptr && consumer->GetOwner() == this) {
+        if (context && IsHighPriority(*context)) {
+            high_priority_size_->fetch_add(1, std::memory_order_relaxed);
+            high_priority_queue_.Push(context);
+        } else if (consumer != nullptr && consumer->GetOwner() == this) {
             consumer->Push(context);
-        } else if (context && context->IsBackground()) {
+        } else if (context && IsBackgroundOrLowPriority(*context)) {
             background_queue_.Push(context);
         } else {
             global_queue_.Push(context);
@@ -83,6 +99,70 @@ impl::TaskContext* WorkStealingTaskQueue::DoPopBlocking() {
 
 Consumer* WorkStealingTaskQueue::GetConsumer() { return localConsumer; }
 
+bool WorkStealingTaskQueue::IsHighPriority(const impl::TaskContext& context) const noexcept {
+    return task_priorities_ && context.GetPriority() == TaskPriority::kHigh;
+}
+
+bool WorkStealingTaskQueue::IsBackgroundOrLowPriority(const impl::TaskContext& context) const noexcept {
+    return context.IsBackground() || (task_priorities_ && context.GetPriority() == TaskPriority::kLow);
+}
+
+impl::TaskContext* WorkStealingTaskQueue::TryPopHighPriority(GlobalQueue::Token& token) {
+    // Cheap check, as the empty GlobalQueue is expensive to pop from
+    if (high_priority_size_->load(std::memory_order_relaxed) == 0) {
+        return nullptr;
+    }
+    impl::TaskContext* context = high_priority_queue_.TryPop(token);
+    if (context) {
+        high_priority_size_->fetch_sub(1, std::memory_order_relaxed);
+    }
+    return context;
+}
+
+void WorkStealingTaskQueue::InitStealingOrder(bool topology_aware) {
+    using Distance = impl::CpuTopology::Distance;
+    // The topology is read from sysfs on the first use, it is not needed when
+    // the workers are not pinned to CPUs
+    const impl::CpuTopology* topology = topology_aware ? &impl::CpuTopology::Get() : nullptr;
+
+    for (std::size_t i = 0; i < consumers_count_; ++i) {
+        std::vector<std::size_t> victims;
+        victims.reserve(consumers_count_);
+        for (std::size_t j = 0; j < consumers_count_; ++j) {
+            if (j != i) victims.push_back(j);
+        }
+
+        Consumer::StealingTierEnds tier_ends{};
+        std::size_t node = 0;
+        if (!topology) {
+            // All the other consumers are equidistant
+            tier_ends.fill(victims.size());
+        } else {
+            // Workers are pinned by TaskProcessor to the same CPUs
+            const auto& cpu = topology->GetWorkerCpu(i);
+            const auto get_distance = [&](std::size_t index) {
+                return impl::CpuTopology::GetDistance(cpu, topology->GetWorkerCpu(index));
+            };
+            std::stable_sort(victims.begin(), victims.end(), [&](std::size_t lhs, std::size_t rhs) {
+                return get_distance(lhs) < get_distance(rhs);
+            });
+            for (std::size_t tier = 0; tier < tier_ends.size(); ++tier) {
+                tier_ends[tier] = std::partition_point(
+                                      victims.begin(),
+                                      victims.end(),
+                                      [&](std::size_t index) {
+                                          return get_distance(index) <= static_cast<Distance>(tier);
+                                      }
+                                  ) -
+                                  victims.begin();
+            }
+            node = nodes_count_ > 1 ? cpu.node : 0;
+        }
+
+        consumers_[i].SetStealingOrder(node, std::move(victims), tier_ends);
+    }
+}
+
 }  // namespace engine
 
 USERVER_NAMESPACE_END
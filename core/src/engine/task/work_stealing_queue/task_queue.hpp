@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <cstddef>
+#include <optional>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
@@ -8,6 +10,7 @@
 #include <engine/task/work_stealing_queue/consumer.hpp>
 #include <engine/task/work_stealing_queue/consumers_manager.hpp>
 #include <engine/task/work_stealing_queue/global_queue.hpp>
+#include <engine/task/worker_semaphore.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -33,17 +36,38 @@ public:
 
     void PrepareWorker(std::size_t index);
 
+    // Consumers of the work-stealing queue have their own parking mechanism
+    std::optional<WorkerParkingStats> GetWorkerParkingStats() const noexcept { return std::nullopt; }
+
 private:
     void DoPush(impl::TaskContext* context);
 
+    bool IsHighPriority(const impl::TaskContext& context) const noexcept;
+
+    // Low priority tasks share the queue with the background ones
+    bool IsBackgroundOrLowPriority(const impl::TaskContext& context) const noexcept;
+
+    impl::TaskContext* TryPopHighPriority(GlobalQueue::Token& token);
+
     impl::TaskContext* DoPopBlocking();
 
     Consumer* GetConsumer();
 
+    void InitStealingOrder(bool topology_aware);
+
     const std::size_t consumers_count_;
+    // NUMA nodes of the pinned workers, 1 if the workers are not pinned
+    const std::size_t nodes_count_;
+    const bool task_priorities_;
 
     GlobalQueue global_queue_;
     GlobalQueue background_queue_;
+    // Visited before any other queue if task priorities are enabled
+    GlobalQueue high_priority_queue_;
+    concurrent::impl::InterferenceShield<std::atomic<std::size_t>> high_priority_size_{0};
+    // Per-node queues for the surplus of the local queues, used only if there
+    // are several nodes. Keep the tasks near the memory they were touched on.
+    utils::FixedArray<GlobalQueue> overflow_queues_;
     utils::FixedArray<Consumer> consumers_;
     ConsumersManager consumers_manager_;
 };
@@ -0,0 +1,133 @@
+#include <engine/task/worker_semaphore.hpp>
+
+#include <algorithm>
+
+#include <userver/utils/statistics/writer.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+namespace {
+
+// Spin limit never decays below this value
+constexpr int kMinSpinLimit = 16;
+// The spin limit moves by 1/kSpinLimitSmoothing of the difference with the
+// last observation, as in adaptive mutexes of glibc
+constexpr int kSpinLimitSmoothing = 8;
+
+std::size_t GetMaxSpinningWorkers(const TaskProcessorConfig& config) {
+    return std::max<std::size_t>(1, config.worker_threads / 2);
+}
+
+}  // namespace
+
+void DumpMetric(utils::statistics::Writer& writer, const WorkerParkingStats& stats) {
+    writer["spin-hits"] = stats.spin_hits;
+    writer["spin-misses"] = stats.spin_misses;
+    writer["spin-skips"] = stats.spin_skips;
+    writer["parks"] = stats.parks;
+    writer["wakeups"] = stats.wakeups;
+    writer["spin-limit"] = stats.spin_limit;
+    writer["max-spinning-workers"] = stats.max_spinning_workers;
+}
+
+WorkerSemaphore::WorkerSemaphore(const TaskProcessorConfig& config)
+    : adaptive_(config.adaptive_spinning),
+      max_spin_limit_(std::max(config.spinning_iterations, 0)),
+      max_spinning_workers_(GetMaxSpinningWorkers(config)),
+      plain_sema_(0, max_spin_limit_),
+      spin_limit_(max_spin_limit_) {}
+
+void WorkerSemaphore::Signal() noexcept {
+    if (!adaptive_) {
+        plain_sema_.signal();
+        return;
+    }
+
+    const auto old_count = count_->fetch_add(1, std::memory_order_release);
+    if (old_count < 0) {
+        ++counters_->wakeups;
+        sema_.signal();
+    }
+}
+
+void WorkerSemaphore::Wait() noexcept {
+    if (!adaptive_) {
+        while (!plain_sema_.wait()) {
+        }
+        return;
+    }
+
+    if (TryWait() || Spin()) return;
+
+    const auto old_count = count_->fetch_sub(1, std::memory_order_acquire);
+    if (old_count > 0) return;
+
+    ++counters_->parks;
+    while (!sema_.wait()) {
+    }
+}
+
+WorkerParkingStats WorkerSemaphore::GetStats() const noexcept {
+    WorkerParkingStats stats;
+    stats.spin_hits = counters_->spin_hits.Load();
+    stats.spin_misses = counters_->spin_misses.Load();
+    stats.spin_skips = counters_->spin_skips.Load();
+    stats.parks = counters_->parks.Load();
+    stats.wakeups = counters_->wakeups.Load();
+    stats.spin_limit = spin_limit_->load(std::memory_order_relaxed);
+    stats.max_spinning_workers = max_spinning_workers_;
+    return stats;
+}
+
+bool WorkerSemaphore::TryWait() noexcept {
+    auto old_count = count_->load(std::memory_order_relaxed);
+    while (old_count > 0) {
+        if (count_->compare_exchange_weak(
+                old_count, old_count - 1, std::memory_order_acquire, std::memory_order_relaxed
+            )) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WorkerSemaphore::Spin() noexcept {
+    if (spinning_workers_->fetch_add(1, std::memory_order_relaxed) >= max_spinning_workers_) {
+        spinning_workers_->fetch_sub(1, std::memory_order_relaxed);
+        ++counters_->spin_skips;
+        return false;
+    }
+
+    const int limit = spin_limit_->load(std::memory_order_relaxed);
+    for (int i = 0; i < limit; ++i) {
+        if (TryWait()) {
+            spinning_workers_->fetch_sub(1, std::memory_order_relaxed);
+            ++counters_->spin_hits;
+            UpdateSpinLimit(/*hit=*/true, i);
+            return true;
+        }
+        // Prevent the compiler from collapsing the loop
+        std::atomic_signal_fence(std::memory_order_acquire);
+    }
+
+    spinning_workers_->fetch_sub(1, std::memory_order_relaxed);
+    ++counters_->spin_misses;
+    UpdateSpinLimit(/*hit=*/false, limit);
+    return false;
+}
+
+void WorkerSemaphore::UpdateSpinLimit(bool hit, int iterations) noexcept {
+    // Spin for twice the observed wait to catch the tasks that arrive a bit
+    // later, shrink the limit on misses to stop burning CPU on idle hosts
+    const int target = std::min(hit ? 2 * iterations + kMinSpinLimit : kMinSpinLimit, max_spin_limit_);
+
+    // Races between the workers only lose some of the observations
+    const int current = spin_limit_->load(std::memory_order_relaxed);
+    spin_limit_->store(current + (target - current) / kSpinLimitSmoothing, std::memory_order_relaxed);
+}
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
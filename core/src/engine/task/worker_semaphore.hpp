@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <moodycamel/blockingconcurrentqueue.h>
+#include <moodycamel/lightweightsemaphore.h>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/utils/statistics/fwd.hpp>
+#include <userver/utils/statistics/rate_counter.hpp>
+
+#include <engine/task/task_processor_config.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace engine {
+
+/// Decisions of the idle workers parking policy
+struct WorkerParkingStats final {
+    // A task arrived while the worker was spinning
+    utils::statistics::Rate spin_hits;
+    // No task arrived during the spin, the worker parked
+    utils::statistics::Rate spin_misses;
+    // The worker parked without spinning, as enough workers were spinning
+    utils::statistics::Rate spin_skips;
+    // The worker went to sleep on the OS semaphore
+    utils::statistics::Rate parks;
+    // A parked worker was woken up, at most one per enqueued task
+    utils::statistics::Rate wakeups;
+    std::int64_t spin_limit{0};
+    std::size_t max_spinning_workers{0};
+};
+
+void DumpMetric(utils::statistics::Writer& writer, const WorkerParkingStats& stats);
+
+/// @brief Counts the queued tasks and parks the idle workers.
+///
+/// A worker that found no tasks spins for up to the current spin limit before
+/// going to sleep on the OS semaphore. Signal() wakes up at most one sleeping
+/// worker.
+///
+/// With `adaptive-spinning` the spin limit follows the number of spin
+/// iterations after which the tasks recently arrived (i.e. the inter-arrival
+/// time of tasks as seen by the idle workers) and decays when the spins fail.
+/// Only half of the workers may spin at the same time, the rest park at once.
+/// Otherwise the workers park on moodycamel::LightweightSemaphore that spins
+/// for `spinning-iterations`, and no stats are collected.
+class WorkerSemaphore final {
+public:
+    explicit WorkerSemaphore(const TaskProcessorConfig& config);
+
+    void Signal() noexcept;
+
+    void Wait() noexcept;
+
+    WorkerParkingStats GetStats() const noexcept;
+
+private:
+    bool TryWait() noexcept;
+
+    bool Spin() noexcept;
+
+    void UpdateSpinLimit(bool hit, int iterations) noexcept;
+
+    struct Counters final {
+        utils::statistics::RateCounter spin_hits;
+        utils::statistics::RateCounter spin_misses;
+        utils::statistics::RateCounter spin_skips;
+        utils::statistics::RateCounter parks;
+        utils::statistics::RateCounter wakeups;
+    };
+
+    const bool adaptive_;
+    const int max_spin_limit_;
+    const std::size_t max_spinning_workers_;
+
+    // Used instead of all the members below if adaptive spinning is off
+    moodycamel::LightweightSemaphore plain_sema_;
+
+    // Positive - tasks available, negative - workers sleeping on sema_
+    concurrent::impl::InterferenceShield<std::atomic<std::int64_t>> count_{0};
+    moodycamel::details::Semaphore sema_;
+
+    concurrent::impl::InterferenceShield<std::atomic<int>> spin_limit_;
+    concurrent::impl::InterferenceShield<std::atomic<std::size_t>> spinning_workers_{0};
+
+    concurrent::impl::InterferenceShield<Counters> counters_;
+};
+
+}  // namespace engine
+
+USERVER_NAMESPACE_END
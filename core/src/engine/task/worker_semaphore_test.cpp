@@ -0,0 +1,86 @@
+#include <engine/task/worker_semaphore.hpp>
+
+#include <chrono>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+engine::TaskProcessorConfig MakeConfig(bool adaptive_spinning) {
+    engine::TaskProcessorConfig config;
+    config.worker_threads = 2;
+    config.spinning_iterations = 10000;
+    config.adaptive_spinning = adaptive_spinning;
+    return config;
+}
+
+// Waits in a separate thread until the worker goes to sleep, then wakes it up
+void WaitParked(engine::WorkerSemaphore& semaphore) {
+    const auto parks_before = semaphore.GetStats().parks;
+    std::thread worker([&semaphore] { semaphore.Wait(); });
+    while (semaphore.GetStats().parks == parks_before) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    semaphore.Signal();
+    worker.join();
+}
+
+}  // namespace
+
+TEST(WorkerSemaphore, SignalBeforeWait) {
+    engine::WorkerSemaphore semaphore{MakeConfig(true)};
+    semaphore.Signal();
+    semaphore.Signal();
+    semaphore.Wait();
+    semaphore.Wait();
+
+    const auto stats = semaphore.GetStats();
+    EXPECT_EQ(stats.parks.value, 0);
+    EXPECT_EQ(stats.wakeups.value, 0);
+}
+
+TEST(WorkerSemaphore, WakesUpParkedWorker) {
+    engine::WorkerSemaphore semaphore{MakeConfig(true)};
+    WaitParked(semaphore);
+
+    const auto stats = semaphore.GetStats();
+    EXPECT_EQ(stats.spin_misses.value, 1);
+    EXPECT_EQ(stats.parks.value, 1);
+    EXPECT_EQ(stats.wakeups.value, 1);
+}
+
+TEST(WorkerSemaphore, PlainWithoutAdaptiveSpinning) {
+    engine::WorkerSemaphore semaphore{MakeConfig(false)};
+    semaphore.Signal();
+    semaphore.Wait();
+
+    std::thread worker([&semaphore] { semaphore.Wait(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    semaphore.Signal();
+    worker.join();
+
+    // The plain semaphore collects no stats
+    const auto stats = semaphore.GetStats();
+    EXPECT_EQ(stats.spin_misses.value, 0);
+    EXPECT_EQ(stats.parks.value, 0);
+    EXPECT_EQ(stats.wakeups.value, 0);
+    EXPECT_EQ(stats.spin_limit, 10000);
+}
+
+TEST(WorkerSemaphore, AdaptiveSpinLimitDecaysWhenIdle) {
+    engine::WorkerSemaphore semaphore{MakeConfig(true)};
+    EXPECT_EQ(semaphore.GetStats().max_spinning_workers, 1);
+
+    for (int i = 0; i < 50; ++i) {
+        WaitParked(semaphore);
+    }
+
+    const auto stats = semaphore.GetStats();
+    EXPECT_EQ(stats.wakeups.value, 50);
+    EXPECT_LT(stats.spin_limit, 10000 / 2);
+}
+
+USERVER_NAMESPACE_END
@@ -101,9 +101,7 @@ void FsCacheClient::HandleDeleteDirectory(engine::io::sys_linux::Inotify& inotif
 void FsCacheClient::HandleCreate(const std::string& path) {
     if (IsFilepathHidden(path)) return;
 
-    FileInfoWithData info{};
-    info.extension = boost::filesystem::path(path).extension().string();
-    info.data = ReadFileContents(tp_, path);
+    auto info = MakeFileInfoWithData(ReadFileContents(tp_, path), boost::filesystem::path(path).extension().string());
     data_.InsertOrAssign(GetLexicallyRelative(path, dir_), std::make_shared<const FileInfoWithData>(std::move(info)));
 }
 
@@ -2,6 +2,7 @@
 
 #include <boost/filesystem.hpp>
 
+#include <userver/crypto/hash.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/fs/blocking/read.hpp>
 #include <userver/utils/async.hpp>
@@ -27,6 +28,14 @@ std::string GetLexicallyRelative(std::string_view path, std::string_view dir) {
     return std::string{rel};
 }
 
+FileInfoWithData MakeFileInfoWithData(std::string data, std::string extension) {
+    FileInfoWithData info{};
+    info.etag = '"' + crypto::hash::Sha1(data, crypto::hash::OutputEncoding::kBase64) + '"';
+    info.data = std::move(data);
+    info.extension = std::move(extension);
+    return info;
+}
+
 std::string ReadFileContents(engine::TaskProcessor& async_tp, const std::string& path) {
     return engine::AsyncNoSpan(async_tp, &fs::blocking::ReadFileContents, path).Get();
 }
@@ -45,11 +54,9 @@ FileInfoWithDataMap ReadRecursiveFilesInfoWithData(
         // only files
         if (it->status().type() != boost::filesystem::regular_file) continue;
         if ((flags & SettingsReadFile::kSkipHidden) && IsHiddenFile(it->path())) continue;
-        FileInfoWithData info{};
-        info.extension = it->path().extension().string();
-        info.data = ReadFileContents(async_tp, it->path().string());
-        data[GetLexicallyRelative(it->path().string(), path)] =
-            std::make_shared<const FileInfoWithData>(std::move(info));
+        data[GetLexicallyRelative(it->path().string(), path)] = std::make_shared<const FileInfoWithData>(
+            MakeFileInfoWithData(ReadFileContents(async_tp, it->path().string()), it->path().extension().string())
+        );
     }
     return data;
 }
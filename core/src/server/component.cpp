@@ -203,7 +203,7 @@ properties:
                         defaultDescription: 32 * 1024
                     requests_queue_size_threshold:
                         type: integer
-                        description: drop requests from handlers that allow throttling if there's more pending requests than allowed by this value
+                        description: max number of pipelined requests of a connection that are handled concurrently, their responses are sent in order. With HTTP/1.x only the requests of safe methods (GET, HEAD, OPTIONS, TRACE) are handled ahead of the previous responses
                         defaultDescription: 100
                     keepalive_timeout:
                         type: integer
@@ -239,6 +239,14 @@ properties:
             shards:
                 type: integer
                 description: how many concurrent tasks harvest data from a single socket; do not set if not sure what it is doing
+            reuseport:
+                type: boolean
+                description: give each shard its own SO_REUSEPORT socket served by a dedicated ev thread, so that the kernel balances new connections between the shards
+                defaultDescription: false
+            reuseport-cpu-steering:
+                type: boolean
+                description: steer new connections to the shard with index `cpu % shards` of the CPU that received the connection; requires `reuseport`, works best with as many shards as CPUs
+                defaultDescription: false
     listener-monitor:
         type: object
         description: describes the special monitoring socket, used for getting statistics and processing utility requests that should succeed even is the main socket is under heavy pressure
@@ -0,0 +1,48 @@
+#include <server/congestion_control/latency_sensor.hpp>
+
+#include <engine/task/task_processor.hpp>
+#include <server/net/stats.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::congestion_control {
+
+namespace {
+const std::chrono::seconds kSecond{1};
+}
+
+LatencySensor::LatencySensor(const Server& server, engine::TaskProcessor& tp) : server_(server), tp_(tp) {}
+
+LatencySensor::Data LatencySensor::GetCurrent() {
+    const bool first_fetch = last_fetch_tp_ == std::chrono::steady_clock::time_point{};
+    const auto now = std::chrono::steady_clock::now();
+    auto duration_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - last_fetch_tp_);
+    if (duration_ms.count() == 0) duration_ms = std::chrono::milliseconds(1);
+
+    const auto stats = server_.GetServerStats();
+    const std::uint64_t overloads = tp_.GetTaskCounter().GetTasksOverloadSensor().value;
+
+    // The stats are reset once the server starts stopping
+    const bool stats_reset = stats.requests_processed_count < last_requests_;
+    const auto requests = stats_reset ? 0 : stats.requests_processed_count - last_requests_;
+    const auto processing_time_us = stats_reset ? 0 : stats.requests_processing_time_us - last_processing_time_us_;
+    const auto overloads_count = overloads - last_overloads_;
+
+    last_fetch_tp_ = now;
+    last_requests_ = stats.requests_processed_count;
+    last_processing_time_us_ = stats.requests_processing_time_us;
+    last_overloads_ = overloads;
+
+    if (first_fetch || requests == 0) return {};
+
+    Data data;
+    data.total = requests;
+    data.timeouts = overloads_count;
+    data.timings_avg_ms = processing_time_us / requests / 1000;
+    data.current_load = requests * kSecond / duration_ms;
+    return data;
+}
+
+}  // namespace server::congestion_control
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include <userver/congestion_control/sensor.hpp>
+#include <userver/engine/task/task_processor_fwd.hpp>
+#include <userver/server/server.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::congestion_control {
+
+/// Sensor of the server timings for the latency based controllers. The load
+/// is measured in RPS, as the server is limited by the RPS. Overloads of the
+/// main task processor are reported as timeouts.
+class LatencySensor final : public USERVER_NAMESPACE::congestion_control::v2::Sensor {
+public:
+    LatencySensor(const Server& server, engine::TaskProcessor& tp);
+
+    Data GetCurrent() override;
+
+private:
+    const Server& server_;
+    engine::TaskProcessor& tp_;
+
+    std::chrono::steady_clock::time_point last_fetch_tp_;
+    std::uint64_t last_requests_{0};
+    std::uint64_t last_processing_time_us_{0};
+    std::uint64_t last_overloads_{0};
+};
+
+}  // namespace server::congestion_control
+
+USERVER_NAMESPACE_END
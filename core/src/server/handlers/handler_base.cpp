@@ -95,13 +95,42 @@ properties:
         type: integer
         description: integer to limit RPS to this handler
         defaultDescription: <no limit>
+    fair_share:
+        type: object
+        description: |
+            weighted fair admission of the clients under max_requests_per_second and max_requests_in_flight,
+            once the load exceeds shed_threshold_percent of a limit the clients above their shares are rejected
+        defaultDescription: <all clients are limited together>
+        additionalProperties: false
+        properties:
+            client_key:
+                type: string
+                description: what identifies a client
+                defaultDescription: header
+                enum:
+                  - header
+                  - remote-address
+            header:
+                type: string
+                description: header with the client id for `client_key: header`
+            weights:
+                type: object
+                description: share weights of the clients by their ids, the rest have weight 1
+                properties: {}
+                additionalProperties:
+                    type: number
+                    description: share weight of the client
+            shed_threshold_percent:
+                type: integer
+                description: load of the handler in percent of its limits after which the clients above their shares are rejected
+                defaultDescription: 80
     decompress_request:
         type: boolean
         description: allow decompression of the requests
         defaultDescription: false
     throttling_enabled:
         type: boolean
-        description: allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` and `requests_queue_size_threshold` options
+        description: allow throttling of the requests by components::Server , for more info see its `max_response_size_in_flight` option
         defaultDescription: true
     set-response-server-hostname:
         type: boolean
@@ -111,6 +140,10 @@ properties:
         type: boolean
         description: TODO
         defaultDescription: false
+    request-body-stream:
+        type: boolean
+        description: set to true to read the request body by chunks with server::http::HttpRequest::GetBodyStream() while it is being received
+        defaultDescription: false
     monitor-handler:
         type: boolean
         description: overrides the in-code `is_monitor` flag that makes the handler run either on 'server.listener' or on 'server.listener-monitor'
@@ -24,6 +24,33 @@ FallbackHandler Parse(const yaml_config::YamlConfig& yaml, formats::parse::To<Fa
     return FallbackHandlerFromString(value);
 }
 
+FairShareConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<FairShareConfig>) {
+    FairShareConfig config;
+
+    const auto client_key = value["client_key"].As<std::string>("header");
+    if (client_key == "header") {
+        config.client_key = FairShareConfig::ClientKey::kHeader;
+        config.header = value["header"].As<std::string>();
+    } else if (client_key == "remote-address") {
+        config.client_key = FairShareConfig::ClientKey::kRemoteAddress;
+    } else {
+        throw std::runtime_error(fmt::format("Unknown fair_share client_key '{}' at {}", client_key, value.GetPath()));
+    }
+
+    config.weights = value["weights"].As<std::unordered_map<std::string, double>>({});
+    for (const auto& [client, weight] : config.weights) {
+        if (weight <= 0) {
+            throw std::runtime_error(fmt::format("fair_share weight of '{}' should be greater than 0", client));
+        }
+    }
+
+    config.shed_threshold_percent = value["shed_threshold_percent"].As<std::size_t>(config.shed_threshold_percent);
+    if (config.shed_threshold_percent > 100) {
+        throw std::runtime_error("fair_share shed_threshold_percent should not be greater than 100");
+    }
+    return config;
+}
+
 HandlerConfig ParseHandlerConfigsWithDefaults(
     const yaml_config::YamlConfig& value,
     const server::ServerConfig& server_config,
@@ -72,11 +99,13 @@ HandlerConfig ParseHandlerConfigsWithDefaults(
     config.response_data_size_log_limit =
         value["response_data_size_log_limit"].As<size_t>(handler_defaults.response_data_size_log_limit);
     config.max_requests_per_second = value["max_requests_per_second"].As<std::optional<size_t>>();
+    config.fair_share = value["fair_share"].As<std::optional<FairShareConfig>>();
     config.decompress_request = value["decompress_request"].As<bool>(true);
     config.throttling_enabled = value["throttling_enabled"].As<bool>(true);
     config.set_response_server_hostname = value["set-response-server-hostname"].As<std::optional<bool>>();
 
     config.response_body_stream = value["response-body-stream"].As<bool>(false);
+    config.request_body_stream = value["request-body-stream"].As<bool>(false);
 
     if (config.max_requests_per_second && config.max_requests_per_second.value() <= 0) {
         throw std::runtime_error(
@@ -1,10 +1,17 @@
 #include <userver/server/handlers/http_handler_static.hpp>
 
+#include <algorithm>
+#include <charconv>
+#include <optional>
+
+#include <fmt/format.h>
+
 #include <userver/components/component_config.hpp>
 #include <userver/components/component_context.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/dynamic_config/value.hpp>
 #include <userver/http/common_headers.hpp>
+#include <userver/utils/text_light.hpp>
 #include <userver/yaml_config/merge_schemas.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -33,6 +40,65 @@ const dynamic_config::Key<dynamic_config::ValueDict<std::string>> kContentTypeMa
 )"},
 };
 
+struct ByteRange {
+    std::size_t offset;
+    std::size_t size;
+};
+
+std::optional<std::size_t> ParseBytePosition(std::string_view str) {
+    std::size_t result = 0;
+    const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), result);
+    if (str.empty() || ec != std::errc{} || ptr != str.data() + str.size()) return std::nullopt;
+    return result;
+}
+
+// Parses the `Range` header. Returns nullopt if the header is malformed or
+// requests several ranges, so the whole file should be sent. Returns an empty
+// range if the range is not satisfiable.
+std::optional<ByteRange> ParseRange(std::string_view header, std::size_t file_size) {
+    constexpr std::string_view kBytesUnit = "bytes=";
+    if (!utils::text::StartsWith(header, kBytesUnit)) return std::nullopt;
+    header.remove_prefix(kBytesUnit.size());
+
+    const auto dash_pos = header.find('-');
+    if (dash_pos == std::string_view::npos || header.find(',') != std::string_view::npos) return std::nullopt;
+    const auto first = header.substr(0, dash_pos);
+    const auto last = header.substr(dash_pos + 1);
+
+    if (first.empty()) {
+        // suffix range, the last bytes of the file
+        const auto suffix_size = ParseBytePosition(last);
+        if (!suffix_size) return std::nullopt;
+        const auto size = std::min(*suffix_size, file_size);
+        return ByteRange{file_size - size, size};
+    }
+
+    const auto first_pos = ParseBytePosition(first);
+    if (!first_pos) return std::nullopt;
+    std::optional<std::size_t> last_pos;
+    if (!last.empty()) {
+        last_pos = ParseBytePosition(last);
+        if (!last_pos || *last_pos < *first_pos) return std::nullopt;
+    }
+
+    if (*first_pos >= file_size) return ByteRange{0, 0};
+    const auto end_pos = last_pos ? std::min(*last_pos, file_size - 1) + 1 : file_size;
+    return ByteRange{*first_pos, end_pos - *first_pos};
+}
+
+// Weak comparison of `If-None-Match` entity tags, see RFC 9110
+bool MatchesETag(std::string_view header, std::string_view etag) {
+    constexpr std::string_view kWeakPrefix = "W/";
+    for (auto tag : utils::text::SplitIntoStringViewVector(header, ",")) {
+        while (!tag.empty() && utils::text::IsAsciiSpace(tag.front())) tag.remove_prefix(1);
+        while (!tag.empty() && utils::text::IsAsciiSpace(tag.back())) tag.remove_suffix(1);
+        if (tag == "*") return true;
+        if (utils::text::StartsWith(tag, kWeakPrefix)) tag.remove_prefix(kWeakPrefix.size());
+        if (tag == etag) return true;
+    }
+    return false;
+}
+
 }  // namespace
 
 HttpHandlerStatic::HttpHandlerStatic(
@@ -51,14 +117,48 @@ std::string HttpHandlerStatic::HandleRequestThrow(const http::HttpRequest& reque
     LOG_DEBUG() << "Handler: " << request.GetRequestPath();
     auto& response = request.GetHttpResponse();
     const auto file = storage_.TryGetFile(request.GetRequestPath());
-    if (file) {
-        const auto config = config_.GetSnapshot();
-        response.SetHeader(USERVER_NAMESPACE::http::headers::kExpires, std::to_string(cache_age_.count()));
-        response.SetContentType(config[kContentTypeMap][file->extension]);
-        return file->data;
+    if (!file) {
+        response.SetStatusNotFound();
+        return "File not found";
+    }
+
+    const auto config = config_.GetSnapshot();
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kExpires, std::to_string(cache_age_.count()));
+    response.SetContentType(config[kContentTypeMap][file->extension]);
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kETag, file->etag);
+    response.SetHeader(USERVER_NAMESPACE::http::headers::kAcceptRanges, std::string{"bytes"});
+
+    const auto& if_none_match = request.GetHeader(USERVER_NAMESPACE::http::headers::kIfNoneMatch);
+    if (!if_none_match.empty() && MatchesETag(if_none_match, file->etag)) {
+        response.SetStatus(http::HttpStatus::kNotModified);
+        return {};
+    }
+
+    // The file is sent right from the cache, without copying it into the response
+    std::string_view body = file->data;
+    const auto& range_header = request.GetHeader(USERVER_NAMESPACE::http::headers::kRange);
+    const auto& if_range = request.GetHeader(USERVER_NAMESPACE::http::headers::kIfRange);
+    if (!range_header.empty() && (if_range.empty() || if_range == file->etag)) {
+        if (const auto range = ParseRange(range_header, body.size())) {
+            if (range->size == 0) {
+                response.SetStatus(http::HttpStatus::kRangeNotSatisfiable);
+                response.SetHeader(
+                    USERVER_NAMESPACE::http::headers::kContentRange, fmt::format("bytes */{}", body.size())
+                );
+                return {};
+            }
+
+            response.SetStatus(http::HttpStatus::kPartialContent);
+            response.SetHeader(
+                USERVER_NAMESPACE::http::headers::kContentRange,
+                fmt::format("bytes {}-{}/{}", range->offset, range->offset + range->size - 1, body.size())
+            );
+            body = body.substr(range->offset, range->size);
+        }
     }
-    response.SetStatusNotFound();
-    return "File not found";
+
+    response.SetSharedData(file, body);
+    return {};
 }
 
 yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
@@ -66,7 +166,8 @@ yaml_config::Schema HttpHandlerStatic::GetStaticConfigSchema() {
 type: object
 description: |
     Handler that returns HTTP 200 if file exist
-    and returns file data with mapped content/type
+    and returns file data with mapped content/type,
+    supports ETag validation and single byte ranges
 additionalProperties: false
 properties:
     fs-cache-component:
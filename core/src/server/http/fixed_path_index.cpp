@@ -32,11 +32,25 @@ void FixedPathIndex::AddHandler(
     handler_method_index_map_[std::move(path)].AddHandler(handler, task_processor, {});
 }
 
+void FixedPathIndex::Freeze() {
+    std::vector<std::string_view> paths;
+    std::vector<const HandlerMethodIndex*> handler_method_indices;
+    paths.reserve(handler_method_index_map_.size());
+    handler_method_indices.reserve(handler_method_index_map_.size());
+    for (const auto& [path, handler_method_index] : handler_method_index_map_) {
+        paths.push_back(path);
+        handler_method_indices.push_back(&handler_method_index);
+    }
+
+    frozen_paths_ = StringPerfectHash{paths};
+    frozen_handler_method_indices_ = std::move(handler_method_indices);
+}
+
 bool FixedPathIndex::MatchRequest(HttpMethod method, const std::string& path, MatchRequestResult& match_result) const {
-    auto it = handler_method_index_map_.find(path);
-    if (it == handler_method_index_map_.end()) return false;
+    const auto index = frozen_paths_.Find(path);
+    if (!index) return false;
 
-    const auto* handler_info_data = it->second.GetHandlerInfoData(method);
+    const auto* handler_info_data = frozen_handler_method_indices_[*index]->GetHandlerInfoData(method);
     if (!handler_info_data) {
         match_result.status = MatchRequestResult::Status::kMethodNotAllowed;
         return false;
@@ -2,11 +2,13 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <server/http/handler_info_index.hpp>
 #include <server/http/handler_method_index.hpp>
+#include <server/http/string_perfect_hash.hpp>
 #include <userver/server/handlers/http_handler_base.hpp>
 #include <userver/server/http/http_method.hpp>
 
@@ -17,12 +19,21 @@ namespace server::http::impl {
 class FixedPathIndex final {
 public:
     void AddHandler(const handlers::HttpHandlerBase& handler, engine::TaskProcessor& task_processor);
+
+    // Builds the lookup table for MatchRequest(), must be called after the
+    // handlers are added
+    void Freeze();
+
     bool MatchRequest(HttpMethod method, const std::string& path, MatchRequestResult& match_result) const;
 
 private:
     void AddHandler(std::string path, const handlers::HttpHandlerBase& handler, engine::TaskProcessor& task_processor);
 
     std::unordered_map<std::string, HandlerMethodIndex> handler_method_index_map_;
+
+    StringPerfectHash frozen_paths_;
+    // Indexed by the key indices of frozen_paths_
+    std::vector<const HandlerMethodIndex*> frozen_handler_method_indices_;
 };
 
 }  // namespace server::http::impl
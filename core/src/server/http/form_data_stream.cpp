@@ -0,0 +1,169 @@
+#include <userver/server/http/form_data_stream.hpp>
+
+#include <algorithm>
+
+#include <userver/http/common_headers.hpp>
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
+#include <userver/utils/assert.hpp>
+
+#include "multipart_form_data_parser.hpp"
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+constexpr std::string_view kCrLf = "\r\n";
+constexpr std::string_view kHeadersEnd = "\r\n\r\n";
+constexpr std::string_view kLastDelimiterSuffix = "--";
+constexpr std::size_t kMaxPartHeadersSize = 16 * 1024;
+
+[[noreturn]] void ThrowMalformedBody(std::string_view message) {
+    throw handlers::ClientError(handlers::InternalMessage{
+        std::string{"Malformed multipart/form-data body: "}.append(message)});
+}
+
+}  // namespace
+
+struct FormDataStream::Impl {
+    enum class State {
+        kValue,
+        kDelimiter,
+        kEnd,
+    };
+
+    Impl(std::string&& delimiter, ChunkReader&& read_chunk)
+        : read_chunk(std::move(read_chunk)), delimiter(std::move(delimiter)) {}
+
+    std::string_view Unparsed() const noexcept { return std::string_view{buffer}.substr(pos); }
+
+    bool ReadMore(engine::Deadline deadline) {
+        buffer.erase(0, pos);
+        pos = 0;
+        std::string chunk;
+        if (!read_chunk(chunk, deadline)) return false;
+        buffer.append(chunk);
+        return true;
+    }
+
+    ChunkReader read_chunk;
+    const std::string delimiter;
+    // The first delimiter is not preceded by a line break
+    std::string buffer{kCrLf};
+    std::size_t pos{0};
+    // The preamble before the first delimiter is skipped as a part value
+    State state{State::kValue};
+};
+
+FormDataStream::FormDataStream(const HttpRequest& request)
+    : FormDataStream(
+          request.GetHeader(USERVER_NAMESPACE::http::headers::kContentType),
+          [&body_stream = request.GetBodyStream()](std::string& chunk, engine::Deadline deadline) {
+              return body_stream.ReadChunk(chunk, deadline);
+          }
+      ) {}
+
+FormDataStream::FormDataStream(std::string_view content_type, ChunkReader read_chunk) {
+    std::string boundary;
+    std::string charset;
+    if (!ParseMultipartFormDataContentType(content_type, boundary, charset)) {
+        throw handlers::ClientError(handlers::InternalMessage{"Not a multipart/form-data content type"});
+    }
+    impl_ = std::make_unique<Impl>(MakeMultipartDelimiter(boundary), std::move(read_chunk));
+}
+
+FormDataStream::FormDataStream(FormDataStream&&) noexcept = default;
+
+FormDataStream& FormDataStream::operator=(FormDataStream&&) noexcept = default;
+
+FormDataStream::~FormDataStream() = default;
+
+bool FormDataStream::NextPart(Part& part, engine::Deadline deadline) {
+    auto& impl = *impl_;
+
+    std::string skipped;
+    while (ReadChunk(skipped, deadline)) {
+    }
+    if (impl.state == Impl::State::kEnd) return false;
+    UASSERT(impl.state == Impl::State::kDelimiter);
+
+    // The delimiter is followed by "--" if it is the last one, or by optional
+    // spaces and a line break otherwise
+    while (true) {
+        auto unparsed = impl.Unparsed();
+        const auto spaces = std::min(unparsed.find_first_not_of(" \t"), unparsed.size());
+        unparsed.remove_prefix(spaces);
+        if (unparsed.size() >= 2) {
+            if (unparsed.substr(0, 2) == kLastDelimiterSuffix) {
+                impl.state = Impl::State::kEnd;
+                return false;
+            }
+            if (unparsed.substr(0, 2) != kCrLf) ThrowMalformedBody("line break expected after a boundary");
+            impl.pos += spaces + kCrLf.size();
+            break;
+        }
+        if (!impl.ReadMore(deadline)) ThrowMalformedBody("unexpected end of the body after a boundary");
+    }
+
+    while (true) {
+        const auto unparsed = impl.Unparsed();
+        auto headers_size = std::string_view::npos;
+        if (unparsed.substr(0, kCrLf.size()) == kCrLf) {
+            headers_size = kCrLf.size();
+        } else if (const auto headers_end = unparsed.find(kHeadersEnd); headers_end != std::string_view::npos) {
+            headers_size = headers_end + kHeadersEnd.size();
+        }
+
+        if (headers_size != std::string_view::npos) {
+            FormDataArg arg;
+            if (!ParseMultipartFormDataPartHeaders(unparsed.substr(0, headers_size), part.name, arg)) {
+                ThrowMalformedBody("bad headers of a part");
+            }
+            part.filename = std::move(arg.filename);
+            part.content_type.reset();
+            if (arg.content_type) part.content_type.emplace(*arg.content_type);
+
+            impl.pos += headers_size;
+            impl.state = Impl::State::kValue;
+            return true;
+        }
+
+        if (unparsed.size() > kMaxPartHeadersSize) ThrowMalformedBody("too large headers of a part");
+        if (!impl.ReadMore(deadline)) ThrowMalformedBody("unexpected end of the body in the headers of a part");
+    }
+}
+
+bool FormDataStream::ReadChunk(std::string& chunk, engine::Deadline deadline) {
+    auto& impl = *impl_;
+    if (impl.state != Impl::State::kValue) return false;
+
+    while (true) {
+        const auto unparsed = impl.Unparsed();
+        const auto delimiter_pos = FindMultipartDelimiter(unparsed, impl.delimiter);
+        if (delimiter_pos == 0) {
+            impl.pos += impl.delimiter.size();
+            impl.state = Impl::State::kDelimiter;
+            return false;
+        }
+
+        // Without a delimiter, the tail of the data might be the beginning of
+        // the delimiter that is not fully received yet
+        const auto value_size = delimiter_pos != std::string_view::npos
+                                    ? delimiter_pos
+                                    : unparsed.size() - std::min(unparsed.size(), impl.delimiter.size() - 1);
+        if (value_size > 0) {
+            chunk.assign(unparsed.substr(0, value_size));
+            impl.pos += value_size;
+            return true;
+        }
+
+        if (!impl.ReadMore(deadline)) ThrowMalformedBody("unexpected end of the body in a part value");
+    }
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,123 @@
+#include <userver/utest/utest.hpp>
+
+#include <userver/server/handlers/exceptions.hpp>
+#include <userver/server/http/form_data_stream.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+const std::string kContentType = "multipart/form-data; boundary=------------------------8099aaf9723cd601";
+
+const std::string kBody =
+    "preamble\r\n"
+    "--------------------------8099aaf9723cd601\r\n"
+    "Content-Disposition: form-data; name=\"arg1\"\r\n"
+    "\r\n"
+    "value1\r\n"
+    "--------------------------8099aaf9723cd601 \r\n"
+    "Content-Disposition: form-data; name=\"file\"; filename=\"file.bin\"\r\n"
+    "Content-Type: application/octet-stream\r\n"
+    "\r\n"
+    "\r\n--------------------------8099aaf9723cd60\r\n-\r\n"
+    "--------------------------8099aaf9723cd601\r\n"
+    "Content-Disposition: form-data; name=\"empty\"\r\n"
+    "\r\n"
+    "\r\n"
+    "--------------------------8099aaf9723cd601--\r\n"
+    "epilogue";
+
+server::http::FormDataStream::ChunkReader MakeChunkReader(std::string body, std::size_t chunk_size) {
+    return [body = std::move(body), chunk_size, pos = std::size_t{0}](std::string& chunk, engine::Deadline) mutable {
+        if (pos == body.size()) return false;
+        chunk = body.substr(pos, chunk_size);
+        pos += chunk.size();
+        return true;
+    };
+}
+
+std::string ReadValue(server::http::FormDataStream& form_data) {
+    std::string value;
+    std::string chunk;
+    while (form_data.ReadChunk(chunk)) {
+        EXPECT_FALSE(chunk.empty());
+        value += chunk;
+    }
+    return value;
+}
+
+}  // namespace
+
+TEST(FormDataStream, Parts) {
+    for (std::size_t chunk_size = 1; chunk_size <= kBody.size(); ++chunk_size) {
+        server::http::FormDataStream form_data{kContentType, MakeChunkReader(kBody, chunk_size)};
+        server::http::FormDataStream::Part part;
+
+        ASSERT_TRUE(form_data.NextPart(part)) << "chunk size: " << chunk_size;
+        EXPECT_EQ(part.name, "arg1");
+        EXPECT_FALSE(part.filename);
+        EXPECT_FALSE(part.content_type);
+        EXPECT_EQ(ReadValue(form_data), "value1");
+
+        ASSERT_TRUE(form_data.NextPart(part)) << "chunk size: " << chunk_size;
+        EXPECT_EQ(part.name, "file");
+        EXPECT_EQ(part.filename, "file.bin");
+        EXPECT_EQ(part.content_type, "application/octet-stream");
+        EXPECT_EQ(ReadValue(form_data), "\r\n--------------------------8099aaf9723cd60\r\n-");
+
+        ASSERT_TRUE(form_data.NextPart(part)) << "chunk size: " << chunk_size;
+        EXPECT_EQ(part.name, "empty");
+        EXPECT_FALSE(part.filename);
+        EXPECT_FALSE(part.content_type);
+        EXPECT_EQ(ReadValue(form_data), "");
+
+        EXPECT_FALSE(form_data.NextPart(part));
+        EXPECT_FALSE(form_data.NextPart(part));
+    }
+}
+
+TEST(FormDataStream, SkipValues) {
+    for (std::size_t chunk_size = 1; chunk_size <= kBody.size(); ++chunk_size) {
+        server::http::FormDataStream form_data{kContentType, MakeChunkReader(kBody, chunk_size)};
+        server::http::FormDataStream::Part part;
+        std::vector<std::string> names;
+        while (form_data.NextPart(part)) names.push_back(part.name);
+        EXPECT_EQ(names, (std::vector<std::string>{"arg1", "file", "empty"}));
+    }
+}
+
+TEST(FormDataStream, NotMultipart) {
+    EXPECT_THROW(
+        server::http::FormDataStream("text/plain", MakeChunkReader(kBody, 1)), server::handlers::ClientError
+    );
+}
+
+TEST(FormDataStream, MalformedBody) {
+    const std::string kNoEnd =
+        "--zzz\r\n"
+        "Content-Disposition: form-data; name=\"arg\"\r\n"
+        "\r\n"
+        "some text";
+    const std::string kNoContentDisposition =
+        "--zzz\r\n"
+        "Content-Type: text/plain\r\n"
+        "\r\n"
+        "some text\r\n"
+        "--zzz--\r\n";
+    const std::string kGarbageAfterBoundary =
+        "--zzz garbage\r\n"
+        "Content-Disposition: form-data; name=\"arg\"\r\n"
+        "\r\n"
+        "some text\r\n"
+        "--zzz--\r\n";
+
+    for (const auto& body : {kNoEnd, kNoContentDisposition, kGarbageAfterBoundary}) {
+        server::http::FormDataStream form_data{"multipart/form-data; boundary=zzz", MakeChunkReader(body, 4)};
+        server::http::FormDataStream::Part part;
+        EXPECT_THROW(
+            while (form_data.NextPart(part)) ReadValue(form_data), server::handlers::ClientError
+        ) << body;
+    }
+}
+
+USERVER_NAMESPACE_END
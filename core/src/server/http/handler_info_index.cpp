@@ -23,6 +23,8 @@ class HandlerInfoIndex::HandlerInfoIndexImpl final {
 public:
     void AddHandler(const handlers::HttpHandlerBase& handler, engine::TaskProcessor& task_processor);
 
+    void Freeze();
+
     const HandlerList& GetHandlers() const;
 
     MatchRequestResult MatchRequest(HttpMethod method, const std::string& path) const;
@@ -35,6 +37,7 @@ private:
     impl::FixedPathIndex fixed_path_index_;
     impl::WildcardPathIndex wildcard_path_index_;
     FallbackHandlersStorage fallback_handlers_{};
+    bool is_frozen_{false};
 };
 
 void HandlerInfoIndex::HandlerInfoIndexImpl::AddHandler(
@@ -48,6 +51,13 @@ void HandlerInfoIndex::HandlerInfoIndexImpl::AddHandler(
         wildcard_path_index_.AddHandler(handler, task_processor);
     }
     handler_list_.emplace_back(&handler);
+    is_frozen_ = false;
+}
+
+void HandlerInfoIndex::HandlerInfoIndexImpl::Freeze() {
+    fixed_path_index_.Freeze();
+    wildcard_path_index_.Freeze();
+    is_frozen_ = true;
 }
 
 const HandlerInfoIndex::HandlerList& HandlerInfoIndex::HandlerInfoIndexImpl::GetHandlers() const {
@@ -56,6 +66,8 @@ const HandlerInfoIndex::HandlerList& HandlerInfoIndex::HandlerInfoIndexImpl::Get
 
 MatchRequestResult HandlerInfoIndex::HandlerInfoIndexImpl::MatchRequest(HttpMethod method, const std::string& path)
     const {
+    UASSERT_MSG(is_frozen_ || handler_list_.empty(), "HandlerInfoIndex::Freeze() was not called");
+
     MatchRequestResult match_result;
     if (fixed_path_index_.MatchRequest(method, path, match_result)) return match_result;
 
@@ -96,6 +108,8 @@ void HandlerInfoIndex::AddHandler(const handlers::HttpHandlerBase& handler, engi
     );
 }
 
+void HandlerInfoIndex::Freeze() { impl_->Freeze(); }
+
 const HandlerInfoIndex::HandlerList& HandlerInfoIndex::GetHandlers() const { return impl_->GetHandlers(); }
 
 MatchRequestResult HandlerInfoIndex::MatchRequest(HttpMethod method, const std::string& path) const {
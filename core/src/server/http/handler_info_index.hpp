@@ -42,6 +42,10 @@ public:
 
     void AddHandler(const handlers::HttpHandlerBase& handler, engine::TaskProcessor& task_processor);
 
+    /// Rebuilds the index into read-only lookup structures, must be called
+    /// after the last AddHandler() and before MatchRequest()
+    void Freeze();
+
     using HandlerList = std::vector<utils::NotNull<const handlers::HttpHandlerBase*>>;
     const HandlerList& GetHandlers() const;
 
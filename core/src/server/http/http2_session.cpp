@@ -43,7 +43,8 @@ Http2Session::Http2Session(
     net::ParserStats& stats,
     request::ResponseDataAccounter& data_accounter,
     engine::io::Sockaddr remote_address,
-    engine::io::RwBase* socket
+    engine::io::RwBase* socket,
+    const RequestHandlerBase* request_handler
 )
     : config_(config),
       streams_pool_(config_.max_concurrent_streams),
@@ -53,6 +54,7 @@ Http2Session::Http2Session(
       data_accounter_(data_accounter),
       stats_(stats),
       remote_address_(remote_address),
+      request_handler_(request_handler),
       socket_(socket),
       streaming_queue_(impl::Http2StreamEventQueue::Create()),
       streaming_consumer_(streaming_queue_->GetConsumer()) {
@@ -72,8 +74,19 @@ Http2Session::Http2Session(
     nghttp2_session_callbacks_set_on_begin_headers_callback(callbacks, OnBeginHeaders);
     nghttp2_session_callbacks_set_on_data_chunk_recv_callback(callbacks, OnDataChunkRecv);
 
+    nghttp2_option* option{nullptr};
+    UINVARIANT(nghttp2_option_new(&option) == 0, "Failed to init options for HTTP/2.0");
+
+    utils::FastScopeGuard delete_option_guard{[&option]() noexcept { nghttp2_option_del(option); }};
+
+    // The windows of the streams with streamed request bodies are updated as
+    // the handlers read the chunks, see OnDataChunkRecv()
+    nghttp2_option_set_no_auto_window_update(option, 1);
+
     nghttp2_session* session{nullptr};
-    UINVARIANT(nghttp2_session_server_new(&session, callbacks, this) == 0, "Failed to init session for HTTP/2.0");
+    UINVARIANT(
+        nghttp2_session_server_new2(&session, callbacks, this, option) == 0, "Failed to init session for HTTP/2.0"
+    );
     UASSERT(session);
     session_ = SessionPtr(session, nghttp2_session_del);
 
@@ -86,6 +99,7 @@ Http2Session::Http2Session(
     ThrowIfErr(rv, "Error when submit settings");
     rv = nghttp2_session_send(session_.get());
     ThrowIfErr(rv, "Error when session send");
+    FlushWriteBatch();
 }
 
 int Http2Session::OnFrameRecv(nghttp2_session* session, const nghttp2_frame* frame, void* user_data) {
@@ -96,15 +110,35 @@ int Http2Session::OnFrameRecv(nghttp2_session* session, const nghttp2_frame* fra
     switch (frame->hd.type) {
         case NGHTTP2_DATA:
         case NGHTTP2_HEADERS: {
-            if (frame->hd.flags & NGHTTP2_FLAG_END_STREAM) {
-                auto& stream = parser.GetStreamChecked(Stream::Id{frame->hd.stream_id});
-                try {
-                    stream.RequestConstructor().AppendHeaderField("", 0);
-                } catch (const std::exception& e) {
-                    IncStat(parser.stats_.http2_stats.streams_parse_error);
-                    LOG_LIMITED_WARNING() << "can't append header field: " << e;
-                }
-                parser.FinalizeRequest(stream);
+            const bool is_end_stream = frame->hd.flags & NGHTTP2_FLAG_END_STREAM;
+            const bool is_request_headers =
+                frame->hd.type == NGHTTP2_HEADERS && frame->headers.cat == NGHTTP2_HCAT_REQUEST;
+            if (!is_end_stream && !is_request_headers) break;
+
+            auto* stream = parser.FindStream(Stream::Id{frame->hd.stream_id});
+            if (!stream) break;
+            auto& ctor = stream->RequestConstructor();
+            if (ctor.IsBodyStreamStarted()) {
+                // The body is being passed to the handler
+                if (is_end_stream) ctor.FinishBodyStream();
+                break;
+            }
+            // The handler with `request-body-stream` gets the request right
+            // after its headers and reads the body while it is being received
+            if (!is_end_stream && !ctor.IsBodyStreamed()) break;
+
+            try {
+                ctor.AppendHeaderField("", 0);
+            } catch (const std::exception& e) {
+                IncStat(parser.stats_.http2_stats.streams_parse_error);
+                LOG_LIMITED_WARNING() << "can't append header field: " << e;
+            }
+            parser.FinalizeRequest(*stream);
+            if (!is_end_stream) break;
+            // The stream is removed if the request is malformed
+            stream = parser.FindStream(Stream::Id{frame->hd.stream_id});
+            if (stream && stream->RequestConstructor().IsBodyStreamStarted()) {
+                stream->RequestConstructor().FinishBodyStream();
             }
         } break;
         case NGHTTP2_RST_STREAM: {
@@ -189,20 +223,30 @@ int Http2Session::OnBeginHeaders(nghttp2_session*, const nghttp2_frame* frame, v
 }
 
 int Http2Session::OnDataChunkRecv(
-    nghttp2_session*,
+    nghttp2_session* session,
     uint8_t,
     int32_t id,
     const uint8_t* data,
     size_t len,
     void* user_data
 ) {
+    // The data never waits in the session, so the connection window is
+    // updated right away and a slow handler does not stall the other streams
+    if (nghttp2_session_consume_connection(session, len) != 0) return NGHTTP2_ERR_CALLBACK_FAILURE;
+
     auto& parser = GetParser(user_data);
     auto& stream = parser.GetStreamChecked(Stream::Id{id});
+    auto& ctor = stream.RequestConstructor();
     try {
-        stream.RequestConstructor().AppendBody(reinterpret_cast<const char*>(data), len);
+        ctor.AppendBody(reinterpret_cast<const char*>(data), len);
     } catch (const std::exception& e) {
         LOG_LIMITED_WARNING() << "can't append body: " << e;
     }
+    // The handler updates the stream window as it reads the streamed body, see
+    // HandleStreamingEvents()
+    if (!ctor.IsBodyStreamFlowControlled() && nghttp2_session_consume_stream(session, id, len) != 0) {
+        return NGHTTP2_ERR_CALLBACK_FAILURE;
+    }
     return 0;
 }
 
@@ -211,7 +255,9 @@ long Http2Session::OnSend(nghttp2_session* session, const uint8_t* data, size_t
     UASSERT(data);
     auto& parser = GetParser(user_data);
     if (parser.socket_ != nullptr) {
-        return parser.socket_->WriteAll(data, len, {});
+        parser.write_batch_.AppendCopy(ToStringView(data, len));
+        parser.FlushWriteBatchIfFull();
+        return static_cast<long>(len);
     }
     return NGHTTP2_ERR_WOULDBLOCK;
 }
@@ -234,11 +280,9 @@ int Http2Session::OnDataFrameSend(
     UASSERT(parser.socket_);
     auto& stream = *static_cast<Stream*>(source->ptr);
 
-    const auto frame_header{ToStringView(framehd, kFrameHeaderSize)};
-    // TODO: doesn't work with TLS?!
-    UASSERT(dynamic_cast<engine::io::Socket*>(parser.socket_));
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-    stream.Send(*static_cast<engine::io::Socket*>(parser.socket_), frame_header, max_len);
+    parser.write_batch_.AppendCopy(ToStringView(framehd, kFrameHeaderSize));
+    stream.Send(parser.write_batch_, max_len);
+    parser.FlushWriteBatchIfFull();
     return 0;
 }
 
@@ -250,7 +294,8 @@ void Http2Session::RegisterStream(Stream::Id id) {
     }
     utils::FastScopeGuard guard_free{[this, stream_ptr]() noexcept { streams_pool_.free(stream_ptr); }};
 
-    new (stream_ptr) Stream(request_constructor_config_, handler_info_index_, data_accounter_, remote_address_, id);
+    new (stream_ptr)
+        Stream(request_constructor_config_, handler_info_index_, data_accounter_, remote_address_, request_handler_, id);
     guard_free.Release();
 
     utils::FastScopeGuard guard_destroy{[this, stream_ptr]() noexcept { streams_pool_.destroy(stream_ptr); }};
@@ -277,9 +322,12 @@ void Http2Session::RemoveStream(Stream& stream) {
     stats_.parsing_request_count.Subtract(1);
 }
 
+Stream* Http2Session::FindStream(Stream::Id id) {
+    return static_cast<Stream*>(nghttp2_session_get_stream_user_data(session_.get(), static_cast<std::int32_t>(id)));
+}
+
 Stream& Http2Session::GetStreamChecked(Stream::Id id) {
-    auto* stream =
-        static_cast<Stream*>(nghttp2_session_get_stream_user_data(session_.get(), static_cast<std::int32_t>(id)));
+    auto* stream = FindStream(id);
     if (stream == nullptr) {
         throw std::runtime_error{fmt::format("The stream {} does not exist", id)};
     }
@@ -328,9 +376,14 @@ void Http2Session::FinalizeRequest(Stream& stream) {
         RemoveStream(stream);
         return;
     }
-    stream.RequestConstructor().SetResponseStreamId(static_cast<std::int32_t>(stream.GetId()));
-    stream.RequestConstructor().SetStreamProducer(impl::Http2StreamEventProducer{*streaming_queue_, streaming_event_});
-    if (auto request = stream.RequestConstructor().Finalize()) {
+    auto& ctor = stream.RequestConstructor();
+    const auto stream_id = static_cast<std::int32_t>(stream.GetId());
+    ctor.SetResponseStreamId(stream_id);
+    ctor.SetStreamProducer(impl::Http2StreamEventProducer{*streaming_queue_, streaming_event_});
+    if (ctor.IsBodyStreamed()) {
+        ctor.SetBodyStreamWindowProducer(impl::Http2StreamEventProducer{*streaming_queue_, streaming_event_}, stream_id);
+    }
+    if (auto request = ctor.Finalize()) {
         on_new_request_cb_(std::move(request));
     } else {
         IncStat(stats_.http2_stats.streams_parse_error);
@@ -349,6 +402,17 @@ void Http2Session::WriteWhileWant() {
         const auto res = nghttp2_session_send(session);
         ThrowIfErr(res, "Error while nghttp2_session_send");
     }
+    FlushWriteBatch();
+}
+
+void Http2Session::FlushWriteBatch() {
+    if (write_batch_.IsEmpty()) return;
+    UASSERT(socket_);
+    write_batch_.Flush(*socket_);
+}
+
+void Http2Session::FlushWriteBatchIfFull() {
+    if (write_batch_.IsFull()) FlushWriteBatch();
 }
 
 engine::SingleConsumerEvent& Http2Session::GetStreamingEvent() { return streaming_event_; }
@@ -357,6 +421,14 @@ void Http2Session::HandleStreamingEvents() {
     impl::Http2StreamEvent event;
     while (streaming_consumer_.PopNoblock(event)) {
         UASSERT(event.stream_id != -1);
+        if (event.consumed_body_size != 0) {
+            // The stream may be already closed, nghttp2 ignores the update then
+            const auto res =
+                nghttp2_session_consume_stream(session_.get(), event.stream_id, event.consumed_body_size);
+            ThrowIfErr(res, "Error while consume_stream");
+            event = {};
+            continue;
+        }
         auto& stream = GetStreamChecked(Stream::Id{event.stream_id});
         if (stream.IsDeferred()) {
             const auto res = nghttp2_session_resume_data(session_.get(), static_cast<std::int32_t>(stream.GetId()));
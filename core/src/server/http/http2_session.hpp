@@ -4,6 +4,7 @@
 #include <boost/pool/object_pool.hpp>
 
 #include <server/http/http2_stream.hpp>
+#include <server/http/http2_write_batch.hpp>
 #include <server/http/http2_writer.hpp>
 #include <server/http/http_request_constructor.hpp>
 #include <server/net/stats.hpp>
@@ -44,7 +45,8 @@ public:
         net::ParserStats& stats,
         request::ResponseDataAccounter& data_accounter,
         engine::io::Sockaddr remote_address,
-        engine::io::RwBase* socket = nullptr
+        engine::io::RwBase* socket = nullptr,
+        const RequestHandlerBase* request_handler = nullptr
     );
 
     Http2Session(const Http2Session&) = delete;
@@ -60,6 +62,7 @@ public:
 
     engine::SingleConsumerEvent& GetStreamingEvent();
 
+    // Sends the frames of all the ready streams with a single write
     void WriteWhileWant();
     void HandleStreamingEvents();
 
@@ -103,6 +106,7 @@ private:
 
     void RegisterStream(Stream::Id id);
     void RemoveStream(Stream& id);
+    Stream* FindStream(Stream::Id id);
     Stream& GetStreamChecked(Stream::Id id);
 
     void SubmitRstStream(Stream::Id stream_id);
@@ -110,6 +114,9 @@ private:
     void FinalizeRequest(Stream& stream);
     bool ConnectionIsOk();
 
+    void FlushWriteBatch();
+    void FlushWriteBatchIfFull();
+
 private:
     friend class Http2ResponseWriter;
 
@@ -127,7 +134,9 @@ private:
 
     net::ParserStats& stats_;
     engine::io::Sockaddr remote_address_;
+    const RequestHandlerBase* request_handler_;
     engine::io::RwBase* socket_;
+    Http2WriteBatch write_batch_;
 
     std::shared_ptr<impl::Http2StreamEventQueue> streaming_queue_{nullptr};
     engine::SingleConsumerEvent streaming_event_;
@@ -0,0 +1,134 @@
+#include <server/http/http2_session.hpp>
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <nghttp2/nghttp2.h>
+
+#include <server/http/http2_writer.hpp>
+#include <server/net/connection_config.hpp>
+#include <userver/engine/async.hpp>
+#include <userver/engine/io/socket.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+constexpr auto kDeadlineMaxTime = std::chrono::seconds{60};
+
+nghttp2_nv MakeHeader(std::string_view name, std::string_view value) {
+    return {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        reinterpret_cast<std::uint8_t*>(const_cast<char*>(name.data())),
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        reinterpret_cast<std::uint8_t*>(const_cast<char*>(value.data())),
+        name.size(),
+        value.size(),
+        NGHTTP2_NV_FLAG_NONE};
+}
+
+// Client connection preface followed by `streams_count` GET requests
+std::string MakeClientRequests(std::size_t streams_count) {
+    nghttp2_session_callbacks* callbacks{nullptr};
+    UINVARIANT(nghttp2_session_callbacks_new(&callbacks) == 0, "Failed to init callbacks");
+    nghttp2_session* session{nullptr};
+    UINVARIANT(nghttp2_session_client_new(&session, callbacks, nullptr) == 0, "Failed to init client session");
+    nghttp2_session_callbacks_del(callbacks);
+
+    // Flow control must not limit the responses
+    constexpr std::int32_t kMaxWindowSize = NGHTTP2_MAX_WINDOW_SIZE;
+    const nghttp2_settings_entry window_size{NGHTTP2_SETTINGS_INITIAL_WINDOW_SIZE, kMaxWindowSize};
+    UINVARIANT(nghttp2_submit_settings(session, NGHTTP2_FLAG_NONE, &window_size, 1) == 0, "Failed to submit settings");
+    UINVARIANT(
+        nghttp2_submit_window_update(session, NGHTTP2_FLAG_NONE, 0, kMaxWindowSize - NGHTTP2_INITIAL_CONNECTION_WINDOW_SIZE
+        ) == 0,
+        "Failed to submit window update"
+    );
+    const std::array<nghttp2_nv, 4> headers{
+        MakeHeader(":method", "GET"),
+        MakeHeader(":scheme", "http"),
+        MakeHeader(":authority", "localhost"),
+        MakeHeader(":path", "/"),
+    };
+    for (std::size_t i = 0; i < streams_count; ++i) {
+        const auto stream_id = nghttp2_submit_request(session, nullptr, headers.data(), headers.size(), nullptr, nullptr);
+        UINVARIANT(stream_id > 0, "Failed to submit request");
+    }
+
+    std::string result;
+    const std::uint8_t* data{nullptr};
+    for (auto len = nghttp2_session_mem_send(session, &data); len > 0; len = nghttp2_session_mem_send(session, &data)) {
+        result.append(reinterpret_cast<const char*>(data), len);
+    }
+    nghttp2_session_del(session);
+    return result;
+}
+
+}  // namespace
+
+// Responses to many concurrent streams of a single connection
+void http2_session_respond_streams(benchmark::State& state) {
+    engine::RunStandalone([&] {
+        const auto streams_count = static_cast<std::size_t>(state.range(0));
+        const std::string body(state.range(1), 'b');
+        const auto client_requests = MakeClientRequests(streams_count);
+
+        const auto deadline = engine::Deadline::FromDuration(kDeadlineMaxTime);
+        auto [server_socket, client_socket] = internal::net::TcpListener{}.MakeSocketPair(deadline);
+        auto reader = engine::AsyncNoSpan([&client_socket = client_socket, deadline] {
+            std::array<char, 64 * 1024> buffer{};
+            while (client_socket.RecvSome(buffer.data(), buffer.size(), deadline) > 0) {
+            }
+        });
+
+        const server::http::HandlerInfoIndex handler_info_index;
+        server::request::HttpRequestConfig request_config;
+        request_config.testing_mode = true;
+        const server::net::Http2SessionConfig session_config;
+        server::net::ParserStats stats;
+        server::request::ResponseDataAccounter accounter;
+
+        std::vector<std::shared_ptr<server::http::HttpRequest>> requests;
+        requests.reserve(streams_count);
+        for ([[maybe_unused]] auto _ : state) {
+            server::http::Http2Session session{
+                handler_info_index,
+                request_config,
+                session_config,
+                [&requests](std::shared_ptr<server::http::HttpRequest>&& request) {
+                    requests.push_back(std::move(request));
+                },
+                stats,
+                accounter,
+                engine::io::Sockaddr{},
+                &server_socket};
+            session.Parse(client_requests);
+
+            for (const auto& request : requests) {
+                auto& response = request->GetHttpResponse();
+                response.SetData(body);
+                server::http::WriteHttp2ResponseToSocket(response, session);
+            }
+            requests.clear();
+        }
+
+        state.SetItemsProcessed(state.iterations() * streams_count);
+        server_socket.Close();
+        reader.Get();
+    });
+}
+BENCHMARK(http2_session_respond_streams)
+    ->ArgNames({"streams", "body"})
+    ->Args({1, 1024})
+    ->Args({100, 1024})
+    ->Args({100, 64 * 1024});
+
+USERVER_NAMESPACE_END
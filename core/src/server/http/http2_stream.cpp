@@ -1,6 +1,6 @@
 #include <server/http/http2_stream.hpp>
 
-#include <userver/engine/io/socket.hpp>
+#include <server/http/http2_write_batch.hpp>
 
 #include <numeric>  // std::accumulate
 
@@ -30,9 +30,10 @@ Stream::Stream(
     const HandlerInfoIndex& handler_info_index,
     request::ResponseDataAccounter& data_accounter,
     engine::io::Sockaddr remote_address,
+    const RequestHandlerBase* request_handler,
     Id id
 )
-    : constructor_(config, handler_info_index, data_accounter, remote_address), id_(id) {
+    : constructor_(config, handler_info_index, data_accounter, remote_address, request_handler), id_(id) {
     constructor_.SetHttpMajor(2);
     constructor_.SetHttpMinor(0);
     nghttp2_provider_.read_callback = NgHttp2ReadCallback;
@@ -100,30 +101,30 @@ ssize_t Stream::GetMaxSize(std::size_t max_len, std::uint32_t* flags) {
     return res;
 }
 
-void Stream::Send(engine::io::Socket& socket, std::string_view data_frame_header, std::size_t max_len) {
-    boost::container::small_vector<engine::io::IoData, 16> parts{};
-    parts.push_back({data_frame_header.data(), data_frame_header.size()});
+void Stream::Send(Http2WriteBatch& batch, std::size_t max_len) {
     auto budget = max_len;
+    std::size_t sent_chunks = 0;
     for (const auto& chunk : chunks_) {
         if (budget == 0) {
             break;
         }
         UASSERT(chunk.size() > pos_in_first_chunk_);
-        const auto part =
-            std::string_view{chunk}.substr(pos_in_first_chunk_, std::min(chunk.size() - pos_in_first_chunk_, budget));
-        parts.push_back({part.data(), part.size()});
-        pos_in_first_chunk_ += part.size();
-        if (pos_in_first_chunk_ >= chunk.size()) {
-            pos_in_first_chunk_ = 0;
+        const auto size = std::min(chunk.size() - pos_in_first_chunk_, budget);
+        batch.AppendChunkPart(chunk, pos_in_first_chunk_, size);
+        pos_in_first_chunk_ += size;
+        budget -= size;
+        if (pos_in_first_chunk_ < chunk.size()) {
+            break;
         }
-        UASSERT(budget >= part.size());
-        budget -= part.size();
+        pos_in_first_chunk_ = 0;
+        ++sent_chunks;
+    }
+
+    // The batch references the sent chunks until it is flushed
+    for (std::size_t i = 0; i < sent_chunks; ++i) {
+        batch.Retain(std::move(chunks_[i]));
     }
-    UASSERT(!parts.empty());
-    [[maybe_unused]] const auto res = socket.SendAll(parts.data(), parts.size(), {});
-    const auto send_parts_count =
-        pos_in_first_chunk_ == 0 ? parts.size() - 1 : parts.size() - 2;  // data_frame_header doesn't matter
-    chunks_.erase(chunks_.begin(), chunks_.begin() + send_parts_count);
+    chunks_.erase(chunks_.begin(), chunks_.begin() + sent_chunks);
 }
 
 }  // namespace server::http
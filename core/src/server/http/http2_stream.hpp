@@ -9,12 +9,10 @@
 
 USERVER_NAMESPACE_BEGIN
 
-namespace engine::io {
-class Socket;
-}
-
 namespace server::http {
 
+class Http2WriteBatch;
+
 class Stream final {
 public:
     using Id = utils::StrongTypedef<struct IdTag, std::int32_t>;
@@ -24,6 +22,7 @@ public:
         const HandlerInfoIndex& handler_info_index,
         request::ResponseDataAccounter& data_accounter,
         engine::io::Sockaddr remote_address,
+        const RequestHandlerBase* request_handler,
         Id id
     );
 
@@ -43,7 +42,8 @@ public:
     bool CheckUrlComplete();
     void PushChunk(std::string&& chunk);
     ssize_t GetMaxSize(std::size_t max_len, std::uint32_t* flags);
-    void Send(engine::io::Socket& socket, std::string_view data_frame_header, std::size_t max_len);
+    // Appends up to max_len bytes of the body to the batch
+    void Send(Http2WriteBatch& batch, std::size_t max_len);
     nghttp2_data_provider* GetNativeProvider() { return &nghttp2_provider_; }
 
 private:
@@ -0,0 +1,72 @@
+#include <server/http/http2_write_batch.hpp>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/fast_scope_guard.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+namespace {
+
+// Keeps the iovec count well below IOV_MAX
+constexpr std::size_t kMaxSegments = 512;
+
+// Larger batches gain nothing, as the syscall cost is negligible compared to
+// the copying of the data into the kernel
+constexpr std::size_t kMaxBytes = 1024 * 1024;
+
+}  // namespace
+
+void Http2WriteBatch::AppendCopy(std::string_view data) {
+    if (data.empty()) return;
+
+    if (!segments_.empty() && !segments_.back().data &&
+        segments_.back().offset + segments_.back().size == copied_.size()) {
+        segments_.back().size += data.size();
+    } else {
+        segments_.push_back({nullptr, copied_.size(), data.size()});
+    }
+    copied_.append(data);
+    bytes_count_ += data.size();
+}
+
+void Http2WriteBatch::AppendChunkPart(const std::string& chunk, std::size_t pos, std::size_t size) {
+    UASSERT(pos + size <= chunk.size());
+    if (size < kMinReferencedSize) {
+        AppendCopy(std::string_view{chunk}.substr(pos, size));
+        return;
+    }
+    segments_.push_back({chunk.data() + pos, 0, size});
+    bytes_count_ += size;
+}
+
+void Http2WriteBatch::Retain(std::string&& chunk) { retained_chunks_.push_back(std::move(chunk)); }
+
+bool Http2WriteBatch::IsFull() const noexcept {
+    return segments_.size() >= kMaxSegments || bytes_count_ >= kMaxBytes;
+}
+
+std::size_t Http2WriteBatch::Flush(engine::io::RwBase& socket) {
+    if (segments_.empty()) return 0;
+    const utils::FastScopeGuard clear_guard{[this]() noexcept { Clear(); }};
+
+    // copied_ might have been reallocated, so the pointers are taken only now
+    io_data_.clear();
+    for (const auto& segment : segments_) {
+        const char* data = segment.data ? segment.data : copied_.data() + segment.offset;
+        io_data_.push_back({data, segment.size});
+    }
+    return socket.WriteAll(io_data_.data(), io_data_.size(), {});
+}
+
+void Http2WriteBatch::Clear() noexcept {
+    copied_.clear();
+    segments_.clear();
+    retained_chunks_.clear();
+    bytes_count_ = 0;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
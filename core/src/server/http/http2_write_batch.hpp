@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/io/common.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+// Gathers the frames produced by a nghttp2_session_send() call, so that the
+// frames of all the ready streams are written with a single vectored write.
+// DATA frame payloads are referenced, not copied.
+class Http2WriteBatch final {
+public:
+    // Parts smaller than this are copied, which also guarantees that the
+    // referenced strings are heap allocated and keep their data on move
+    static constexpr std::size_t kMinReferencedSize = 256;
+
+    // nghttp2 reuses its buffers, so the data is copied
+    void AppendCopy(std::string_view data);
+
+    // `chunk` must stay alive until Flush(), it may be moved
+    void AppendChunkPart(const std::string& chunk, std::size_t pos, std::size_t size);
+
+    // Keeps the sent chunk alive until Flush()
+    void Retain(std::string&& chunk);
+
+    bool IsEmpty() const noexcept { return segments_.empty(); }
+    bool IsFull() const noexcept;
+    std::size_t GetBytesCount() const noexcept { return bytes_count_; }
+
+    // Writes the gathered data and clears the batch even if the write throws
+    std::size_t Flush(engine::io::RwBase& socket);
+
+private:
+    struct Segment {
+        // nullptr for the data in copied_
+        const char* data;
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    void Clear() noexcept;
+
+    std::string copied_;
+    std::vector<Segment> segments_;
+    std::vector<std::string> retained_chunks_;
+    std::vector<engine::io::IoData> io_data_;
+    std::size_t bytes_count_{0};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
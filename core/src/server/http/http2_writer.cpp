@@ -102,6 +102,8 @@ public:
 
     void WriteHttpResponse() {
         auto data = response_.ExtractData();
+        // nghttp2 stream owns its chunks, so the shared data is copied
+        if (data.empty()) data = std::string{response_.shared_data_};
 
         auto headers = GetHeaders();
         const bool is_body_forbidden = IsBodyForbiddenForStatus(response_.status_);
@@ -8,6 +8,7 @@
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/logging/impl/logger_base.hpp>
 #include <userver/logging/logger.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/datetime.hpp>
 #include <userver/utils/encoding/tskv.hpp>
 
@@ -229,8 +230,22 @@ const std::string& HttpRequest::RequestBody() const { return pimpl_->request_bod
 
 std::string HttpRequest::ExtractRequestBody() { return std::move(pimpl_->request_body_); }
 
+RequestBodyStream& HttpRequest::GetBodyStream() const {
+    UINVARIANT(
+        pimpl_->body_stream_.has_value(),
+        "GetBodyStream() is only available to the handlers with the 'request-body-stream: true' static option"
+    );
+    return *pimpl_->body_stream_;
+}
+
 void HttpRequest::SetRequestBody(std::string body) { pimpl_->request_body_ = std::move(body); }
 
+bool HttpRequest::IsBodyStreamed() const { return pimpl_->is_body_streamed_; }
+
+bool HttpRequest::IsBodyStreamReceived() const { return pimpl_->is_body_stream_received_; }
+
+void HttpRequest::CloseBodyStream() const { pimpl_->body_stream_.reset(); }
+
 void HttpRequest::ParseArgsFromBody() {
 #ifndef NDEBUG
     UASSERT_MSG(
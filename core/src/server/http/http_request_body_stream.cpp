@@ -0,0 +1,74 @@
+#include <userver/server/http/http_request_body_stream.hpp>
+
+#include <utility>
+
+#include <userver/engine/task/cancel.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+RequestBodyStream::RequestBodyStream(
+    Queue::Consumer&& consumer,
+    std::shared_ptr<const std::atomic<bool>> is_received,
+    OnChunkRead&& on_chunk_read
+)
+    : consumer_(std::move(consumer)), is_received_(std::move(is_received)), on_chunk_read_(std::move(on_chunk_read)) {}
+
+RequestBodyStream::RequestBodyStream(RequestBodyStream&& other) noexcept
+    : consumer_(std::move(other.consumer_)),
+      is_received_(std::move(other.is_received_)),
+      on_chunk_read_(std::exchange(other.on_chunk_read_, {})),
+      is_read_(other.is_read_) {}
+
+RequestBodyStream& RequestBodyStream::operator=(RequestBodyStream&& other) noexcept {
+    if (this == &other) return *this;
+    ReleaseUnreadChunks();
+    consumer_ = std::move(other.consumer_);
+    is_received_ = std::move(other.is_received_);
+    on_chunk_read_ = std::exchange(other.on_chunk_read_, {});
+    is_read_ = other.is_read_;
+    return *this;
+}
+
+RequestBodyStream::~RequestBodyStream() { ReleaseUnreadChunks(); }
+
+bool RequestBodyStream::ReadChunk(std::string& chunk, engine::Deadline deadline) {
+    if (is_read_) return false;
+
+    std::string next_chunk;
+    if (!consumer_.Pop(next_chunk, deadline)) {
+        // The queue is empty here, so all the chunks were read
+        if (is_received_->load()) {
+            is_read_ = true;
+            return false;
+        }
+        if (engine::current_task::ShouldCancel()) {
+            throw RequestBodyStreamError("Task was cancelled while reading the request body");
+        }
+        if (deadline.IsReached()) {
+            throw RequestBodyStreamError("Deadline was reached while reading the request body");
+        }
+        throw RequestBodyStreamError("Connection was closed before the end of the request body");
+    }
+
+    if (on_chunk_read_) on_chunk_read_(next_chunk.size());
+    chunk = std::move(next_chunk);
+    return true;
+}
+
+void RequestBodyStream::ReleaseUnreadChunks() noexcept {
+    if (!on_chunk_read_) return;
+
+    // The chunks left unread by the handler still hold the window of an HTTP/2
+    // stream, the client could not send the rest of the body without it
+    std::string chunk;
+    while (consumer_.PopNoblock(chunk)) {
+        on_chunk_read_(chunk.size());
+    }
+    on_chunk_read_ = {};
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
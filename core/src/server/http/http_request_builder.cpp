@@ -116,6 +116,17 @@ HttpRequestBuilder& HttpRequestBuilder::SetResponseStatus(HttpStatus status) {
     return *this;
 }
 
+HttpRequestBuilder& HttpRequestBuilder::SetBodyStream(RequestBodyStream&& body_stream) {
+    request_->pimpl_->body_stream_.emplace(std::move(body_stream));
+    request_->pimpl_->is_body_streamed_ = true;
+    return *this;
+}
+
+HttpRequestBuilder& HttpRequestBuilder::SetBodyStreamReceived() {
+    request_->pimpl_->is_body_stream_received_ = true;
+    return *this;
+}
+
 const HttpRequest& HttpRequestBuilder::GetRef() const {
     UASSERT(request_);
     return *request_;
@@ -3,6 +3,7 @@
 #include <http_parser.h>
 
 #include <algorithm>
+#include <cstring>
 
 #include <userver/http/common_headers.hpp>
 #include <userver/logging/log.hpp>
@@ -12,6 +13,7 @@
 #include <userver/utils/exception.hpp>
 
 #include "multipart_form_data_parser.hpp"
+#include "request_handler_base.hpp"
 
 USERVER_NAMESPACE_BEGIN
 
@@ -19,6 +21,14 @@ namespace server::http {
 
 namespace {
 
+// Unread chunks of a streamed body take at most that much memory
+constexpr std::size_t kBodyStreamQueueSize = 256 * 1024;
+constexpr std::size_t kMaxBodyStreamChunkSize = 64 * 1024;
+
+// The part of the reserved body exposed by GetBodyBuffer() grows at least by
+// that much and at most twice along with the received part
+constexpr std::size_t kMinBodyBufferSize = 64 * 1024;
+
 void StripDuplicateStartingSlashes(std::string& s) {
     if (s.empty() || s[0] != '/') return;
 
@@ -46,9 +56,13 @@ HttpRequestConstructor::HttpRequestConstructor(
     Config config,
     const HandlerInfoIndex& handler_info_index,
     request::ResponseDataAccounter& data_accounter,
-    engine::io::Sockaddr remote_address
+    engine::io::Sockaddr remote_address,
+    const RequestHandlerBase* request_handler
 )
-    : config_(config), handler_info_index_(handler_info_index), builder_(data_accounter) {
+    : config_(config),
+      handler_info_index_(handler_info_index),
+      request_handler_(request_handler),
+      builder_(data_accounter) {
     builder_.SetRemoteAddress(std::move(remote_address));
 }
 
@@ -131,9 +145,16 @@ void HttpRequestConstructor::ParseUrl() {
 
     builder_.SetUrl(std::move(url_));
     url_parsed_ = true;
+
+    if (handler_info && request_handler_ && request_handler_->RejectEarly(builder_.GetRef())) {
+        SetStatus(Status::kThrottled);
+    } else if (handler_info && handler_info->handler.GetConfig().request_body_stream) {
+        is_body_streamed_ = true;
+    }
 }
 
 void HttpRequestConstructor::AppendHeaderField(const char* data, size_t size) {
+    if (IsThrottled()) return;
     if (header_value_flag_) {
         AddHeader();
         header_value_flag_ = false;
@@ -147,6 +168,7 @@ void HttpRequestConstructor::AppendHeaderField(const char* data, size_t size) {
 }
 
 void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
+    if (IsThrottled()) return;
     UASSERT(header_field_flag_);
     header_value_flag_ = true;
 
@@ -157,8 +179,44 @@ void HttpRequestConstructor::AppendHeaderValue(const char* data, size_t size) {
 }
 
 void HttpRequestConstructor::AppendBody(const char* data, size_t size) {
+    if (IsThrottled()) return;
+    if (is_body_streamed_) {
+        // The body is not stored, so it is not limited by max_request_size
+        PushBodyChunk(data, size);
+        return;
+    }
     AccountRequestSize(size);
-    body_ += std::string_view{data, size};
+    if (body_size_ + size <= body_.size()) {
+        // The data may already be in place, see GetBodyBuffer()
+        char* const dest = body_.data() + body_size_;
+        if (data != dest) std::memcpy(dest, data, size);
+    } else {
+        body_.resize(body_size_);
+        body_.append(data, size);
+    }
+    body_size_ += size;
+}
+
+void HttpRequestConstructor::ReserveBody(std::uint64_t size) {
+    UASSERT(body_size_ == 0);
+    if (IsThrottled() || is_body_streamed_) return;
+    // Too large requests are rejected by AccountRequestSize(), do not allocate memory for them
+    if (request_size_ > config_.max_request_size || size > config_.max_request_size - request_size_) return;
+    // Only the capacity, the memory is filled as the body arrives
+    body_.reserve(size);
+    body_reserved_size_ = size;
+}
+
+utils::span<char> HttpRequestConstructor::GetBodyBuffer() noexcept {
+    if (body_size_ >= body_reserved_size_) return {};
+    if (body_size_ == body_.size()) {
+        // A client does not make the server zero-fill the memory for the body
+        // it has only announced. Never reallocates, as the size is within the
+        // reserved capacity.
+        const auto buffer_size = std::max(body_size_, kMinBodyBufferSize);
+        body_.resize(std::min<std::size_t>(body_reserved_size_, body_size_ + buffer_size));
+    }
+    return {body_.data() + body_size_, body_.size() - body_size_};
 }
 
 void HttpRequestConstructor::SetIsFinal(bool is_final) { builder_.SetIsFinal(is_final); }
@@ -169,15 +227,83 @@ void HttpRequestConstructor::SetStreamProducer(impl::Http2StreamEventProducer&&
     builder_.SetStreamProducer(std::move(producer));
 }
 
+void HttpRequestConstructor::SetBodyStreamWindowProducer(
+    impl::Http2StreamEventProducer&& producer,
+    std::int32_t stream_id
+) {
+    UASSERT(is_body_streamed_);
+    UASSERT(!is_body_stream_started_);
+    is_body_stream_flow_controlled_ = true;
+    // RequestBodyStream::OnChunkRead must be copyable
+    on_body_chunk_read_ = [producer = std::make_shared<impl::Http2StreamEventProducer>(std::move(producer)),
+                           stream_id](std::size_t size) {
+        impl::Http2StreamEvent event;
+        event.stream_id = stream_id;
+        event.consumed_body_size = size;
+        producer->PushEvent(std::move(event));
+    };
+}
+
 std::shared_ptr<http::HttpRequest> HttpRequestConstructor::Finalize() {
     FinalizeImpl();
 
     CheckStatus();
 
+    if (is_body_streamed_) StartBodyStream();
+    is_body_stream_started_ = is_body_streamed_;
     return builder_.Build();
 }
 
+void HttpRequestConstructor::FinishBodyStream() {
+    UASSERT(is_body_stream_started_);
+    // RequestBodyStream::ReadChunk() reports the end of the body once the
+    // producer is dropped and the flag is set
+    body_stream_received_->store(true);
+    body_stream_producer_.reset();
+    builder_.SetBodyStreamReceived();
+}
+
+void HttpRequestConstructor::StartBodyStream() {
+    // The stream window limits the unread chunks of HTTP/2 bodies
+    auto queue = RequestBodyStream::Queue::Create(
+        is_body_stream_flow_controlled_ ? RequestBodyStream::Queue::kUnbounded : kBodyStreamQueueSize
+    );
+    body_stream_producer_.emplace(queue->GetProducer());
+    body_stream_received_ = std::make_shared<std::atomic<bool>>(false);
+    builder_.SetBodyStream(
+        RequestBodyStream{queue->GetConsumer(), body_stream_received_, std::move(on_body_chunk_read_)}
+    );
+}
+
+void HttpRequestConstructor::PushBodyChunk(const char* data, size_t size) {
+    // The queue does not accept empty chunks
+    if (!body_stream_producer_ || size == 0) return;
+
+    if (is_body_stream_flow_controlled_) {
+        // The chunk is either passed to the handler as a whole or not at all,
+        // so that its window is updated exactly once
+        if (!body_stream_producer_->PushNoblock(std::string(data, size))) {
+            // The handler has returned, the rest of the body is skipped
+            body_stream_producer_.reset();
+        }
+        return;
+    }
+
+    while (size > 0) {
+        // Larger chunks would never fit into the queue
+        const auto chunk_size = std::min(size, kMaxBodyStreamChunkSize);
+        if (!body_stream_producer_->Push(std::string(data, chunk_size), {})) {
+            // The handler has returned, the rest of the body is skipped
+            body_stream_producer_.reset();
+            return;
+        }
+        data += chunk_size;
+        size -= chunk_size;
+    }
+}
+
 void HttpRequestConstructor::FinalizeImpl() {
+    body_.resize(body_size_);
     builder_.SetBody(std::move(body_));
 
     if (status_ != Status::kOk && (!config_.testing_mode || status_ != Status::kHandlerNotFound)) {
@@ -193,7 +319,7 @@ void HttpRequestConstructor::FinalizeImpl() {
 
     try {
         ParseArgs(*parsed_url_pimpl_);
-        if (config_.parse_args_from_body) {
+        if (config_.parse_args_from_body && !is_body_streamed_) {
             if (!config_.decompress_request || !request.IsBodyCompressed())
                 ParseArgs(request.RequestBody().data(), request.RequestBody().size());
         }
@@ -205,7 +331,7 @@ void HttpRequestConstructor::FinalizeImpl() {
 
     // TODO: split logic
     const auto& content_type = request.GetHeader(USERVER_NAMESPACE::http::headers::kContentType);
-    if (IsMultipartFormDataContentType(content_type)) {
+    if (!is_body_streamed_ && IsMultipartFormDataContentType(content_type)) {
         utils::impl::TransparentMap<std::string, std::vector<FormDataArg>, utils::StrCaseHash> form_data_args;
         if (!ParseMultipartFormData(content_type, request.RequestBody(), form_data_args)) {
             SetStatus(Status::kParseMultipartFormDataError);
@@ -334,6 +460,10 @@ void HttpRequestConstructor::CheckStatus() {
             builder_.GetHttpResponse().SetData("invalid body of multipart/form-data request");
             builder_.GetHttpResponse().SetReady();
             break;
+        case Status::kThrottled:
+            // The status is set by RequestHandlerBase::RejectEarly()
+            builder_.GetHttpResponse().SetReady();
+            break;
     }
 }
 
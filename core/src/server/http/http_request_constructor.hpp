@@ -1,12 +1,17 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <optional>
 
 #include <userver/http/parser/http_request_parse_args.hpp>
 #include <userver/server/http/http_method.hpp>
 #include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 #include <userver/server/http/http_request_builder.hpp>
 #include <userver/server/request/request_config.hpp>
+#include <userver/utils/span.hpp>
 
 #include "handler_info_index.hpp"
 
@@ -14,6 +19,8 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
 
+class RequestHandlerBase;
+
 class HttpRequestConstructor final {
 public:
     enum class Status {
@@ -28,6 +35,7 @@ public:
         kParseArgsError,
         kParseCookiesError,
         kParseMultipartFormDataError,
+        kThrottled,
     };
 
     using Config = server::request::HttpRequestConfig;
@@ -36,7 +44,8 @@ public:
         Config config,
         const HandlerInfoIndex& handler_info_index,
         request::ResponseDataAccounter& data_accounter,
-        engine::io::Sockaddr remote_address
+        engine::io::Sockaddr remote_address,
+        const RequestHandlerBase* request_handler = nullptr
     );
 
     ~HttpRequestConstructor();
@@ -54,11 +63,41 @@ public:
     void AppendHeaderValue(const char* data, size_t size);
     void AppendBody(const char* data, size_t size);
 
+    // Preallocates the body of a known size, so that it is not reallocated on
+    // each AppendBody()
+    void ReserveBody(std::uint64_t size);
+
+    // The next part of the reserved and not yet appended body, it grows along
+    // with the received body. The data written into it is not copied by the
+    // following AppendBody().
+    utils::span<char> GetBodyBuffer() noexcept;
+
     void SetIsFinal(bool is_final);
 
+    // The request was rejected by RequestHandlerBase::RejectEarly(), its headers
+    // and body are not stored
+    bool IsThrottled() const noexcept { return status_ == Status::kThrottled; }
+
+    // The handler of the request reads the body by chunks, see
+    // HttpRequest::GetBodyStream(). Such request is finalized right after its
+    // headers, and AppendBody() blocks while the handler lags behind, unless
+    // the body is flow controlled.
+    bool IsBodyStreamed() const noexcept { return is_body_streamed_; }
+    bool IsBodyStreamStarted() const noexcept { return is_body_stream_started_; }
+    void FinishBodyStream();
+
     // HTTP/2.0 only:
     void SetStreamProducer(impl::Http2StreamEventProducer&& producer);
     void SetResponseStreamId(std::int32_t stream_id);
+    // AppendBody() never blocks, the handler reports the size of each read
+    // chunk of the streamed body to `producer`, so that the stream window is
+    // updated. Must be called before Finalize().
+    void SetBodyStreamWindowProducer(impl::Http2StreamEventProducer&& producer, std::int32_t stream_id);
+    // The appended chunks are passed to the handler, the stream window must be
+    // updated only once the handler reads them
+    bool IsBodyStreamFlowControlled() const noexcept {
+        return is_body_stream_flow_controlled_ && body_stream_producer_.has_value();
+    }
 
     std::shared_ptr<http::HttpRequest> Finalize();
 
@@ -67,6 +106,9 @@ private:
 
     void FinalizeImpl();
 
+    void StartBodyStream();
+    void PushBodyChunk(const char* data, size_t size);
+
     void ParseArgs(const HttpParserUrl& url);
     void ParseArgs(const char* data, size_t size);
     void AddHeader();
@@ -80,6 +122,7 @@ private:
 
     Config config_;
     const HandlerInfoIndex& handler_info_index_;
+    const RequestHandlerBase* request_handler_;
 
     utils::FastPimpl<HttpParserUrl, 60, 8> parsed_url_pimpl_;
     std::string header_field_;
@@ -94,7 +137,16 @@ private:
     Status status_ = Status::kOk;
 
     std::string url_;
+    // body_ may be longer than body_size_ if the body was reserved
     std::string body_;
+    size_t body_size_ = 0;
+    size_t body_reserved_size_ = 0;
+    bool is_body_streamed_ = false;
+    bool is_body_stream_started_ = false;
+    bool is_body_stream_flow_controlled_ = false;
+    std::optional<concurrent::StringStreamQueue::Producer> body_stream_producer_;
+    std::shared_ptr<std::atomic<bool>> body_stream_received_;
+    std::function<void(std::size_t)> on_body_chunk_read_;
     HttpRequestBuilder builder_;
 };
 
@@ -1,5 +1,9 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <cstring>
+
+#include <server/http/handler_info_index.hpp>
 #include <server/http/http_request_constructor.hpp>
 #include <utils/gbench_auxilary.hpp>
 
@@ -15,7 +19,37 @@ void http_request_constructor_url_decode(benchmark::State& state) {
 
     for ([[maybe_unused]] auto _ : state) benchmark::DoNotOptimize(USERVER_NAMESPACE::http::parser::UrlDecode(input));
 }
+
+// A body of 1MiB is announced by Content-Length, and only the given part of it
+// is received by chunks of in_buffer_size right into the body buffer
+void http_request_constructor_reserve_body(benchmark::State& state) {
+    const auto received_size = static_cast<std::size_t>(state.range(0));
+    constexpr std::size_t kAnnouncedSize = 1024 * 1024;
+    constexpr std::size_t kChunkSize = 32 * 1024;
+
+    server::http::HandlerInfoIndex handler_info_index;
+    server::request::HttpRequestConfig config;
+    config.max_request_size = 2 * kAnnouncedSize;
+    server::request::ResponseDataAccounter data_accounter;
+    const std::string chunk(kChunkSize, 'b');
+
+    for ([[maybe_unused]] auto _ : state) {
+        server::http::HttpRequestConstructor constructor{
+            config, handler_info_index, data_accounter, engine::io::Sockaddr{}};
+        constructor.ReserveBody(kAnnouncedSize);
+        for (std::size_t received = 0; received < received_size; received += kChunkSize) {
+            const auto buffer = constructor.GetBodyBuffer();
+            const auto size = std::min(kChunkSize, buffer.size());
+            std::memcpy(buffer.data(), chunk.data(), size);
+            constructor.AppendBody(buffer.data(), size);
+        }
+        benchmark::DoNotOptimize(constructor);
+    }
+    state.SetBytesProcessed(state.iterations() * received_size);
+}
+
 }  // namespace
 BENCHMARK(http_request_constructor_url_decode)->RangeMultiplier(2)->Range(1, 1024);
+BENCHMARK(http_request_constructor_reserve_body)->RangeMultiplier(4)->Range(32 * 1024, 1024 * 1024);
 
 USERVER_NAMESPACE_END
@@ -21,6 +21,28 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::http {
 
+namespace {
+
+// Closes the body stream of the request once its task ends, even if the task
+// is cancelled before the start, so that the connection does not wait for the
+// handler to read the rest of the body
+class BodyStreamCloser final {
+public:
+    explicit BodyStreamCloser(const std::shared_ptr<HttpRequest>& request)
+        : request_(request->IsBodyStreamed() ? request : nullptr) {}
+
+    BodyStreamCloser(BodyStreamCloser&&) noexcept = default;
+
+    ~BodyStreamCloser() {
+        if (request_) request_->CloseBodyStream();
+    }
+
+private:
+    std::shared_ptr<HttpRequest> request_;
+};
+
+}  // namespace
+
 HttpRequestHandler::HttpRequestHandler(
     const components::ComponentContext& component_context,
     const std::optional<std::string>& logger_access_component,
@@ -56,12 +78,15 @@ engine::TaskWithResult<void> HttpRequestHandler::StartFailsafeTask(std::shared_p
 
     http_request->SetHttpHandlerStatistics(dummy_statistics);
 
-    return engine::AsyncNoSpan([request = std::move(http_request), handler]() {
-        request->SetTaskStartTime();
-        if (handler) handler->ReportMalformedRequest(*request);
-        request->SetResponseNotifyTime();
-        request->GetHttpResponse().SetReady();
-    });
+    BodyStreamCloser body_stream_closer{http_request};
+    return engine::AsyncNoSpan(
+        [request = std::move(http_request), handler, body_stream_closer = std::move(body_stream_closer)]() {
+            request->SetTaskStartTime();
+            if (handler) handler->ReportMalformedRequest(*request);
+            request->SetResponseNotifyTime();
+            request->GetHttpResponse().SetReady();
+        }
+    );
 }
 
 namespace {
@@ -95,46 +120,15 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(std::shared_pt
     auto throttling_enabled = handler->GetConfig().throttling_enabled;
 
     if (throttling_enabled && http_response.IsLimitReached()) {
-        SetThrottleReason(
-            http_response,
-            "Too many pending responses",
-            std::string{USERVER_NAMESPACE::http::headers::ratelimit_reason::kMaxPendingResponses}
-        );
-
-        http_request->SetResponseStatus(HttpStatus::kTooManyRequests);
+        SetTooManyPendingResponses(*http_request);
         http_request->GetHttpResponse().SetReady();
         http_request->SetTaskCreateTime();
-        LOG_LIMITED_ERROR() << "Request throttled (too many pending responses, "
-                               "limit via 'server.max_response_size_in_flight')";
         return StartFailsafeTask(std::move(http_request));
     }
 
     if (throttling_enabled && !rate_limit_.Obtain()) {
-        const auto config = config_source_.GetSnapshot();
-        auto config_var = config[handlers::kCcCustomStatus];
-        const auto& delta = config_var.max_time_delta;
-
-        auto status = HttpStatus::kTooManyRequests;
-        if (cc_enabled_tp_ > std::chrono::steady_clock::now() - delta) {
-            status = config_var.initial_status_code;
-            metrics_->GetMetric(kCcStatusCodeIsCustom) = 1;
-        } else {
-            status = cc_status_code_.load();
-            metrics_->GetMetric(kCcStatusCodeIsCustom) = 0;
-        }
-
-        SetThrottleReason(
-            http_response, "congestion-control", std::string{USERVER_NAMESPACE::http::headers::ratelimit_reason::kCC}
-        );
-
-        http_response.SetStatus(status);
+        SetCongestionControlThrottled(*http_request);
         http_response.SetReady();
-
-        LOG_LIMITED_ERROR() << "Request throttled (congestion control, "
-                               "limit via USERVER_RPS_CCONTROL and USERVER_RPS_CCONTROL_ENABLED), "
-                            << "limit=" << rate_limit_.GetRatePs() << "/sec, "
-                            << "url=" << http_request->GetUrl() << ", status_code=" << static_cast<size_t>(status);
-
         return StartFailsafeTask(std::move(http_request));
     }
 
@@ -142,7 +136,8 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(std::shared_pt
         http_response.SetStreamBody();
     }
 
-    auto payload = [request = std::move(http_request), handler] {
+    BodyStreamCloser body_stream_closer{http_request};
+    auto payload = [request = std::move(http_request), handler, body_stream_closer = std::move(body_stream_closer)] {
         server::request::kTaskInheritedRequest.Set(std::static_pointer_cast<HttpRequest>(request));
 
         request->SetTaskStartTime();
@@ -162,7 +157,68 @@ engine::TaskWithResult<void> HttpRequestHandler::StartRequestTask(std::shared_pt
     }
 }  // namespace http
 
+bool HttpRequestHandler::RejectEarly(const http::HttpRequest& http_request) const {
+    const auto* handler = http_request.GetHttpHandler();
+    if (!handler || !handler->GetConfig().throttling_enabled) return false;
+
+    if (http_request.GetHttpResponse().IsLimitReached()) {
+        SetTooManyPendingResponses(http_request);
+        return true;
+    }
+
+    // The token is not obtained here, otherwise the admitted requests would be
+    // accounted twice. StartRequestTask() obtains it.
+    if (!rate_limit_.IsUnbounded() && rate_limit_.GetTokensApprox() == 0) {
+        SetCongestionControlThrottled(http_request);
+        return true;
+    }
+
+    return false;
+}
+
+void HttpRequestHandler::SetTooManyPendingResponses(const http::HttpRequest& http_request) const {
+    SetThrottleReason(
+        http_request.GetHttpResponse(),
+        "Too many pending responses",
+        std::string{USERVER_NAMESPACE::http::headers::ratelimit_reason::kMaxPendingResponses}
+    );
+
+    http_request.SetResponseStatus(HttpStatus::kTooManyRequests);
+    LOG_LIMITED_ERROR() << "Request throttled (too many pending responses, "
+                           "limit via 'server.max_response_size_in_flight')";
+}
+
+void HttpRequestHandler::SetCongestionControlThrottled(const http::HttpRequest& http_request) const {
+    const auto config = config_source_.GetSnapshot();
+    auto config_var = config[handlers::kCcCustomStatus];
+    const auto& delta = config_var.max_time_delta;
+
+    auto status = HttpStatus::kTooManyRequests;
+    if (cc_enabled_tp_ > std::chrono::steady_clock::now() - delta) {
+        status = config_var.initial_status_code;
+        metrics_->GetMetric(kCcStatusCodeIsCustom) = 1;
+    } else {
+        status = cc_status_code_.load();
+        metrics_->GetMetric(kCcStatusCodeIsCustom) = 0;
+    }
+
+    auto& http_response = http_request.GetHttpResponse();
+    SetThrottleReason(
+        http_response, "congestion-control", std::string{USERVER_NAMESPACE::http::headers::ratelimit_reason::kCC}
+    );
+    http_response.SetStatus(status);
+
+    LOG_LIMITED_ERROR() << "Request throttled (congestion control, "
+                           "limit via USERVER_RPS_CCONTROL and USERVER_RPS_CCONTROL_ENABLED), "
+                        << "limit=" << rate_limit_.GetRatePs() << "/sec, "
+                        << "url=" << http_request.GetUrl() << ", status_code=" << static_cast<size_t>(status);
+}
+
 void HttpRequestHandler::DisableAddHandler() {
+    {
+        const std::lock_guard<engine::Mutex> lock(handler_infos_mutex_);
+        handler_info_index_.Freeze();
+    }
     const auto was_enabled = !add_handler_disabled_.exchange(true);
     UASSERT(was_enabled);
 }
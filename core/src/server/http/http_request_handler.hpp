@@ -33,6 +33,8 @@ public:
 
     engine::TaskWithResult<void> StartRequestTask(std::shared_ptr<http::HttpRequest> request) const override;
 
+    bool RejectEarly(const http::HttpRequest& request) const override;
+
     void DisableAddHandler();
     void AddHandler(const handlers::HttpHandlerBase& handler, engine::TaskProcessor& task_processor);
     bool IsAddHandlerDisabled() const noexcept;
@@ -48,6 +50,9 @@ public:
 private:
     engine::TaskWithResult<void> StartFailsafeTask(std::shared_ptr<http::HttpRequest> http_request) const;
 
+    void SetTooManyPendingResponses(const http::HttpRequest& http_request) const;
+    void SetCongestionControlThrottled(const http::HttpRequest& http_request) const;
+
     logging::TextLoggerPtr logger_access_;
     logging::TextLoggerPtr logger_access_tskv_;
 
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <optional>
+
 #include <userver/server/http/http_request.hpp>
+#include <userver/server/http/http_request_body_stream.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -39,6 +42,9 @@ struct HttpRequest::Impl {
     std::string url_;
     std::string request_path_;
     std::string request_body_;
+    mutable std::optional<RequestBodyStream> body_stream_;
+    bool is_body_streamed_{false};
+    bool is_body_stream_received_{false};
     utils::impl::TransparentMap<std::string, std::vector<std::string>, utils::StrCaseHash> request_args_;
     utils::impl::TransparentMap<std::string, std::vector<FormDataArg>, utils::StrCaseHash> form_data_args_;
     std::vector<std::string> path_args_;
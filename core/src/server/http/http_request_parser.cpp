@@ -15,6 +15,10 @@ namespace {
 constexpr std::string_view kWebsocketUpgradeHeaderName = "Upgrade:";
 constexpr std::string_view kWebsocketUpgradeHeaderValue = "websocket\r\n";
 
+// Bodies of the throttled requests up to this size are read and dropped to
+// keep the connection alive. Reconnection is cheaper than reading a larger one.
+constexpr std::uint64_t kMaxDroppedBodySize = 64 * 1024;
+
 // find the header by ignoring spaces. Also case insensitive comparison
 bool IsWebSocketUpgradeRequest(std::string_view req) {
     auto it = std::search(
@@ -87,20 +91,49 @@ HttpRequestParser::HttpRequestParser(
     OnNewRequestCb&& on_new_request_cb,
     net::ParserStats& stats,
     request::ResponseDataAccounter& data_accounter,
-    engine::io::Sockaddr remote_address
+    engine::io::Sockaddr remote_address,
+    const RequestHandlerBase* request_handler
 )
     : handler_info_index_(handler_info_index),
       request_constructor_config_{request_config},
       on_new_request_cb_(std::move(on_new_request_cb)),
       stats_(stats),
       data_accounter_(data_accounter),
-      remote_address_(std::move(remote_address)) {
+      remote_address_(std::move(remote_address)),
+      request_handler_(request_handler) {
     llhttp_init(&parser_, HTTP_REQUEST, &parser_settings);
     parser_.data = this;
 }
 
 bool HttpRequestParser::Parse(std::string_view req) {
+    if (!is_paused_) return Execute(req);
+
+    is_paused_ = false;
+    auto data = std::move(unparsed_data_);
+    unparsed_data_.clear();
+    data.append(req);
+    return Execute(data);
+}
+
+bool HttpRequestParser::HasUnparsedData() const noexcept { return is_paused_; }
+
+bool HttpRequestParser::Execute(std::string_view req) {
     const auto err = llhttp_execute(&parser_, req.data(), req.size());
+    if (is_closed_by_throttling_) {
+        UASSERT(err == HPE_PAUSED);
+        return false;
+    }
+    if (err == HPE_PAUSED) {
+        // The body of a streamed request is parsed once its handler is
+        // started, see OnHeadersCompleteImpl()
+        llhttp_resume(&parser_);
+        const auto* const parsed_end = llhttp_get_error_pos(&parser_);
+        unparsed_data_.assign(parsed_end, req.data() + req.size());
+        // Even with no data left the parser has to be run again, e.g. to
+        // complete a request without a body
+        is_paused_ = true;
+        return true;
+    }
     if (parser_.upgrade && err == HPE_PAUSED_UPGRADE) {
         FinalizeRequest();
         // returns true iff it is an HTTP/2 upgrade request
@@ -116,6 +149,11 @@ bool HttpRequestParser::Parse(std::string_view req) {
     return true;
 }
 
+utils::span<char> HttpRequestParser::GetBodyReadBuffer() noexcept {
+    if (!request_constructor_) return {};
+    return request_constructor_->GetBodyBuffer();
+}
+
 int HttpRequestParser::OnMessageBegin(llhttp_t* p) {
     auto* http_request_parser = static_cast<HttpRequestParser*>(p->data);
     UASSERT(http_request_parser != nullptr);
@@ -208,11 +246,34 @@ int HttpRequestParser::OnHeadersCompleteImpl(llhttp_t* p) {
     if (!CheckUrlComplete(p)) return -1;
     try {
         request_constructor_->AppendHeaderField("", 0);
+        if (p->flags & F_CONTENT_LENGTH) request_constructor_->ReserveBody(p->content_length);
     } catch (const std::exception& ex) {
         LOG_WARNING() << "can't append header value: " << ex;
         return -1;
     }
     LOG_TRACE() << "headers complete";
+
+    if (request_constructor_->IsThrottled()) {
+        const bool has_large_body = (p->flags & F_CHUNKED) ||
+                                    ((p->flags & F_CONTENT_LENGTH) && p->content_length > kMaxDroppedBodySize);
+        if (has_large_body) {
+            // Respond right away and close the connection instead of reading the body
+            request_constructor_->SetIsFinal(true);
+            if (!FinalizeRequest()) return -1;
+            is_closed_by_throttling_ = true;
+            return HPE_PAUSED;
+        }
+    }
+
+    if (request_constructor_->IsBodyStreamed()) {
+        // The handler reads the body while it is being received
+        request_constructor_->SetIsFinal(!llhttp_should_keep_alive(p));
+        if (!FinalizeRequestImpl()) return -1;
+        // The handler may not be started until the responses to the previous
+        // pipelined requests are sent, and pushing the body to it would block
+        // the connection meanwhile
+        return HPE_PAUSED;
+    }
     return 0;
 }
 
@@ -234,6 +295,11 @@ int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
     if (p->upgrade) {
         return 0;
     }
+    if (request_constructor_->IsBodyStreamStarted()) {
+        LOG_TRACE() << "message complete";
+        FinishBodyStream();
+        return 0;
+    }
     request_constructor_->SetIsFinal(!llhttp_should_keep_alive(p));
     if (!CheckUrlComplete(p)) return -1;
     LOG_TRACE() << "message complete";
@@ -243,7 +309,9 @@ int HttpRequestParser::OnMessageCompleteImpl(llhttp_t* p) {
 
 void HttpRequestParser::CreateRequestConstructor() {
     stats_.parsing_request_count.Add(1);
-    request_constructor_.emplace(request_constructor_config_, handler_info_index_, data_accounter_, remote_address_);
+    request_constructor_.emplace(
+        request_constructor_config_, handler_info_index_, data_accounter_, remote_address_, request_handler_
+    );
     url_complete_ = false;
 }
 
@@ -269,9 +337,21 @@ bool HttpRequestParser::FinalizeRequest() {
     return res;
 }
 
+void HttpRequestParser::FinishBodyStream() {
+    request_constructor_->FinishBodyStream();
+    stats_.parsing_request_count.Subtract(1);
+    request_constructor_.reset();
+}
+
 bool HttpRequestParser::FinalizeRequestImpl() {
     if (!request_constructor_) CreateRequestConstructor();
 
+    if (request_constructor_->IsBodyStreamStarted()) {
+        // The request is already passed to the handler, the handler gets an
+        // error on reading the rest of the body
+        return false;
+    }
+
     if (auto request = request_constructor_->Finalize()) {
         on_new_request_cb_(std::move(request));
     } else {
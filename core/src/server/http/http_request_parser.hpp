@@ -4,6 +4,7 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <string>
 
 #include <llhttp.h>
 
@@ -29,7 +30,8 @@ public:
         OnNewRequestCb&& on_new_request_cb,
         net::ParserStats& stats,
         request::ResponseDataAccounter& data_accounter,
-        engine::io::Sockaddr remote_address
+        engine::io::Sockaddr remote_address,
+        const RequestHandlerBase* request_handler = nullptr
     );
 
     HttpRequestParser(HttpRequestParser&&) = delete;
@@ -37,7 +39,13 @@ public:
 
     bool Parse(std::string_view request) override;
 
+    utils::span<char> GetBodyReadBuffer() noexcept override;
+
+    bool HasUnparsedData() const noexcept override;
+
 private:
+    bool Execute(std::string_view request);
+
     static int OnMessageBegin(llhttp_t* p);
     static int OnUrl(llhttp_t* p, const char* data, size_t size);
     static int OnHeaderField(llhttp_t* p, const char* data, size_t size);
@@ -60,6 +68,7 @@ private:
 
     bool FinalizeRequest();
     bool FinalizeRequestImpl();
+    void FinishBodyStream();
 
     const HandlerInfoIndex& handler_info_index_;
     const HttpRequestConstructor::Config request_constructor_config_;
@@ -75,6 +84,12 @@ private:
     net::ParserStats& stats_;
     request::ResponseDataAccounter& data_accounter_;
     engine::io::Sockaddr remote_address_;
+    const RequestHandlerBase* request_handler_;
+    // The connection is closed after the throttled request, see OnHeadersCompleteImpl()
+    bool is_closed_by_throttling_ = false;
+    // The parser is paused after the headers of a streamed request, see Execute()
+    bool is_paused_ = false;
+    std::string unparsed_data_;
 };
 
 }  // namespace server::http
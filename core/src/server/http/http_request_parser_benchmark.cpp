@@ -1,5 +1,7 @@
 #include <server/http/http_request_parser.hpp>
 
+#include <cstring>
+
 #include <benchmark/benchmark.h>
 
 #include <userver/http/http_version.hpp>
@@ -92,6 +94,37 @@ void http_request_parser_parse_benchmark_large_body(benchmark::State& state) {
     }
 }
 
+// Emulates reading of a large body from a socket by chunks of in_buffer_size,
+// either into a separate buffer (0) or right into the request body (1)
+void http_request_parser_parse_benchmark_large_body_chunked(benchmark::State& state) {
+    const bool read_into_body = state.range(0);
+    constexpr std::size_t kBodySize = 512 * 1024;
+    constexpr std::size_t kChunkSize = 32 * 1024;
+
+    auto parser = CreateBenchmarkParser([](std::shared_ptr<server::http::HttpRequest>&&) {});
+
+    const std::string body(kBodySize, 'b');
+    const std::string headers = fmt::format(
+        "POST / HTTP/1.1\r\n"
+        "Content-Length: {}\r\n\r\n",
+        kBodySize
+    );
+    std::string read_buffer(kChunkSize, '\0');
+
+    for ([[maybe_unused]] auto _ : state) {
+        parser.Parse(headers);
+        for (std::size_t pos = 0; pos < body.size(); pos += kChunkSize) {
+            const auto chunk = std::string_view{body}.substr(pos, kChunkSize);
+            const auto body_buffer = parser.GetBodyReadBuffer();
+            char* const dest =
+                read_into_body && body_buffer.size() >= chunk.size() ? body_buffer.data() : read_buffer.data();
+            std::memcpy(dest, chunk.data(), chunk.size());
+            parser.Parse({dest, chunk.size()});
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * kBodySize);
+}
+
 void http_request_parser_parse_benchmark_many_headers(benchmark::State& state) {
     auto parser = CreateBenchmarkParser([](std::shared_ptr<server::http::HttpRequest>&&) {});
 
@@ -114,6 +147,7 @@ BENCHMARK(http_request_parser_parse_benchmark_small);
 BENCHMARK(http_request_parser_parse_benchmark_middle);
 BENCHMARK(http_request_parser_parse_benchmark_large_url);
 BENCHMARK(http_request_parser_parse_benchmark_large_body);
+BENCHMARK(http_request_parser_parse_benchmark_large_body_chunked)->Arg(0)->Arg(1);
 BENCHMARK(http_request_parser_parse_benchmark_many_headers);
 
 USERVER_NAMESPACE_END
@@ -1,5 +1,10 @@
 #include <server/http/http_request_parser.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
 #include <server/http/create_parser_test.hpp>
 #include <userver/utest/utest.hpp>
 
@@ -201,6 +206,59 @@ UTEST(HttpRequestParserParser, BodySimple) {
     EXPECT_EQ(parsed, true);
 }
 
+UTEST(HttpRequestParserParser, BodyReadBuffer) {
+    std::vector<std::string> bodies;
+    auto parser = server::CreateTestParser([&bodies](std::shared_ptr<server::http::HttpRequest>&& request) {
+        bodies.push_back(request->RequestBody());
+    });
+    EXPECT_TRUE(parser->GetBodyReadBuffer().empty());
+
+    constexpr std::string_view kHeaders = "POST / HTTP/1.1\r\nContent-Length: 8\r\n\r\n";
+    parser->Parse(kHeaders);
+    auto buffer = parser->GetBodyReadBuffer();
+    ASSERT_EQ(buffer.size(), 8);
+
+    // data read right into the buffer
+    std::memcpy(buffer.data(), "body", 4);
+    parser->Parse({buffer.data(), 4});
+    EXPECT_EQ(parser->GetBodyReadBuffer().size(), 4);
+
+    // data read elsewhere, along with the next pipelined request
+    parser->Parse(std::string{"body"}.append(kHeaders).append("pipeline"));
+    EXPECT_TRUE(parser->GetBodyReadBuffer().empty());
+
+    EXPECT_EQ(bodies, (std::vector<std::string>{"bodybody", "pipeline"}));
+}
+
+UTEST(HttpRequestParserParser, BodyReadBufferGrowsWithBody) {
+    std::vector<std::string> bodies;
+    auto parser = server::CreateTestParser([&bodies](std::shared_ptr<server::http::HttpRequest>&& request) {
+        bodies.push_back(request->RequestBody());
+    });
+
+    constexpr std::size_t kBodySize = 512 * 1024;
+    parser->Parse(fmt::format("POST / HTTP/1.1\r\nContent-Length: {}\r\n\r\n", kBodySize));
+
+    // The announced body is not filled up front
+    std::size_t received = 0;
+    std::size_t prev_buffer_size = 0;
+    while (received < kBodySize) {
+        const auto buffer = parser->GetBodyReadBuffer();
+        ASSERT_FALSE(buffer.empty());
+        EXPECT_LE(buffer.size(), std::max<std::size_t>(received, 64 * 1024));
+        EXPECT_GE(buffer.size(), prev_buffer_size);
+        prev_buffer_size = buffer.size();
+
+        std::memset(buffer.data(), 'b', buffer.size());
+        parser->Parse({buffer.data(), buffer.size()});
+        received += buffer.size();
+    }
+    EXPECT_EQ(received, kBodySize);
+    EXPECT_TRUE(parser->GetBodyReadBuffer().empty());
+
+    EXPECT_EQ(bodies, (std::vector<std::string>{std::string(kBodySize, 'b')}));
+}
+
 // bad requests
 
 namespace {
@@ -29,8 +29,11 @@ namespace {
 constexpr std::string_view kCrlf = "\r\n";
 constexpr std::string_view kKeyValueHeaderSeparator = ": ";
 
-constexpr std::string_view kClose = "close";
-constexpr std::string_view kKeepAlive = "keep-alive";
+// Complete header lines for the most common values, appended without formatting
+constexpr std::string_view kConnectionCloseHeader = "Connection: close\r\n";
+constexpr std::string_view kConnectionKeepAliveHeader = "Connection: keep-alive\r\n";
+constexpr std::string_view kDefaultContentTypeHeader = "Content-Type: application/octet-stream\r\n";
+static_assert(kDefaultContentTypeHeader.substr(14, 24) == server::http::kDefaultContentType);
 
 const std::string kHostname = hostinfo::blocking::GetRealHostName();
 
@@ -204,6 +207,21 @@ void HttpResponse::SetCookie(Cookie cookie) {
 
 void HttpResponse::ClearCookies() { cookies_.clear(); }
 
+void HttpResponse::SetSharedData(std::shared_ptr<const void> owner, std::string_view data) {
+    UASSERT(owner || data.empty());
+    shared_data_owner_ = std::move(owner);
+    shared_data_ = data;
+    AccountBody();
+}
+
+std::string_view HttpResponse::GetBodyData() const {
+    const auto& data = GetData();
+    if (data.empty()) return shared_data_;
+    return data;
+}
+
+std::size_t HttpResponse::GetBodySize() const { return GetBodyData().size(); }
+
 HttpResponse::HeadersMapKeys HttpResponse::GetHeaderNames() const { return HttpResponse::HeadersMapKeys{headers_}; }
 
 const std::string& HttpResponse::GetHeader(std::string_view header_name) const {
@@ -236,8 +254,24 @@ void HttpResponse::SetHeadersEnd() { headers_end_.Send(); }
 bool HttpResponse::WaitForHeadersEnd() { return headers_end_.WaitForEvent(); }
 
 void HttpResponse::SendResponse(engine::io::RwBase& socket) {
-    utils::SmallString<USERVER_NAMESPACE::http::headers::kTypicalHeadersSize> header;
+    USERVER_NAMESPACE::http::headers::HeadersString header;
+    WriteHeaders(header);
+
+    std::size_t sent_bytes{};
 
+    if (IsSentAsChunks()) {
+        sent_bytes = SetBodyStreamed(socket, header);
+    } else {
+        // e.g. a CustomHandlerException
+        sent_bytes = SetBodyNotStreamed(socket, header);
+    }
+
+    SetSent(sent_bytes, std::chrono::steady_clock::now());
+}
+
+bool HttpResponse::IsSentAsChunks() const { return IsBodyStreamed() && GetBodyData().empty(); }
+
+void HttpResponse::WriteHeaders(USERVER_NAMESPACE::http::headers::HeadersString& header) {
     header.resize_and_overwrite(USERVER_NAMESPACE::http::headers::kTypicalHeadersSize, [&](char* data, std::size_t) {
         char* old_data_pointer = data;
         AppendToCharArray(data, "HTTP/");
@@ -260,13 +294,11 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
         );
     }
     if (headers_.find(USERVER_NAMESPACE::http::headers::kContentType) == end) {
-        impl::OutputHeader(header, USERVER_NAMESPACE::http::headers::kContentType, kDefaultContentType);
+        header.append(kDefaultContentTypeHeader);
     }
     headers_.OutputInHttpFormat(header);
     if (headers_.find(USERVER_NAMESPACE::http::headers::kConnection) == end) {
-        impl::OutputHeader(
-            header, USERVER_NAMESPACE::http::headers::kConnection, (request_.IsFinal() ? kClose : kKeepAlive)
-        );
+        header.append(request_.IsFinal() ? kConnectionCloseHeader : kConnectionKeepAliveHeader);
     }
     for (const auto& cookie : cookies_) {
         const std::size_t old_size = header.size();
@@ -286,24 +318,19 @@ void HttpResponse::SendResponse(engine::io::RwBase& socket) {
 
         header.append(kCrlf);
     }
-
-    std::size_t sent_bytes{};
-
-    if (IsBodyStreamed() && GetData().empty()) {
-        sent_bytes = SetBodyStreamed(socket, header);
-    } else {
-        // e.g. a CustomHandlerException
-        sent_bytes = SetBodyNotStreamed(socket, header);
-    }
-
-    SetSent(sent_bytes, std::chrono::steady_clock::now());
 }
 
 std::size_t
 HttpResponse::SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::http::headers::HeadersString& header) {
+    const auto body = FinishHeadersNotStreamed(header);
+    if (body.empty()) return socket.WriteAll(header.data(), header.size(), engine::Deadline{});
+    return socket.WriteAll({{header.data(), header.size()}, {body.data(), body.size()}}, engine::Deadline{});
+}
+
+std::string_view HttpResponse::FinishHeadersNotStreamed(USERVER_NAMESPACE::http::headers::HeadersString& header) {
     const bool is_body_forbidden = IsBodyForbiddenForStatus(status_);
     const bool is_head_request = request_.GetMethod() == HttpMethod::kHead;
-    const auto& data = GetData();
+    const auto data = GetBodyData();
 
     if (!is_body_forbidden) {
         impl::OutputHeader(
@@ -317,14 +344,8 @@ HttpResponse::SetBodyNotStreamed(engine::io::RwBase& socket, USERVER_NAMESPACE::
                               << " which does not allow one, it will be dropped";
     }
 
-    ssize_t sent_bytes = 0;
-    if (!is_head_request && !is_body_forbidden) {
-        sent_bytes = socket.WriteAll({{header.data(), header.size()}, {data.data(), data.size()}}, engine::Deadline{});
-    } else {
-        sent_bytes = socket.WriteAll(header.data(), header.size(), engine::Deadline{});
-    }
-
-    return sent_bytes;
+    if (is_head_request || is_body_forbidden) return {};
+    return data;
 }
 
 std::size_t
@@ -0,0 +1,67 @@
+#include <server/http/http_response_batch.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+#include <userver/server/http/http_response.hpp>
+#include <userver/utils/assert.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+HttpResponseBatch::HttpResponseBatch() = default;
+
+bool HttpResponseBatch::Append(HttpResponse& response) {
+    UASSERT(!response.IsSent());
+    if (response.IsSentAsChunks()) return false;
+
+    auto& entry = entries_.emplace_back();
+    entry.response = &response;
+    response.WriteHeaders(entry.headers);
+    entry.body = response.FinishHeadersNotStreamed(entry.headers);
+    bytes_count_ += entry.headers.size() + entry.body.size();
+    return true;
+}
+
+void HttpResponseBatch::Flush(engine::io::RwBase& socket) {
+    if (entries_.empty()) return;
+
+    // headers are referenced only now, as entries_ may have been reallocated
+    io_data_.clear();
+    for (const auto& entry : entries_) {
+        io_data_.push_back({entry.headers.data(), entry.headers.size()});
+        if (!entry.body.empty()) io_data_.push_back({entry.body.data(), entry.body.size()});
+    }
+
+    std::size_t sent_bytes = 0;
+    try {
+        sent_bytes = socket.WriteAll(io_data_.data(), io_data_.size(), engine::Deadline{});
+    } catch (const std::exception&) {
+        SetSendFailed();
+        throw;
+    }
+
+    // Less than requested is written if the peer closed the connection
+    const auto now = std::chrono::steady_clock::now();
+    for (const auto& entry : entries_) {
+        const auto response_bytes = std::min(sent_bytes, entry.headers.size() + entry.body.size());
+        sent_bytes -= response_bytes;
+        entry.response->SetSent(response_bytes, now);
+    }
+    entries_.clear();
+    bytes_count_ = 0;
+}
+
+void HttpResponseBatch::SetSendFailed() {
+    const auto now = std::chrono::steady_clock::now();
+    for (const auto& entry : entries_) {
+        entry.response->SetSendFailed(now);
+    }
+    entries_.clear();
+    bytes_count_ = 0;
+}
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include <userver/engine/io/common.hpp>
+#include <userver/http/predefined_header.hpp>
+#include <userver/utils/small_string.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http {
+
+class HttpResponse;
+
+// Coalesces the responses to pipelined HTTP/1.x requests into a single
+// vectored write. The response bodies are not copied, so the responses must
+// outlive the batch until Flush().
+class HttpResponseBatch final {
+public:
+    HttpResponseBatch();
+
+    // Returns false if the response can not be batched, e.g. if its body is
+    // streamed. Such responses are sent with HttpResponse::SendResponse().
+    bool Append(HttpResponse& response);
+
+    bool IsEmpty() const noexcept { return entries_.empty(); }
+    std::size_t GetResponsesCount() const noexcept { return entries_.size(); }
+    std::size_t GetBytesCount() const noexcept { return bytes_count_; }
+
+    // Writes all the responses and marks them as sent. Leaves the batch empty
+    // even if the write throws.
+    void Flush(engine::io::RwBase& socket);
+
+    // Marks all the responses as failed and empties the batch
+    void SetSendFailed();
+
+private:
+    struct Entry {
+        HttpResponse* response;
+        USERVER_NAMESPACE::http::headers::HeadersString headers;
+        std::string_view body;
+    };
+
+    std::vector<Entry> entries_;
+    std::vector<engine::io::IoData> io_data_;
+    std::size_t bytes_count_{0};
+};
+
+}  // namespace server::http
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,64 @@
+#include <server/http/http_response_batch.hpp>
+
+#include <string>
+#include <string_view>
+
+#include <gmock/gmock.h>
+
+#include <userver/engine/async.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/server/http/http_request_builder.hpp>
+#include <userver/server/http/http_response.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+UTEST(HttpResponseBatch, SingleWrite) {
+    const auto test_deadline = engine::Deadline::FromDuration(utest::kMaxTestWaitTime);
+
+    server::request::ResponseDataAccounter accounter;
+    const auto first = server::http::HttpRequestBuilder{accounter}.Build();
+    const auto second = server::http::HttpRequestBuilder{accounter}.Build();
+    first->GetHttpResponse().SetData("first body");
+    second->GetHttpResponse().SetData("second body");
+
+    server::http::HttpResponseBatch batch;
+    EXPECT_TRUE(batch.IsEmpty());
+    ASSERT_TRUE(batch.Append(first->GetHttpResponse()));
+    ASSERT_TRUE(batch.Append(second->GetHttpResponse()));
+    EXPECT_EQ(batch.GetResponsesCount(), 2);
+    const auto bytes_count = batch.GetBytesCount();
+
+    auto [server, client] = internal::net::TcpListener{}.MakeSocketPair(test_deadline);
+    auto send_task = engine::AsyncNoSpan(
+        [](auto&& batch, auto&& socket) { batch.Flush(socket); }, std::ref(batch), std::move(server)
+    );
+
+    std::string buffer(4096, '\0');
+    const auto reply_size = client.RecvAll(buffer.data(), buffer.size(), test_deadline);
+    buffer.resize(reply_size);
+    send_task.Get();
+
+    EXPECT_EQ(reply_size, bytes_count);
+    EXPECT_THAT(buffer, testing::StartsWith("HTTP/1.1 200 OK\r\n"));
+    EXPECT_THAT(buffer, testing::HasSubstr("\r\n\r\nfirst bodyHTTP/1.1 200 OK\r\n"));
+    EXPECT_THAT(buffer, testing::EndsWith("\r\n\r\nsecond body"));
+
+    EXPECT_TRUE(batch.IsEmpty());
+    EXPECT_EQ(batch.GetBytesCount(), 0);
+    EXPECT_TRUE(first->GetHttpResponse().IsSent());
+    EXPECT_TRUE(second->GetHttpResponse().IsSent());
+    EXPECT_EQ(first->GetHttpResponse().BytesSent() + second->GetHttpResponse().BytesSent(), bytes_count);
+}
+
+UTEST(HttpResponseBatch, StreamedBodyIsNotBatched) {
+    server::request::ResponseDataAccounter accounter;
+    const auto request = server::http::HttpRequestBuilder{accounter}.Build();
+    request->GetHttpResponse().SetStreamBody();
+
+    server::http::HttpResponseBatch batch;
+    EXPECT_FALSE(batch.Append(request->GetHttpResponse()));
+    EXPECT_TRUE(batch.IsEmpty());
+}
+
+USERVER_NAMESPACE_END
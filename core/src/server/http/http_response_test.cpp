@@ -1,3 +1,5 @@
+#include <memory>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -75,6 +77,26 @@ UTEST(HttpResponse, AccounterLifetimeIfSent) {
     // Now we just should not crash
 }
 
+UTEST(HttpResponse, SharedDataAccounted) {
+    server::request::ResponseDataAccounter accounter;
+    const auto request = server::http::HttpRequestBuilder{accounter}.Build();
+    auto& response = request->GetHttpResponse();
+
+    const auto shared_body = std::make_shared<const std::string>("shared test data");
+    response.SetSharedData(shared_body, *shared_body);
+    EXPECT_TRUE(response.GetData().empty());
+    EXPECT_EQ(response.GetBodyData(), *shared_body);
+    EXPECT_EQ(accounter.GetCurrentLevel(), shared_body->size());
+
+    const std::string body = "test data";
+    response.SetData(body);
+    EXPECT_EQ(response.GetBodyData(), body);
+    EXPECT_EQ(accounter.GetCurrentLevel(), body.size());
+
+    response.SetSendFailed(std::chrono::steady_clock::now());
+    EXPECT_EQ(accounter.GetCurrentLevel(), 0);
+}
+
 class HttpResponseBody : public testing::TestWithParam<int> {};
 
 UTEST_P(HttpResponseBody, ForbiddenBody) {
@@ -1,6 +1,14 @@
 #include "multipart_form_data_parser.hpp"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <array>
+#include <cstdint>
+#include <cstring>
 
 #include <boost/algorithm/string/predicate.hpp>
 
@@ -19,6 +27,8 @@ constexpr utils::StringLiteral kMultipartFormData = "multipart/form-data";
 
 constexpr char kCr = '\r';
 constexpr char kLf = '\n';
+constexpr std::string_view kLineBreakChars = "\r\n";
+constexpr std::string_view kDefaultCrLf = "\r\n";
 
 constexpr utils::StringLiteral kOwsChars = " \t";
 
@@ -243,38 +253,17 @@ bool ParseMultipartFormDataHeaders(std::string_view& body, FormDataArgInfo& arg_
     return SkipCrLf(body, crlf);
 }
 
-size_t FindBoundaryEnd(std::string_view body, std::string_view boundary, std::string_view crlf) {
-    size_t pos = 0;
-    while (pos < body.size()) {
-        if (body[pos] == crlf.front()) {
-            if (pos + crlf.size() < body.size() && body.substr(pos, crlf.size()) == crlf) {
-                pos += crlf.size();
-                if (pos < body.size() && body[pos] == '-') {
-                    ++pos;
-                    if (pos < body.size() && body[pos] == '-') {
-                        ++pos;
-                        size_t idx = 0;
-                        while (idx < boundary.size() && pos + idx < body.size() && body[pos + idx] == boundary[idx])
-                            ++idx;
-                        pos += idx;
-                        if (idx == boundary.size()) return pos;
-                    }
-                }
-            } else
-                ++pos;
-        } else
-            ++pos;
-    }
-    return std::string_view::npos;
+size_t FindBoundaryEnd(std::string_view body, std::string_view delimiter) {
+    const size_t pos = FindMultipartDelimiter(body, delimiter);
+    return pos == std::string_view::npos ? pos : pos + delimiter.size();
 }
 
 bool ParseMultipartFormDataValue(
     std::string_view& body,
-    std::string_view boundary,
+    std::string_view delimiter,
     FormDataArgInfo&& arg_info,
     std::optional<std::string>& charset,
-    FormDataArgs& form_data_args,
-    std::string_view crlf
+    FormDataArgs& form_data_args
 ) {
     static constexpr utils::StringLiteral kCharset = "_charset_";
 
@@ -283,12 +272,12 @@ bool ParseMultipartFormDataValue(
         return false;
     }
 
-    size_t pos = FindBoundaryEnd(body, boundary, crlf);
+    size_t pos = FindBoundaryEnd(body, delimiter);
     if (pos == std::string_view::npos) {
         LOG_WARNING() << "Unexpected end of form-data part value";
         return false;
     }
-    arg_info.arg.value = body.substr(0, pos - boundary.size() - 2 - crlf.size());
+    arg_info.arg.value = body.substr(0, pos - delimiter.size());
     if (arg_info.name == kCharset) {
         charset = arg_info.arg.value;
     } else {
@@ -308,15 +297,18 @@ bool ParseMultipartFormDataBody(
     bool strict_cr_lf
 ) {
     LOG_TRACE() << "body=" << body << ", body.size()=" << body.size();
-    std::string_view crlf = "\r\n";
-    if (boundary.size() + 2 <= body.size() && body[0] == '-' && body[1] == '-' &&
-        body.substr(2, boundary.size()) == boundary) {
+    std::string_view crlf = kDefaultCrLf;
+    const bool starts_with_boundary = boundary.size() + 2 <= body.size() && body[0] == '-' && body[1] == '-' &&
+                                      body.substr(2, boundary.size()) == boundary;
+    if (starts_with_boundary) {
         body.remove_prefix(2 + boundary.size());
-        if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
     } else {
-        while (!body.empty() && body.front() != kCr && body.front() != kLf) body.remove_prefix(1);
-        if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
-        size_t pos = FindBoundaryEnd(body, boundary, crlf);
+        body.remove_prefix(std::min(body.find_first_of(kLineBreakChars), body.size()));
+    }
+    if (!strict_cr_lf) crlf = AutoDetectCrLf(body, crlf);
+    const auto delimiter = MakeMultipartDelimiter(boundary, crlf);
+    if (!starts_with_boundary) {
+        size_t pos = FindBoundaryEnd(body, delimiter);
         if (pos == std::string_view::npos) {
             LOG_WARNING() << "Unexpected request body end";
             return false;
@@ -358,7 +350,7 @@ bool ParseMultipartFormDataBody(
 
         if (!ParseMultipartFormDataHeaders(body, arg_info, crlf)) return false;
         LOG_TRACE() << "ParseMultipartFormDataHeaders finished, body=" << body << ", body.size()=" << body.size();
-        if (!ParseMultipartFormDataValue(body, boundary, std::move(arg_info), charset, form_data_args, crlf)) {
+        if (!ParseMultipartFormDataValue(body, delimiter, std::move(arg_info), charset, form_data_args)) {
             return false;
         }
     }
@@ -380,12 +372,7 @@ bool IsMultipartFormDataContentType(std::string_view content_type) {
     return false;
 }
 
-bool ParseMultipartFormData(
-    const std::string& content_type,
-    std::string_view body,
-    FormDataArgs& form_data_args,
-    bool strict_cr_lf
-) {
+bool ParseMultipartFormDataContentType(std::string_view content_type, std::string& boundary, std::string& charset) {
     static constexpr utils::StringLiteral kBoundary = "boundary";
     static constexpr utils::StringLiteral kCharset = "charset";
     static constexpr utils::StringLiteral kBoundaryNotFound = "'boundary' parameter of multipart/form-data not found";
@@ -398,8 +385,6 @@ bool ParseMultipartFormData(
     unparsed.remove_prefix(kMultipartFormData.size());
     SkipOptionalSpaces(unparsed);
 
-    std::string boundary;
-    std::string charset;
     while (!unparsed.empty()) {
         if (!SkipSymbol(unparsed, ';')) return false;
         SkipOptionalSpaces(unparsed);
@@ -429,10 +414,85 @@ bool ParseMultipartFormData(
         LOG_WARNING() << kBoundaryNotFound;
         return false;
     }
+    return true;
+}
+
+bool ParseMultipartFormData(
+    const std::string& content_type,
+    std::string_view body,
+    FormDataArgs& form_data_args,
+    bool strict_cr_lf
+) {
+    std::string boundary;
+    std::string charset;
+    if (!ParseMultipartFormDataContentType(content_type, boundary, charset)) return false;
 
     return ParseMultipartFormDataBody(body, boundary, std::move(charset), form_data_args, strict_cr_lf);
 }
 
+bool ParseMultipartFormDataPartHeaders(std::string_view headers, std::string& name, FormDataArg& arg) {
+    FormDataArgInfo arg_info;
+    if (!ParseMultipartFormDataHeaders(headers, arg_info, kDefaultCrLf)) return false;
+    if (arg_info.arg.content_disposition.empty()) {
+        LOG_WARNING() << "Missing Content-Disposition header";
+        return false;
+    }
+    name = std::move(arg_info.name);
+    arg = std::move(arg_info.arg);
+    return true;
+}
+
+std::string MakeMultipartDelimiter(std::string_view boundary, std::string_view crlf) {
+    std::string delimiter;
+    delimiter.reserve(crlf.size() + 2 + boundary.size());
+    delimiter.append(crlf).append("--").append(boundary);
+    return delimiter;
+}
+
+size_t FindMultipartDelimiter(std::string_view body, std::string_view delimiter) noexcept {
+    const size_t size = delimiter.size();
+    UASSERT(size >= 2);
+    if (body.size() < size) return std::string_view::npos;
+
+    // The delimiter is looked for only at the positions where both its first
+    // and its last characters match, a whole register of positions at once.
+    // Part values rarely have such pairs, so the memcmp() is rarely called.
+    size_t pos = 0;
+#if defined(__AVX2__)
+    const auto first = _mm256_set1_epi8(delimiter.front());
+    const auto last = _mm256_set1_epi8(delimiter.back());
+    for (; pos + size - 1 + sizeof(__m256i) <= body.size(); pos += sizeof(__m256i)) {
+        const auto* block_first = reinterpret_cast<const __m256i*>(body.data() + pos);
+        const auto* block_last = reinterpret_cast<const __m256i*>(body.data() + pos + size - 1);
+        auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(first, _mm256_loadu_si256(block_first)),
+            _mm256_cmpeq_epi8(last, _mm256_loadu_si256(block_last))
+        )));
+        for (; mask != 0; mask &= mask - 1) {
+            const auto candidate = pos + __builtin_ctz(mask);
+            if (std::memcmp(body.data() + candidate + 1, delimiter.data() + 1, size - 2) == 0) return candidate;
+        }
+    }
+#elif defined(__SSE2__)
+    const auto first = _mm_set1_epi8(delimiter.front());
+    const auto last = _mm_set1_epi8(delimiter.back());
+    for (; pos + size - 1 + sizeof(__m128i) <= body.size(); pos += sizeof(__m128i)) {
+        const auto* block_first = reinterpret_cast<const __m128i*>(body.data() + pos);
+        const auto* block_last = reinterpret_cast<const __m128i*>(body.data() + pos + size - 1);
+        auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(first, _mm_loadu_si128(block_first)), _mm_cmpeq_epi8(last, _mm_loadu_si128(block_last))
+        )));
+        for (; mask != 0; mask &= mask - 1) {
+            const auto candidate = pos + __builtin_ctz(mask);
+            if (std::memcmp(body.data() + candidate + 1, delimiter.data() + 1, size - 2) == 0) return candidate;
+        }
+    }
+#endif
+
+    // The tail shorter than a register
+    return body.find(delimiter, pos);
+}
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
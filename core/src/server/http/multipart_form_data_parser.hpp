@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -23,6 +24,20 @@ bool ParseMultipartFormData(
     bool strict_cr_lf = false
 );
 
+// Building blocks for parsing the body by chunks, see FormDataStream
+
+bool ParseMultipartFormDataContentType(std::string_view content_type, std::string& boundary, std::string& charset);
+
+// Parses the CRLF separated headers of a part along with the following empty
+// line. The views in `arg` point into `headers`.
+bool ParseMultipartFormDataPartHeaders(std::string_view headers, std::string& name, FormDataArg& arg);
+
+// The delimiter of the parts is a line break followed by "--" and the boundary
+std::string MakeMultipartDelimiter(std::string_view boundary, std::string_view crlf = "\r\n");
+
+// Returns the position of the delimiter in the body or npos
+std::size_t FindMultipartDelimiter(std::string_view body, std::string_view delimiter) noexcept;
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
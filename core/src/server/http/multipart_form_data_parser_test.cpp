@@ -1,5 +1,7 @@
 #include <userver/utest/utest.hpp>
 
+#include <random>
+
 #include <server/http/multipart_form_data_parser.hpp>
 
 USERVER_NAMESPACE_BEGIN
@@ -511,4 +513,36 @@ TEST(MultipartFormDataParser, ParseErrors) {
     EXPECT_TRUE(form_data_args.empty());
 }
 
+TEST(MultipartFormDataParser, FindDelimiter) {
+    namespace sh = server::http;
+    const auto delimiter = sh::MakeMultipartDelimiter("zzz");
+    EXPECT_EQ(delimiter, "\r\n--zzz");
+
+    std::minstd_rand rng{42};
+    std::uniform_int_distribution<int> chars{0, 5};
+    for (std::size_t size = 0; size < 300; ++size) {
+        // Few distinct chars make the partial matches of the delimiter frequent
+        std::string body(size, ' ');
+        for (auto& c : body) c = "\r\n-z z"[chars(rng)];
+        const std::string_view view{body};
+        for (std::size_t pos = 0; pos <= size; ++pos) {
+            EXPECT_EQ(sh::FindMultipartDelimiter(view.substr(pos), delimiter), view.substr(pos).find(delimiter))
+                << "body: " << body << ", pos: " << pos;
+        }
+    }
+}
+
+TEST(MultipartFormDataParser, FindDelimiterLongBody) {
+    namespace sh = server::http;
+    const auto delimiter = sh::MakeMultipartDelimiter("------------------------8099aaf9723cd601");
+    std::string body(100'000, 'x');
+    EXPECT_EQ(sh::FindMultipartDelimiter(body, delimiter), std::string_view::npos);
+
+    for (const std::size_t pos : {0, 1, 15, 16, 31, 32, 33, 64'000, 100'000 - 60, 100'000 - 45, 100'000 - 44}) {
+        auto with_delimiter = body;
+        with_delimiter.replace(pos, delimiter.size(), delimiter);
+        EXPECT_EQ(sh::FindMultipartDelimiter(with_delimiter, delimiter), pos);
+    }
+}
+
 USERVER_NAMESPACE_END
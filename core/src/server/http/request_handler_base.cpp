@@ -6,6 +6,8 @@ namespace server::http {
 
 RequestHandlerBase::~RequestHandlerBase() noexcept = default;
 
+bool RequestHandlerBase::RejectEarly(const http::HttpRequest&) const { return false; }
+
 }  // namespace server::http
 
 USERVER_NAMESPACE_END
@@ -18,6 +18,13 @@ public:
 
     virtual engine::TaskWithResult<void> StartRequestTask(std::shared_ptr<http::HttpRequest> request) const = 0;
 
+    /// Called by the parser as soon as the method and the path of the request
+    /// are known and its handler is found, before the headers and the body are
+    /// parsed. Returns true if the request is rejected because of an overload,
+    /// in that case the response status and headers are set and the rest of the
+    /// request is not stored.
+    virtual bool RejectEarly(const http::HttpRequest& request) const;
+
     virtual const HandlerInfoIndex& GetHandlerInfoIndex() const = 0;
 
     virtual const logging::TextLoggerPtr& LoggerAccess() const noexcept = 0;
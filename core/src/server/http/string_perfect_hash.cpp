@@ -0,0 +1,129 @@
+#include <server/http/string_perfect_hash.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+
+#include <fmt/format.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+namespace {
+
+// There is 1 bucket per 2 keys on average and at least 20% of the slots are
+// empty, so a displacement is found after a few attempts
+constexpr std::uint32_t kMaxDisplacement = 1 << 16;
+// Retries with a new hash seed in the unlikely case of full hash collisions
+constexpr int kMaxSeedAttempts = 8;
+
+std::size_t CeilPowerOfTwo(std::size_t value) noexcept {
+    std::size_t result = 1;
+    while (result < value) result <<= 1;
+    return result;
+}
+
+// SplitMix64 finalizer
+std::uint64_t Mix(std::uint64_t value) noexcept {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+    return value;
+}
+
+std::size_t SlotOf(std::size_t hash, std::uint32_t displacement, std::size_t slots_mask) noexcept {
+    return Mix(hash + displacement * 0x9e3779b97f4a7c15ULL) & slots_mask;
+}
+
+}  // namespace
+
+StringPerfectHash::StringPerfectHash() : StringPerfectHash(std::vector<std::string_view>{}) {}
+
+StringPerfectHash::StringPerfectHash(const std::vector<std::string_view>& keys) : keys_(keys.begin(), keys.end()) {
+    const std::unordered_set<std::string_view> unique_keys(keys.begin(), keys.end());
+    if (unique_keys.size() != keys.size()) {
+        throw std::runtime_error("Duplicate keys in StringPerfectHash");
+    }
+
+    for (int attempt = 0; attempt < kMaxSeedAttempts; ++attempt) {
+        if (TryBuild()) return;
+        hash_ = utils::StrCaseHash{};
+    }
+    throw std::runtime_error(fmt::format("Failed to build a perfect hash of {} keys", keys_.size()));
+}
+
+std::optional<std::size_t> StringPerfectHash::Find(std::string_view key) const noexcept {
+    const auto index = slots_[GetSlot(hash_(key))];
+    if (index == 0 || keys_[index - 1] != key) return std::nullopt;
+    return index - 1;
+}
+
+bool StringPerfectHash::TryBuild() {
+    const auto keys_count = keys_.size();
+    const auto buckets_mask = CeilPowerOfTwo(keys_count / 2 + 1) - 1;
+    const auto slots_mask = CeilPowerOfTwo(keys_count + keys_count / 4 + 1) - 1;
+
+    // (hash, key index) by bucket
+    std::vector<std::vector<std::pair<std::size_t, std::uint32_t>>> buckets(buckets_mask + 1);
+    for (std::uint32_t i = 0; i < keys_count; ++i) {
+        const auto hash = hash_(keys_[i]);
+        buckets[hash & buckets_mask].emplace_back(hash, i);
+    }
+
+    // Larger buckets are harder to place, so they go first
+    std::vector<std::uint32_t> order(buckets.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&buckets](std::uint32_t lhs, std::uint32_t rhs) {
+        return buckets[lhs].size() > buckets[rhs].size();
+    });
+
+    std::vector<std::uint32_t> displacements(buckets.size(), 0);
+    std::vector<std::uint32_t> slots(slots_mask + 1, 0);
+    std::vector<std::size_t> bucket_slots;
+    for (const auto bucket_index : order) {
+        const auto& bucket = buckets[bucket_index];
+        if (bucket.empty()) break;
+
+        bool placed = false;
+        for (std::uint32_t displacement = 0; displacement < kMaxDisplacement && !placed; ++displacement) {
+            bucket_slots.clear();
+            placed = true;
+            for (const auto& [hash, key_index] : bucket) {
+                const auto slot = SlotOf(hash, displacement, slots_mask);
+                const bool is_taken_by_bucket =
+                    std::find(bucket_slots.begin(), bucket_slots.end(), slot) != bucket_slots.end();
+                if (slots[slot] != 0 || is_taken_by_bucket) {
+                    placed = false;
+                    break;
+                }
+                bucket_slots.push_back(slot);
+            }
+
+            if (placed) {
+                displacements[bucket_index] = displacement;
+                for (std::size_t i = 0; i < bucket.size(); ++i) {
+                    slots[bucket_slots[i]] = bucket[i].second + 1;
+                }
+            }
+        }
+        if (!placed) return false;
+    }
+
+    displacements_ = std::move(displacements);
+    slots_ = std::move(slots);
+    return true;
+}
+
+std::size_t StringPerfectHash::GetSlot(std::size_t hash) const noexcept {
+    const auto displacement = displacements_[hash & (displacements_.size() - 1)];
+    return SlotOf(hash, displacement, slots_.size() - 1);
+}
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::http::impl {
+
+/// @brief Immutable set of strings with a collision-free hash table.
+///
+/// Maps each key to its index in the constructor argument. A lookup computes
+/// one hash and compares one key, no matter how many keys there are. Built
+/// with the hash-and-displace method: keys are grouped into buckets by hash,
+/// and for each bucket a displacement is found that puts all of its keys into
+/// free slots.
+class StringPerfectHash final {
+public:
+    StringPerfectHash();
+
+    /// @throws std::runtime_error on duplicate keys
+    explicit StringPerfectHash(const std::vector<std::string_view>& keys);
+
+    /// @returns index of the key in the constructor argument
+    std::optional<std::size_t> Find(std::string_view key) const noexcept;
+
+    std::size_t GetSize() const noexcept { return keys_.size(); }
+
+private:
+    bool TryBuild();
+
+    std::size_t GetSlot(std::size_t hash) const noexcept;
+
+    utils::StrCaseHash hash_;
+    std::vector<std::string> keys_;
+    // Indexed by bucket
+    std::vector<std::uint32_t> displacements_;
+    // Key index + 1, 0 for the empty slots
+    std::vector<std::uint32_t> slots_;
+};
+
+}  // namespace server::http::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <server/http/string_perfect_hash.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+// Paths of an API gateway with state.range(0) fixed-path handlers
+std::vector<std::string> MakeHandlerPaths(std::size_t count) {
+    std::vector<std::string> paths;
+    paths.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        paths.push_back(fmt::format("/v{}/service-{}/resource/action-{}", i % 3 + 1, i / 10, i));
+    }
+    return paths;
+}
+
+// Every other request misses, as requests to the wildcard handlers do
+std::vector<std::string> MakeRequestPaths(const std::vector<std::string>& handler_paths) {
+    std::vector<std::string> requests;
+    for (std::size_t i = 0; i < handler_paths.size(); ++i) {
+        requests.push_back(handler_paths[(i * 7919) % handler_paths.size()]);
+        requests.push_back(handler_paths[i] + "/details");
+    }
+    return requests;
+}
+
+}  // namespace
+
+void http_fixed_path_routing_perfect_hash(benchmark::State& state) {
+    const auto paths = MakeHandlerPaths(state.range(0));
+    const auto requests = MakeRequestPaths(paths);
+    const server::http::impl::StringPerfectHash index{std::vector<std::string_view>(paths.begin(), paths.end())};
+
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(index.Find(requests[i++ % requests.size()]));
+    }
+}
+BENCHMARK(http_fixed_path_routing_perfect_hash)->Arg(10)->Arg(100)->Arg(2000);
+
+void http_fixed_path_routing_unordered_map(benchmark::State& state) {
+    const auto paths = MakeHandlerPaths(state.range(0));
+    const auto requests = MakeRequestPaths(paths);
+    std::unordered_map<std::string, std::size_t> index;
+    for (std::size_t i = 0; i < paths.size(); ++i) index.emplace(paths[i], i);
+
+    std::size_t i = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(index.find(requests[i++ % requests.size()]));
+    }
+}
+BENCHMARK(http_fixed_path_routing_unordered_map)->Arg(10)->Arg(100)->Arg(2000);
+
+USERVER_NAMESPACE_END
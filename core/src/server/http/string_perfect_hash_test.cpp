@@ -0,0 +1,38 @@
+#include <server/http/string_perfect_hash.hpp>
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+using server::http::impl::StringPerfectHash;
+
+TEST(StringPerfectHash, Empty) {
+    const StringPerfectHash index;
+    EXPECT_EQ(index.GetSize(), 0);
+    EXPECT_FALSE(index.Find(""));
+    EXPECT_FALSE(index.Find("/ping"));
+}
+
+TEST(StringPerfectHash, FindsAllKeys) {
+    std::vector<std::string> keys;
+    for (int i = 0; i < 5000; ++i) keys.push_back("/handler/" + std::to_string(i));
+    keys.emplace_back();
+
+    const StringPerfectHash index{std::vector<std::string_view>(keys.begin(), keys.end())};
+    ASSERT_EQ(index.GetSize(), keys.size());
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(index.Find(keys[i]), i) << keys[i];
+    }
+
+    EXPECT_FALSE(index.Find("/handler/5000"));
+    EXPECT_FALSE(index.Find("/handler/"));
+    EXPECT_FALSE(index.Find("/HANDLER/1"));
+}
+
+TEST(StringPerfectHash, DuplicateKeys) {
+    EXPECT_THROW(StringPerfectHash({"/a", "/b", "/a"}), std::runtime_error);
+}
+
+USERVER_NAMESPACE_END
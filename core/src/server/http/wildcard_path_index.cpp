@@ -1,5 +1,6 @@
 #include <server/http/wildcard_path_index.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 
 #include <boost/algorithm/string/split.hpp>
@@ -28,42 +29,18 @@ std::string ExtractWildcardName(const std::string& str) {
     return str.substr(1, str.size() - 2);
 }
 
-bool GetFromHandlerMethodIndex(
-    const WildcardPathIndex::Node& node,
-    HttpMethod method,
-    const std::vector<std::string>& path,
-    MatchRequestResult& match_result,
-    bool limit_path_length
-) {
-    const auto& index_map = node.handler_method_index_map;
-    decltype(index_map.begin()) it;
-    if (limit_path_length) {
-        it = index_map.find(path.size());
-    } else {
-        it = index_map.upper_bound(path.size());
-        if (it == index_map.begin()) return false;
-        --it;
-    }
-    if (it == index_map.end()) return false;
-    const auto& handler_method_index = it->second;
-
-    const auto* handler_info_data = handler_method_index.GetHandlerInfoData(method);
-    if (!handler_info_data) {
-        match_result.status = MatchRequestResult::Status::kMethodNotAllowed;
-        return false;
-    }
-
-    match_result.handler_info = &handler_info_data->handler_info;
-    for (const auto& arg : handler_info_data->wildcards) {
-        if (arg.index > path.size())
-            throw std::logic_error(
-                "matched path from handler has length greater than path from "
-                "request"
-            );
-        match_result.args_from_path.emplace_back(arg.name, arg.index == path.size() ? std::string{} : path[arg.index]);
+WildcardPathIndex::PathSegments SplitRequestPath(std::string_view path) {
+    WildcardPathIndex::PathSegments segments;
+    std::size_t begin = 0;
+    while (true) {
+        const auto end = path.find('/', begin);
+        if (end == std::string_view::npos) {
+            segments.push_back(path.substr(begin));
+            return segments;
+        }
+        segments.push_back(path.substr(begin, end - begin));
+        begin = end + 1;
     }
-    match_result.status = MatchRequestResult::Status::kOk;
-    return true;
 }
 
 }  // namespace
@@ -102,9 +79,19 @@ void WildcardPathIndex::AddHandler(const handlers::HttpHandlerBase& handler, eng
     }
 }
 
+void WildcardPathIndex::Freeze() {
+    frozen_nodes_.clear();
+    frozen_positions_.clear();
+    frozen_children_.clear();
+    frozen_handlers_.clear();
+    FreezeNode(root_);
+}
+
 bool WildcardPathIndex::MatchRequest(HttpMethod method, const std::string& path, MatchRequestResult& match_result)
     const {
-    return MatchRequest(root_, method, SplitBySlash(path), path.size(), match_result);
+    const auto segments = SplitRequestPath(path);
+    if (frozen_nodes_.empty()) return MatchRequest(root_, method, segments, path.size(), match_result);
+    return MatchRequest(frozen_nodes_.front(), method, segments, path.size(), match_result);
 }
 
 void WildcardPathIndex::AddHandler(
@@ -144,17 +131,57 @@ void WildcardPathIndex::AddPath(
     cur->handler_method_index_map[length].AddHandler(handler, task_processor, std::move(wildcards));
 }
 
+std::uint32_t WildcardPathIndex::FreezeNode(const Node& node) {
+    const auto node_index = static_cast<std::uint32_t>(frozen_nodes_.size());
+    frozen_nodes_.emplace_back();
+
+    const auto handlers_begin = static_cast<std::uint32_t>(frozen_handlers_.size());
+    for (const auto& [path_length, handler_method_index] : node.handler_method_index_map) {
+        frozen_handlers_.push_back({path_length, &handler_method_index});
+    }
+
+    // Ranges of the children are allocated before the recursion fills them
+    const auto positions_begin = static_cast<std::uint32_t>(frozen_positions_.size());
+    for (const auto& [index, children] : node.next) {
+        const auto children_begin = static_cast<std::uint32_t>(frozen_children_.size());
+        frozen_children_.resize(frozen_children_.size() + children.size());
+        frozen_positions_.push_back(
+            {index, children_begin, static_cast<std::uint32_t>(frozen_children_.size()), kNoNode}
+        );
+    }
+
+    frozen_nodes_[node_index] = {
+        positions_begin,
+        static_cast<std::uint32_t>(frozen_positions_.size()),
+        handlers_begin,
+        static_cast<std::uint32_t>(frozen_handlers_.size())};
+
+    auto position_index = positions_begin;
+    for (const auto& [index, children] : node.next) {
+        // std::map keeps the children sorted by segment
+        auto child_index = frozen_positions_[position_index].children_begin;
+        for (const auto& [segment, child] : children) {
+            const auto child_node = FreezeNode(child);
+            frozen_children_[child_index++] = {segment, child_node};
+            if (segment == kAnySuffixMark) frozen_positions_[position_index].any_suffix_node = child_node;
+        }
+        ++position_index;
+    }
+
+    return node_index;
+}
+
 bool WildcardPathIndex::MatchRequest(
     const Node& node,
     HttpMethod method,
-    const std::vector<std::string>& path,
+    const PathSegments& path,
     size_t path_string_length,
     MatchRequestResult& match_result
 ) const {
-    for (const auto& next_item : node.next) {
-        if (next_item.first >= path.size()) break;
-        auto it = next_item.second.find(path[next_item.first]);
-        if (it != next_item.second.end()) {
+    for (const auto& [index, children] : node.next) {
+        if (index >= path.size()) break;
+        const auto it = children.find(path[index]);
+        if (it != children.end()) {
             if (MatchRequest(it->second, method, path, path_string_length, match_result)) return true;
         }
     }
@@ -169,25 +196,142 @@ bool WildcardPathIndex::MatchRequest(
     auto node_next_it = node.next.lower_bound(path.size());
     while (node_next_it != node.next.begin()) {
         --node_next_it;
-        auto it = node_next_it->second.find(kAnySuffixMark);
-        if (it != node_next_it->second.end()) {
-            if (GetFromHandlerMethodIndex(it->second, method, path, match_result, false)) {
-                size_t asterisk_pos = node_next_it->first;
-                match_result.matched_path_length = asterisk_pos;
-                for (size_t i = 0; i < asterisk_pos; i++) {
-                    match_result.matched_path_length += path[i].size();
-                }
-                for (size_t i = asterisk_pos; i < path.size(); i++) {
-                    match_result.args_from_path.emplace_back(std::string{}, path[i]);
-                }
-                return true;
+        const auto it = node_next_it->second.find(kAnySuffixMark);
+        if (it == node_next_it->second.end()) continue;
+
+        if (GetFromHandlerMethodIndex(it->second, method, path, match_result, false)) {
+            const size_t asterisk_pos = node_next_it->first;
+            match_result.matched_path_length = asterisk_pos;
+            for (size_t j = 0; j < asterisk_pos; j++) {
+                match_result.matched_path_length += path[j].size();
+            }
+            for (size_t j = asterisk_pos; j < path.size(); j++) {
+                match_result.args_from_path.emplace_back(std::string{}, std::string{path[j]});
             }
+            return true;
         }
     }
 
     return false;
 }
 
+bool WildcardPathIndex::GetFromHandlerMethodIndex(
+    const Node& node,
+    HttpMethod method,
+    const PathSegments& path,
+    MatchRequestResult& match_result,
+    bool limit_path_length
+) {
+    const auto& index_map = node.handler_method_index_map;
+    // the handlers with the longest path not longer than the request path
+    auto it = index_map.upper_bound(path.size());
+    if (it == index_map.begin()) return false;
+    --it;
+    if (limit_path_length && it->first != path.size()) return false;
+
+    return GetFromHandlerMethodIndex(it->second, method, path, match_result);
+}
+
+bool WildcardPathIndex::MatchRequest(
+    const FrozenNode& node,
+    HttpMethod method,
+    const PathSegments& path,
+    size_t path_string_length,
+    MatchRequestResult& match_result
+) const {
+    for (auto i = node.positions_begin; i < node.positions_end; ++i) {
+        const auto& position = frozen_positions_[i];
+        if (position.index >= path.size()) break;
+        const auto child_node = FindChild(position, path[position.index]);
+        if (child_node != kNoNode) {
+            if (MatchRequest(frozen_nodes_[child_node], method, path, path_string_length, match_result)) return true;
+        }
+    }
+
+    // check for match without '*'
+    if (GetFromHandlerMethodIndex(node, method, path, match_result, true)) {
+        match_result.matched_path_length = path_string_length;
+        return true;
+    }
+
+    // check "/some/.../path/*"
+    for (auto i = node.positions_end; i > node.positions_begin; --i) {
+        const auto& position = frozen_positions_[i - 1];
+        if (position.index >= path.size() || position.any_suffix_node == kNoNode) continue;
+
+        if (GetFromHandlerMethodIndex(frozen_nodes_[position.any_suffix_node], method, path, match_result, false)) {
+            const size_t asterisk_pos = position.index;
+            match_result.matched_path_length = asterisk_pos;
+            for (size_t j = 0; j < asterisk_pos; j++) {
+                match_result.matched_path_length += path[j].size();
+            }
+            for (size_t j = asterisk_pos; j < path.size(); j++) {
+                match_result.args_from_path.emplace_back(std::string{}, std::string{path[j]});
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::uint32_t WildcardPathIndex::FindChild(const FrozenPosition& position, std::string_view segment) const {
+    const auto begin = frozen_children_.begin() + position.children_begin;
+    const auto end = frozen_children_.begin() + position.children_end;
+    const auto it = std::lower_bound(begin, end, segment, [](const FrozenChild& child, std::string_view value) {
+        return child.segment < value;
+    });
+    if (it == end || it->segment != segment) return kNoNode;
+    return it->node;
+}
+
+bool WildcardPathIndex::GetFromHandlerMethodIndex(
+    const FrozenNode& node,
+    HttpMethod method,
+    const PathSegments& path,
+    MatchRequestResult& match_result,
+    bool limit_path_length
+) const {
+    const auto begin = frozen_handlers_.begin() + node.handlers_begin;
+    const auto end = frozen_handlers_.begin() + node.handlers_end;
+    // the handlers with the longest path not longer than the request path
+    auto it = std::upper_bound(begin, end, path.size(), [](size_t value, const FrozenHandlers& handlers) {
+        return value < handlers.path_length;
+    });
+    if (it == begin) return false;
+    --it;
+    if (limit_path_length && it->path_length != path.size()) return false;
+
+    return GetFromHandlerMethodIndex(*it->handler_method_index, method, path, match_result);
+}
+
+bool WildcardPathIndex::GetFromHandlerMethodIndex(
+    const HandlerMethodIndex& handler_method_index,
+    HttpMethod method,
+    const PathSegments& path,
+    MatchRequestResult& match_result
+) {
+    const auto* handler_info_data = handler_method_index.GetHandlerInfoData(method);
+    if (!handler_info_data) {
+        match_result.status = MatchRequestResult::Status::kMethodNotAllowed;
+        return false;
+    }
+
+    match_result.handler_info = &handler_info_data->handler_info;
+    for (const auto& arg : handler_info_data->wildcards) {
+        if (arg.index > path.size())
+            throw std::logic_error(
+                "matched path from handler has length greater than path from "
+                "request"
+            );
+        match_result.args_from_path.emplace_back(
+            arg.name, arg.index == path.size() ? std::string{} : std::string{path[arg.index]}
+        );
+    }
+    match_result.status = MatchRequestResult::Status::kOk;
+    return true;
+}
+
 PathItem WildcardPathIndex::ExtractFixedPathItem(size_t index, std::string&& path_elem) {
     return PathItem{index, std::move(path_elem)};
 }
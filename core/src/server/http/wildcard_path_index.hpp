@@ -1,10 +1,15 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+
 #include <userver/engine/task/task_processor_fwd.hpp>
 
 #include <server/http/handler_info_index.hpp>
@@ -22,17 +27,56 @@ class WildcardPathIndex final {
 public:
     struct Node {
         // ordered by position in path
-        std::map<size_t, std::map<std::string, Node>> next;
+        std::map<size_t, std::map<std::string, Node, std::less<>>> next;
 
         // by path length
         std::map<size_t, HandlerMethodIndex> handler_method_index_map;
     };
 
+    // Request path split by '/'
+    using PathSegments = boost::container::small_vector<std::string_view, 16>;
+
     void AddHandler(const handlers::HttpHandlerBase& handler, engine::TaskProcessor& task_processor);
 
+    // Copies the tree into contiguous arrays used by MatchRequest(), must be
+    // called after the handlers are added. Until then MatchRequest() walks the
+    // tree itself.
+    void Freeze();
+
     bool MatchRequest(HttpMethod method, const std::string& path, MatchRequestResult& match_result) const;
 
 private:
+    static constexpr std::uint32_t kNoNode = -1;
+
+    // Children of a frozen node at some position in path
+    struct FrozenPosition {
+        std::size_t index;
+        // Range of frozen_children_, sorted by segment
+        std::uint32_t children_begin;
+        std::uint32_t children_end;
+        // The child for the "*" segment
+        std::uint32_t any_suffix_node;
+    };
+
+    struct FrozenChild {
+        std::string_view segment;
+        std::uint32_t node;
+    };
+
+    struct FrozenHandlers {
+        std::size_t path_length;
+        const HandlerMethodIndex* handler_method_index;
+    };
+
+    struct FrozenNode {
+        // Range of frozen_positions_, ordered by position in path
+        std::uint32_t positions_begin;
+        std::uint32_t positions_end;
+        // Range of frozen_handlers_, ordered by path length
+        std::uint32_t handlers_begin;
+        std::uint32_t handlers_end;
+    };
+
     void AddHandler(
         const std::string& path,
         const handlers::HttpHandlerBase& handler,
@@ -46,14 +90,49 @@ private:
         std::vector<PathItem> wildcards
     );
 
+    std::uint32_t FreezeNode(const Node& node);
+
     bool MatchRequest(
         const Node& node,
         HttpMethod method,
-        const std::vector<std::string>& path,
+        const PathSegments& path,
         size_t path_string_length,
         MatchRequestResult& match_result
     ) const;
 
+    static bool GetFromHandlerMethodIndex(
+        const Node& node,
+        HttpMethod method,
+        const PathSegments& path,
+        MatchRequestResult& match_result,
+        bool limit_path_length
+    );
+
+    static bool GetFromHandlerMethodIndex(
+        const HandlerMethodIndex& handler_method_index,
+        HttpMethod method,
+        const PathSegments& path,
+        MatchRequestResult& match_result
+    );
+
+    bool MatchRequest(
+        const FrozenNode& node,
+        HttpMethod method,
+        const PathSegments& path,
+        size_t path_string_length,
+        MatchRequestResult& match_result
+    ) const;
+
+    std::uint32_t FindChild(const FrozenPosition& position, std::string_view segment) const;
+
+    bool GetFromHandlerMethodIndex(
+        const FrozenNode& node,
+        HttpMethod method,
+        const PathSegments& path,
+        MatchRequestResult& match_result,
+        bool limit_path_length
+    ) const;
+
     static PathItem ExtractFixedPathItem(size_t index, std::string&& path_elem);
 
     static PathItem ExtractWildcardPathItem(
@@ -63,6 +142,12 @@ private:
     );
 
     Node root_;
+
+    // Read-only copy of the tree, frozen_nodes_[0] is the root
+    std::vector<FrozenNode> frozen_nodes_;
+    std::vector<FrozenPosition> frozen_positions_;
+    std::vector<FrozenChild> frozen_children_;
+    std::vector<FrozenHandlers> frozen_handlers_;
 };
 
 }  // namespace server::http::impl
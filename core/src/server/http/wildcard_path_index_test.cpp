@@ -0,0 +1,195 @@
+#include <server/http/wildcard_path_index.hpp>
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <components/component_list_test.hpp>
+#include <userver/components/component.hpp>
+#include <userver/components/component_base.hpp>
+#include <userver/components/minimal_server_component_list.hpp>
+#include <userver/components/run.hpp>
+#include <userver/engine/run_standalone.hpp>
+#include <userver/fs/blocking/temp_directory.hpp>
+#include <userver/fs/blocking/write.hpp>
+#include <userver/internal/net/net_listener.hpp>
+#include <userver/server/handlers/ping.hpp>
+#include <userver/utest/utest.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::http::HttpMethod;
+using server::http::MatchRequestResult;
+using server::http::impl::WildcardPathIndex;
+
+// Wildcard and fixed segments overlap at the same positions of the paths
+constexpr std::string_view kStaticConfig = R"(
+components_manager:
+  coro_pool:
+    initial_size: 50
+    max_size: 500
+  default_task_processor: main-task-processor
+  event_thread_pool:
+    threads: 1
+  task_processors:
+    main-task-processor:
+      worker_threads: 1
+  components:
+    logging:
+      fs-task-processor: main-task-processor
+      loggers:
+        default:
+          file_path: '@null'
+    dynamic-config:
+      defaults: {{}}
+    server:
+      listener:
+          port: {0}
+          task_processor: main-task-processor
+    handler-id-item:
+        path: '/v1/{{id}}/item'
+        method: GET,POST
+        task_processor: main-task-processor
+    handler-fixed-name:
+        path: '/v1/fixed/{{name}}'
+        method: GET
+        task_processor: main-task-processor
+    handler-id-name:
+        path: '/v1/{{id}}/{{name}}'
+        method: GET
+        task_processor: main-task-processor
+    handler-any:
+        path: '/v1/*'
+        method: GET
+        task_processor: main-task-processor
+    handler-fixed-any:
+        path: '/v1/fixed/*'
+        method: POST
+        task_processor: main-task-processor
+    handler-x:
+        path: '/v2/{{a}}/x/{{b}}'
+        method: GET
+        task_processor: main-task-processor
+    handler-y-any:
+        path: '/v2/{{a}}/y/*'
+        method: GET
+        task_processor: main-task-processor
+)";
+
+constexpr std::array kHandlerNames{
+    "handler-id-item",
+    "handler-fixed-name",
+    "handler-id-name",
+    "handler-any",
+    "handler-fixed-any",
+    "handler-x",
+    "handler-y-any",
+};
+
+constexpr std::array kRequestPaths{
+    "",
+    "/",
+    "/v1",
+    "/v1/",
+    "/v1/42",
+    "/v1/42/item",
+    "/v1/42/item/",
+    "/v1/42/other",
+    "/v1/fixed/item",
+    "/v1/fixed/other",
+    "/v1/fixed/other/deeper",
+    "/v1/42/other/deeper",
+    "/v2/1/x/2",
+    "/v2/1/x/2/3",
+    "/v2/1/y/2/3",
+    "/v2/1/z/2",
+    "/v3/1",
+};
+
+std::uint16_t FindFreePort() {
+    std::uint16_t result{};
+    engine::RunStandalone([&result] {
+        const internal::net::TcpListener listener{};
+        result = listener.Port();
+    });
+    return result;
+}
+
+std::vector<MatchRequestResult> MatchAll(const WildcardPathIndex& index) {
+    std::vector<MatchRequestResult> results;
+    for (const auto method : {HttpMethod::kGet, HttpMethod::kPost}) {
+        for (const std::string path : kRequestPaths) {
+            auto& result = results.emplace_back();
+            index.MatchRequest(method, path, result);
+        }
+    }
+    return results;
+}
+
+// Matches the same requests against the index before and after Freeze()
+void CheckFreezeKeepsMatches(const components::ComponentContext& context) {
+    auto& task_processor = context.GetTaskProcessor("main-task-processor");
+    WildcardPathIndex index;
+    for (const std::string name : kHandlerNames) {
+        index.AddHandler(context.FindComponent<server::handlers::Ping>(name), task_processor);
+    }
+
+    const auto tree_results = MatchAll(index);
+    index.Freeze();
+    const auto frozen_results = MatchAll(index);
+
+    ASSERT_EQ(tree_results.size(), frozen_results.size());
+    std::size_t matched_count = 0;
+    for (std::size_t i = 0; i < tree_results.size(); ++i) {
+        const auto& expected = tree_results[i];
+        const auto& actual = frozen_results[i];
+        const auto* const path = kRequestPaths[i % kRequestPaths.size()];
+        EXPECT_EQ(expected.status, actual.status) << path;
+        EXPECT_EQ(expected.handler_info, actual.handler_info) << path;
+        EXPECT_EQ(expected.matched_path_length, actual.matched_path_length) << path;
+        EXPECT_EQ(expected.args_from_path, actual.args_from_path) << path;
+        if (actual.status == MatchRequestResult::Status::kOk) ++matched_count;
+    }
+    EXPECT_GT(matched_count, 0);
+
+    MatchRequestResult result;
+    ASSERT_TRUE(index.MatchRequest(HttpMethod::kGet, "/v1/42/item", result));
+    EXPECT_EQ(&result.handler_info->handler, &context.FindComponent<server::handlers::Ping>("handler-id-item"));
+    const std::vector<std::pair<std::string, std::string>> expected_args{{"id", "42"}};
+    EXPECT_EQ(result.args_from_path, expected_args);
+}
+
+class WildcardPathIndexChecker final : public components::ComponentBase {
+public:
+    static constexpr std::string_view kName = "wildcard-path-index-checker";
+
+    WildcardPathIndexChecker(const components::ComponentConfig& config, const components::ComponentContext& context)
+        : components::ComponentBase(config, context) {
+        CheckFreezeKeepsMatches(context);
+    }
+};
+
+class WildcardPathIndexTest : public ComponentList {};
+
+}  // namespace
+
+template <>
+inline constexpr auto components::kConfigFileMode<WildcardPathIndexChecker> = ConfigFileMode::kNotRequired;
+
+TEST_F(WildcardPathIndexTest, FreezeKeepsMatches) {
+    auto component_list = components::MinimalServerComponentList().Append<WildcardPathIndexChecker>();
+    for (const std::string name : kHandlerNames) {
+        component_list.Append<server::handlers::Ping>(name);
+    }
+
+    components::RunOnce(
+        components::InMemoryConfig{fmt::format(kStaticConfig, FindFreePort())}, std::move(component_list)
+    );
+}
+
+USERVER_NAMESPACE_END
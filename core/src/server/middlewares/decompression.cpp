@@ -34,7 +34,8 @@ void Decompression::HandleRequest(http::HttpRequest& request, request::RequestCo
 }
 
 bool Decompression::DecompressRequestBody(http::HttpRequest& request) const {
-    if (!decompress_request_ || !request.IsBodyCompressed()) {
+    // The chunks of a streamed body are passed to the handler as is
+    if (!decompress_request_ || request.IsBodyStreamed() || !request.IsBodyCompressed()) {
         return true;
     }
 
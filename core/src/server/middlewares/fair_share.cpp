@@ -0,0 +1,179 @@
+#include <server/middlewares/fair_share.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#include <userver/engine/io/sockaddr.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+namespace {
+
+// Power of 2. Enough for the clients of a handler to rarely share a slot,
+// while the counters of all the slots take 16KiB
+constexpr std::size_t kSlotsCount = 256;
+
+constexpr std::uint64_t kCountMask = 0xffffffff;
+
+// Weights are summed up in the lower 32 bits of the counters as fixed point
+// numbers, the sum of all the slots must fit there
+constexpr double kWeightScale = 1024;
+constexpr std::uint64_t kMaxSlotWeight = kCountMask / kSlotsCount;
+
+std::uint64_t ToFixedWeight(double weight) noexcept {
+    const auto scaled = std::clamp(weight * kWeightScale, 1.0, static_cast<double>(kMaxSlotWeight));
+    return static_cast<std::uint64_t>(scaled);
+}
+
+std::uint32_t ToSecond(FairShare::Clock::time_point now) noexcept {
+    return static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count());
+}
+
+std::uint64_t GetWindowCount(const std::atomic<std::uint64_t>& window, std::uint32_t second) noexcept {
+    const auto value = window.load(std::memory_order_relaxed);
+    return (value >> 32) == second ? (value & kCountMask) : 0;
+}
+
+// Returns the new count within the second
+std::uint64_t
+AddToWindow(std::atomic<std::uint64_t>& window, std::uint32_t second, std::uint64_t amount = 1) noexcept {
+    auto value = window.load(std::memory_order_relaxed);
+    while (true) {
+        const auto count = (value >> 32) == second ? (value & kCountMask) + amount : amount;
+        if (window.compare_exchange_weak(
+                value, (std::uint64_t{second} << 32) | count, std::memory_order_relaxed, std::memory_order_relaxed
+            )) {
+            return count;
+        }
+    }
+}
+
+// The share of the client is weight / sum_of_active_weights * limit
+bool IsOverShare(std::uint64_t used, std::uint64_t weight, std::size_t limit, std::int64_t active_weight) noexcept {
+    auto weight_sum = static_cast<std::uint64_t>(std::max<std::int64_t>(active_weight, 0));
+    // The slot of the client is not active yet
+    if (used == 0) weight_sum += weight;
+    weight_sum = std::max(weight_sum, weight);
+
+    const double share = static_cast<double>(weight) / static_cast<double>(weight_sum) * static_cast<double>(limit);
+    return static_cast<double>(used + 1) > std::max(share, 1.0);
+}
+
+}  // namespace
+
+FairShare::InFlightScope::InFlightScope(InFlightScope&& other) noexcept
+    : owner_(std::exchange(other.owner_, nullptr)), slot_(other.slot_) {}
+
+FairShare::InFlightScope::~InFlightScope() {
+    if (owner_) owner_->Release(slot_);
+}
+
+FairShare::FairShare(
+    const handlers::FairShareConfig& config,
+    std::optional<std::size_t> max_requests_per_second,
+    std::optional<std::size_t> max_requests_in_flight
+)
+    : client_key_(config.client_key),
+      header_(config.header),
+      weights_(config.weights.begin(), config.weights.end()),
+      max_requests_per_second_(max_requests_per_second),
+      max_requests_in_flight_(max_requests_in_flight),
+      slots_(kSlotsCount) {
+    const auto shed_threshold_percent = config.shed_threshold_percent;
+    if (max_requests_per_second_) {
+        // The token bucket is full without the load
+        rate_shed_tokens_ = *max_requests_per_second_ * (100 - shed_threshold_percent) / 100;
+    }
+    if (max_requests_in_flight_) {
+        in_flight_shed_threshold_ = *max_requests_in_flight_ * shed_threshold_percent / 100;
+    }
+}
+
+FairShare::Client FairShare::GetClient(const http::HttpRequest& request) const {
+    if (client_key_ == handlers::FairShareConfig::ClientKey::kRemoteAddress) {
+        return GetClient(request.GetRemoteAddress().PrimaryAddressString());
+    }
+    return GetClient(request.GetHeader(header_));
+}
+
+FairShare::Client FairShare::GetClient(std::string_view client_id) const {
+    Client client;
+    client.slot = hash_(client_id) & (kSlotsCount - 1);
+    if (!weights_.empty()) {
+        const auto* weight = utils::impl::FindTransparentOrNullptr(weights_, client_id);
+        if (weight) client.weight = *weight;
+    }
+    return client;
+}
+
+FairShare::Verdict
+FairShare::Check(const Client& client, std::size_t rate_tokens_left, Clock::time_point now) const noexcept {
+    const auto& slot = *slots_[client.slot];
+    const auto weight = ToFixedWeight(client.weight);
+
+    if (max_requests_in_flight_ && total_in_flight_->load(std::memory_order_relaxed) >= in_flight_shed_threshold_) {
+        const auto used = slot.in_flight.load(std::memory_order_relaxed) & kCountMask;
+        const auto active_weight = active_in_flight_weight_->load(std::memory_order_relaxed);
+        if (IsOverShare(used, weight, *max_requests_in_flight_, active_weight)) {
+            return Verdict::kOverInFlightShare;
+        }
+    }
+
+    if (max_requests_per_second_ && rate_tokens_left <= rate_shed_tokens_) {
+        const auto second = ToSecond(now);
+        const auto used = GetWindowCount(slot.window, second);
+        const auto active_weight = static_cast<std::int64_t>(GetWindowCount(*active_rate_weight_, second));
+        if (IsOverShare(used, weight, *max_requests_per_second_, active_weight)) {
+            return Verdict::kOverRateShare;
+        }
+    }
+
+    return Verdict::kAdmit;
+}
+
+FairShare::InFlightScope FairShare::Admit(const Client& client, Clock::time_point now) noexcept {
+    auto& slot = *slots_[client.slot];
+    const auto weight = ToFixedWeight(client.weight);
+
+    auto in_flight = slot.in_flight.load(std::memory_order_relaxed);
+    while (!slot.in_flight.compare_exchange_weak(
+        in_flight,
+        (in_flight & kCountMask) == 0 ? (weight << 32) | 1 : in_flight + 1,
+        std::memory_order_relaxed,
+        std::memory_order_relaxed
+    )) {
+    }
+    if ((in_flight & kCountMask) == 0) {
+        active_in_flight_weight_->fetch_add(static_cast<std::int64_t>(weight), std::memory_order_relaxed);
+    }
+    total_in_flight_->fetch_add(1, std::memory_order_relaxed);
+
+    if (max_requests_per_second_) {
+        const auto second = ToSecond(now);
+        if (AddToWindow(slot.window, second) == 1) AddToWindow(*active_rate_weight_, second, weight);
+    }
+
+    return InFlightScope{*this, client.slot};
+}
+
+void FairShare::Release(std::size_t slot) noexcept {
+    total_in_flight_->fetch_sub(1, std::memory_order_relaxed);
+
+    // The weight that made the slot active is the one to subtract
+    auto& in_flight = slots_[slot]->in_flight;
+    auto value = in_flight.load(std::memory_order_relaxed);
+    while (!in_flight.compare_exchange_weak(
+        value, (value & kCountMask) == 1 ? 0 : value - 1, std::memory_order_relaxed, std::memory_order_relaxed
+    )) {
+    }
+    if ((value & kCountMask) == 1) {
+        active_in_flight_weight_->fetch_sub(static_cast<std::int64_t>(value >> 32), std::memory_order_relaxed);
+    }
+}
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
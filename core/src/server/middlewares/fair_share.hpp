@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <userver/concurrent/impl/interference_shield.hpp>
+#include <userver/server/handlers/handler_config.hpp>
+#include <userver/server/http/http_request.hpp>
+#include <userver/utils/datetime/steady_coarse_clock.hpp>
+#include <userver/utils/impl/transparent_hash.hpp>
+#include <userver/utils/str_icase.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::middlewares {
+
+/// @brief Per-client accounting for the weighted fair admission of RateLimit.
+///
+/// Clients are hashed into a fixed number of slots with atomic counters, so
+/// the state takes constant memory and is updated without locks. Clients
+/// sharing a slot share its quota, as in stochastic fair queueing.
+///
+/// Once the load of the handler exceeds the shed threshold of a limit, the
+/// limit is split between the active clients proportionally to their weights,
+/// and requests of the clients above their shares are rejected. The clients
+/// below their shares are still admitted up to the limit itself.
+class FairShare final {
+public:
+    using Clock = utils::datetime::SteadyCoarseClock;
+
+    struct Client final {
+        std::size_t slot{0};
+        double weight{1.0};
+    };
+
+    enum class Verdict {
+        kAdmit,
+        kOverRateShare,
+        kOverInFlightShare,
+    };
+
+    class InFlightScope final {
+    public:
+        InFlightScope(InFlightScope&& other) noexcept;
+        InFlightScope& operator=(InFlightScope&&) = delete;
+        ~InFlightScope();
+
+    private:
+        friend class FairShare;
+
+        InFlightScope(FairShare& owner, std::size_t slot) noexcept : owner_(&owner), slot_(slot) {}
+
+        FairShare* owner_;
+        const std::size_t slot_;
+    };
+
+    FairShare(
+        const handlers::FairShareConfig& config,
+        std::optional<std::size_t> max_requests_per_second,
+        std::optional<std::size_t> max_requests_in_flight
+    );
+
+    Client GetClient(const http::HttpRequest& request) const;
+
+    Client GetClient(std::string_view client_id) const;
+
+    /// `rate_tokens_left` is the number of tokens left in the token bucket of
+    /// `max_requests_per_second`
+    Verdict Check(const Client& client, std::size_t rate_tokens_left, Clock::time_point now) const noexcept;
+
+    /// Accounts a request of the client as admitted until the scope ends
+    [[nodiscard]] InFlightScope Admit(const Client& client, Clock::time_point now) noexcept;
+
+private:
+    struct Slot final {
+        // weight << 32 | requests in flight, the weight is the one of the
+        // client that made the slot active
+        std::atomic<std::uint64_t> in_flight{0};
+        // second << 32 | admitted requests in that second
+        std::atomic<std::uint64_t> window{0};
+    };
+
+    void Release(std::size_t slot) noexcept;
+
+    const handlers::FairShareConfig::ClientKey client_key_;
+    const std::string header_;
+    const utils::impl::TransparentMap<std::string, double> weights_;
+    const utils::StrCaseHash hash_;
+
+    const std::optional<std::size_t> max_requests_per_second_;
+    const std::optional<std::size_t> max_requests_in_flight_;
+    std::size_t rate_shed_tokens_{0};
+    std::size_t in_flight_shed_threshold_{0};
+
+    std::vector<concurrent::impl::InterferenceShield<Slot>> slots_;
+    concurrent::impl::InterferenceShield<std::atomic<std::size_t>> total_in_flight_{0};
+    // Sum of the weights of the slots with requests in flight, transiently
+    // negative as a slot may be released before its activation is accounted
+    concurrent::impl::InterferenceShield<std::atomic<std::int64_t>> active_in_flight_weight_{0};
+    // second << 32 | sum of the weights of the slots with admitted requests
+    // in that second
+    concurrent::impl::InterferenceShield<std::atomic<std::uint64_t>> active_rate_weight_{0};
+};
+
+}  // namespace server::middlewares
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,124 @@
+#include <server/middlewares/fair_share.hpp>
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::middlewares::FairShare;
+
+server::handlers::FairShareConfig MakeConfig() {
+    server::handlers::FairShareConfig config;
+    config.header = "X-Client-Id";
+    config.shed_threshold_percent = 50;
+    return config;
+}
+
+// Clients sharing a slot share the quota, the tests need distinct slots
+std::string GetClientIdInOtherSlot(const FairShare& fair_share, const FairShare::Client& client) {
+    for (int i = 0;; ++i) {
+        auto client_id = "light-" + std::to_string(i);
+        if (fair_share.GetClient(client_id).slot != client.slot) return client_id;
+    }
+}
+
+}  // namespace
+
+TEST(FairShare, InFlightShare) {
+    FairShare fair_share{MakeConfig(), std::nullopt, 10};
+    const auto now = FairShare::Clock::now();
+
+    const auto heavy = fair_share.GetClient("heavy");
+    const auto light = fair_share.GetClient(GetClientIdInOtherSlot(fair_share, heavy));
+
+    // A single client may take the whole limit
+    std::vector<std::unique_ptr<FairShare::InFlightScope>> scopes;
+    for (int i = 0; i < 6; ++i) {
+        ASSERT_EQ(fair_share.Check(heavy, 0, now), FairShare::Verdict::kAdmit) << i;
+        scopes.push_back(std::make_unique<FairShare::InFlightScope>(fair_share.Admit(heavy, now)));
+    }
+
+    ASSERT_EQ(fair_share.Check(light, 0, now), FairShare::Verdict::kAdmit);
+    const auto light_scope = fair_share.Admit(light, now);
+
+    // Above the shed threshold the heavy client is over its half of the limit
+    EXPECT_EQ(fair_share.Check(heavy, 0, now), FairShare::Verdict::kOverInFlightShare);
+    EXPECT_EQ(fair_share.Check(light, 0, now), FairShare::Verdict::kAdmit);
+
+    scopes.resize(4);
+    EXPECT_EQ(fair_share.Check(heavy, 0, now), FairShare::Verdict::kAdmit);
+}
+
+TEST(FairShare, Weights) {
+    auto config = MakeConfig();
+    config.weights["vip"] = 3;
+    FairShare fair_share{config, std::nullopt, 8};
+    const auto now = FairShare::Clock::now();
+
+    const auto vip = fair_share.GetClient("vip");
+    const auto other = fair_share.GetClient(GetClientIdInOtherSlot(fair_share, vip));
+    EXPECT_DOUBLE_EQ(vip.weight, 3);
+    EXPECT_DOUBLE_EQ(other.weight, 1);
+
+    const auto other_scope = fair_share.Admit(other, now);
+    std::vector<std::unique_ptr<FairShare::InFlightScope>> scopes;
+    // The share of the vip client is 3 / (3 + 1) of the limit
+    for (int i = 0; i < 6; ++i) {
+        ASSERT_EQ(fair_share.Check(vip, 0, now), FairShare::Verdict::kAdmit) << i;
+        scopes.push_back(std::make_unique<FairShare::InFlightScope>(fair_share.Admit(vip, now)));
+    }
+    EXPECT_EQ(fair_share.Check(vip, 0, now), FairShare::Verdict::kOverInFlightShare);
+    // The share of the other client is 1 / (3 + 1) of the limit
+    EXPECT_EQ(fair_share.Check(other, 0, now), FairShare::Verdict::kAdmit);
+    const auto other_scope2 = fair_share.Admit(other, now);
+    EXPECT_EQ(fair_share.Check(other, 0, now), FairShare::Verdict::kOverInFlightShare);
+}
+
+TEST(FairShare, RateWeights) {
+    auto config = MakeConfig();
+    config.weights["vip"] = 3;
+    FairShare fair_share{config, 100, std::nullopt};
+    const auto now = FairShare::Clock::now();
+
+    const auto vip = fair_share.GetClient("vip");
+    const auto other = fair_share.GetClient(GetClientIdInOtherSlot(fair_share, vip));
+
+    [[maybe_unused]] const auto other_scope = fair_share.Admit(other, now);
+    // The share of the vip client is 3 / (3 + 1) of the limit
+    for (int i = 0; i < 75; ++i) {
+        ASSERT_EQ(fair_share.Check(vip, 10, now), FairShare::Verdict::kAdmit) << i;
+        [[maybe_unused]] const auto scope = fair_share.Admit(vip, now);
+    }
+    EXPECT_EQ(fair_share.Check(vip, 10, now), FairShare::Verdict::kOverRateShare);
+    EXPECT_EQ(fair_share.Check(other, 10, now), FairShare::Verdict::kAdmit);
+}
+
+TEST(FairShare, RateShare) {
+    FairShare fair_share{MakeConfig(), 100, std::nullopt};
+    const auto now = FairShare::Clock::now();
+
+    const auto heavy = fair_share.GetClient("heavy");
+    const auto light = fair_share.GetClient(GetClientIdInOtherSlot(fair_share, heavy));
+
+    for (int i = 0; i < 60; ++i) {
+        ASSERT_EQ(fair_share.Check(heavy, 100, now), FairShare::Verdict::kAdmit) << i;
+        [[maybe_unused]] const auto scope = fair_share.Admit(heavy, now);
+    }
+    [[maybe_unused]] const auto light_scope = fair_share.Admit(light, now);
+
+    // Plenty of tokens left, nobody is shed
+    EXPECT_EQ(fair_share.Check(heavy, 60, now), FairShare::Verdict::kAdmit);
+
+    // The token bucket is mostly drained
+    EXPECT_EQ(fair_share.Check(heavy, 10, now), FairShare::Verdict::kOverRateShare);
+    EXPECT_EQ(fair_share.Check(light, 10, now), FairShare::Verdict::kAdmit);
+
+    // The next second starts from scratch
+    EXPECT_EQ(fair_share.Check(heavy, 10, now + std::chrono::seconds{1}), FairShare::Verdict::kAdmit);
+}
+
+USERVER_NAMESPACE_END
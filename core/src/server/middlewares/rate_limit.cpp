@@ -23,10 +23,25 @@ RateLimit::RateLimit(const handlers::HttpHandlerBase& handler)
         rate_limit_.SetMaxSize(max_rps);
         rate_limit_.SetRefillPolicy({1, utils::TokenBucket::Duration{std::chrono::seconds(1)} / max_rps});
     }
+
+    const auto& fair_share_config = handler.GetConfig().fair_share;
+    if (fair_share_config && (max_requests_per_second_ || max_requests_in_flight_)) {
+        fair_share_ = std::make_unique<FairShare>(*fair_share_config, max_requests_per_second_, max_requests_in_flight_);
+    }
 }
 
 void RateLimit::HandleRequest(http::HttpRequest& request, request::RequestContext& context) const {
-    if (CheckRateLimit(request)) {
+    if (!fair_share_) {
+        if (CheckRateLimit(request)) {
+            Next(request, context);
+        }
+        return;
+    }
+
+    const auto client = fair_share_->GetClient(request);
+    const auto now = FairShare::Clock::now();
+    if (CheckFairShare(request, client, now) && CheckRateLimit(request)) {
+        const auto in_flight_scope = fair_share_->Admit(client, now);
         Next(request, context);
     }
 }
@@ -69,6 +84,34 @@ bool RateLimit::CheckRateLimit(const http::HttpRequest& request) const {
     return true;
 }
 
+bool RateLimit::CheckFairShare(
+    const http::HttpRequest& request,
+    const FairShare::Client& client,
+    FairShare::Clock::time_point now
+) const {
+    const auto rate_tokens_left = max_requests_per_second_ ? rate_limit_.GetTokensApprox() : 0;
+    const auto verdict = fair_share_->Check(client, rate_tokens_left, now);
+    if (verdict == FairShare::Verdict::kAdmit) return true;
+
+    auto& statistics = statistics_.ForMethod(request.GetMethod());
+    std::string log_reason;
+    if (verdict == FairShare::Verdict::kOverRateShare) {
+        log_reason = fmt::format("client exceeded its share of max_requests_per_second={}", *max_requests_per_second_);
+        statistics.IncrementRateLimitReached();
+    } else {
+        log_reason = fmt::format("client exceeded its share of max_requests_in_flight={}", *max_requests_in_flight_);
+        statistics.IncrementTooManyRequestsInFlight();
+    }
+    SetThrottleReason(
+        request.GetHttpResponse(),
+        std::move(log_reason),
+        std::string{USERVER_NAMESPACE::http::headers::ratelimit_reason::kFairShare}
+    );
+
+    FailProcessingAndSetResponse(request);
+    return false;
+}
+
 void RateLimit::FailProcessingAndSetResponse(const http::HttpRequest& request) const {
     const auto ex = handlers::ExceptionWithCode<handlers::HandlerErrorCode::kTooManyRequests>{};
     handler_.HandleCustomHandlerException(request, ex);
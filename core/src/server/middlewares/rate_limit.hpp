@@ -1,11 +1,14 @@
 #pragma once
 
+#include <memory>
 #include <optional>
 
 #include <userver/server/middlewares/builtin.hpp>
 #include <userver/server/middlewares/http_middleware_base.hpp>
 #include <userver/utils/token_bucket.hpp>
 
+#include <server/middlewares/fair_share.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::handlers {
@@ -25,6 +28,12 @@ private:
 
     bool CheckRateLimit(const http::HttpRequest& request) const;
 
+    bool CheckFairShare(
+        const http::HttpRequest& request,
+        const FairShare::Client& client,
+        FairShare::Clock::time_point now
+    ) const;
+
     void FailProcessingAndSetResponse(const http::HttpRequest& request) const;
 
     mutable utils::TokenBucket rate_limit_;
@@ -32,6 +41,8 @@ private:
 
     std::optional<std::size_t> max_requests_per_second_;
     std::optional<std::size_t> max_requests_in_flight_;
+    // nullptr unless the fair_share option is set
+    std::unique_ptr<FairShare> fair_share_;
 
     const handlers::HttpHandlerBase& handler_;
 };
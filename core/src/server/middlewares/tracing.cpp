@@ -143,7 +143,7 @@ void Tracing::EnrichLogs(
             }
             span.AddNonInheritableTag(
                 std::string{kTracingBody},
-                handler_.GetResponseDataForLoggingChecked(request, context, response.GetData())
+                handler_.GetResponseDataForLoggingChecked(request, context, std::string{response.GetBodyData()})
             );
         }
         span.AddNonInheritableTag(std::string{kTracingUri}, request.GetUrl());
@@ -1,5 +1,6 @@
 #include "connection.hpp"
 
+#include <algorithm>
 #include <array>
 #include <system_error>
 #include <vector>
@@ -30,6 +31,26 @@ namespace server::net {
 namespace {
 constexpr std::string_view kHttp2Preface = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
 constexpr std::string_view kPrefaceBegin = kHttp2Preface.substr(0, 2);
+
+// Larger batches gain nothing, as the syscall cost is negligible compared to
+// the copying of the data into the kernel
+constexpr std::size_t kMaxResponseBatchBytes = 64 * 1024;
+// Each response takes up to 2 iovecs, see IOV_MAX
+constexpr std::size_t kMaxResponseBatchSize = 64;
+
+// Safe methods do not change the state of the server, see RFC 9110, 9.2.1
+bool IsSafeMethod(const http::HttpRequest& request) {
+    switch (request.GetMethod()) {
+        case http::HttpMethod::kGet:
+        case http::HttpMethod::kHead:
+        case http::HttpMethod::kOptions:
+            return true;
+        case http::HttpMethod::kUnknown:
+            return request.GetMethodStr() == "TRACE";
+        default:
+            return false;
+    }
+}
 }  // namespace
 
 Connection::Connection(
@@ -97,15 +118,24 @@ void Connection::ListenForRequests() noexcept {
         while (is_accepting_requests_) {
             auto deadline = engine::Deadline::FromDuration(config_.keepalive_timeout);
 
-            if (pending_data_size_ == 0) {
-                if (!WaitOnSocket(deadline)) {
-                    return;
+            std::string_view req{pending_data_.data(), pending_data_size_};
+            if (req.empty() && !(parser_ && parser_->HasUnparsedData())) {
+                if (const auto body_buffer = GetBodyReadBuffer(); !body_buffer.empty()) {
+                    const auto received = ReadBody(body_buffer, deadline);
+                    if (!received) {
+                        return;
+                    }
+                    req = {body_buffer.data(), received};
+                } else {
+                    if (!WaitOnSocket(deadline)) {
+                        return;
+                    }
+                    req = {pending_data_.data(), pending_data_size_};
                 }
             }
 
             bool should_stop_accepting_requests = false;
             bool res = false;
-            const std::string_view req{pending_data_.data(), pending_data_size_};
             if (config_.http_version == HttpVersion::k2) {
                 if (parser_ || TryDetectHttpVersion(http_version_buffer, req)) {
                     res = parser_->Parse(req);
@@ -124,10 +154,15 @@ void Connection::ListenForRequests() noexcept {
             }
             pending_data_size_ = 0;
 
-            for (auto&& request : pending_requests_) {
-                ProcessRequest(std::move(request));
+            for (std::size_t i = 0; i < pending_requests_.size(); ++i) {
+                StartRequestTasks(i);
+                // Receiving a streamed body parses the following requests into
+                // pending_requests_, so the request is moved out beforehand
+                auto request = std::move(pending_requests_[i]);
+                ProcessRequest(std::move(request), std::move(request_tasks_[i]), i + 1 == pending_requests_.size());
             }
             pending_requests_.resize(0);
+            request_tasks_.clear();
             if (should_stop_accepting_requests) is_accepting_requests_ = false;
         }
 
@@ -203,14 +238,84 @@ bool Connection::WaitOnSocket(engine::Deadline deadline) {
     return true;
 }
 
-void Connection::ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr) {
+utils::span<char> Connection::GetBodyReadBuffer() noexcept {
+    if (!parser_ || is_http2_parser_) return {};
+
+    // The buffer holds exactly the rest of the body, so the pipelined requests
+    // are never read into it. Small remainders are read into pending_data_
+    // along with the next requests to save on syscalls.
+    const auto buffer = parser_->GetBodyReadBuffer();
+    if (buffer.size() < pending_data_.size()) return {};
+    return buffer;
+}
+
+size_t Connection::ReadBody(utils::span<char> buffer, engine::Deadline deadline) {
+    const auto received = peer_socket_->ReadSome(buffer.data(), buffer.size(), deadline);
+    if (!received) {
+        LOG_TRACE() << "Peer " << Getpeername() << " on fd " << Fd()
+                    << " closed connection or the connection timed out";
+        return 0;
+    }
+    LOG_TRACE() << "Received " << received << " byte(s) of request body from " << Getpeername() << " on fd " << Fd();
+    return received;
+}
+
+void Connection::StartRequestTasks(std::size_t current_pending) {
+    // Handlers of the pipelined requests run concurrently, while the responses
+    // are sent in order. With HTTP/1.x only the requests of safe methods are
+    // handled ahead, any other request is handled after the responses before it
+    // are sent (RFC 9112, 9.3.2). HTTP/2 streams are independent.
+    auto& current = *pending_requests_[current_pending];
+    const bool is_started = current_pending < request_tasks_.size() && request_tasks_[current_pending].IsValid();
+    if (!is_started && !is_http2_parser_ && !IsSafeMethod(current)) {
+        FlushResponseBatch();
+        if (!is_response_chain_valid_) {
+            // The client gets no response, so the handler must not change anything
+            auto& response = current.GetHttpResponse();
+            if (!response.IsReady()) {
+                response.SetReady();
+                response.SetStatusServiceUnavailable();
+            }
+        }
+    }
+    StartRequestTask(current_pending);
+
+    const auto max_ahead = std::max<std::size_t>(config_.requests_queue_size_threshold, 1);
+    const auto tasks_count = std::min(pending_requests_.size(), current_pending + max_ahead);
+    for (auto i = current_pending; i < tasks_count; ++i) {
+        if (!is_http2_parser_ && !IsSafeMethod(*pending_requests_[i])) break;
+        StartRequestTask(i);
+    }
+}
+
+void Connection::StartRequestTask(std::size_t pending) {
+    if (request_tasks_.size() <= pending) request_tasks_.resize(pending + 1);
+    auto& task = request_tasks_[pending];
+    if (task.IsValid()) return;
+
+    stats_->active_request_count.Add(1);
+    task = request_handler_.StartRequestTask(pending_requests_[pending]);
+}
+
+void Connection::ProcessRequest(
+    std::shared_ptr<http::HttpRequest>&& request_ptr,
+    engine::TaskWithResult<void> request_task,
+    bool is_last_pending
+) {
     if (request_ptr->IsFinal()) {
         is_accepting_requests_ = false;
     }
 
-    stats_->active_request_count.Add(1);
+    auto task = HandleQueueItem(request_ptr, std::move(request_task));
+    if (TryBatchResponse(request_ptr)) {
+        if (is_last_pending || response_batch_.GetResponsesCount() >= kMaxResponseBatchSize ||
+            response_batch_.GetBytesCount() >= kMaxResponseBatchBytes) {
+            FlushResponseBatch();
+        }
+        return;
+    }
 
-    auto task = HandleQueueItem(request_ptr);
+    FlushResponseBatch();
     SendResponse(*request_ptr);
 
     if (request_ptr->IsUpgradeWebsocket()) request_ptr->DoUpgrade(std::move(peer_socket_), std::move(remote_address_));
@@ -239,12 +344,61 @@ bool Connection::ReadSome() {
     return true;
 }
 
-engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<http::HttpRequest>& request) noexcept {
-    auto request_task = request_handler_.StartRequestTask(request);
+void Connection::ReceiveStreamedBody(const http::HttpRequest& request, engine::TaskWithResult<void>& request_task) {
+    engine::io::ReadableBase& peer_read = *peer_socket_;
+    while (!request.IsBodyStreamReceived() && !request_task.IsFinished()) {
+        if (pending_data_size_ == 0 && !parser_->HasUnparsedData()) {
+            if (is_http2_parser_) {
+                // The client sends the rest of the body once the stream window
+                // is updated, as the handler reads the chunks
+                if (!WaitForHttp2StreamingEvents(request_task)) return;
+            } else if (engine::WaitAny(peer_read, request_task) != 0) {
+                return;
+            }
+            if (!ReadSome()) {
+                // TCP connection is closed, cancel the user task
+                LOG_DEBUG() << "Cancelling request due to closed socket";
+                request_task.RequestCancel();
+                return;
+            }
+            if (pending_data_size_ == 0) continue;
+        }
+
+        // The HTTP/1.1 parser blocks while the handler lags behind in reading
+        // the body, HTTP/2 relies on the stream flow control window instead
+        const std::string_view data{pending_data_.data(), pending_data_size_};
+        pending_data_size_ = 0;
+        if (!parser_->Parse(data)) {
+            LOG_DEBUG() << "Malformed request from " << Getpeername() << " on fd " << Fd();
+            is_accepting_requests_ = false;
+            return;
+        }
+    }
+}
+
+bool Connection::WaitForHttp2StreamingEvents(engine::TaskWithResult<void>& request_task) {
+    UASSERT(dynamic_cast<http::Http2Session*>(parser_.get()));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    auto* session = static_cast<http::Http2Session*>(parser_.get());
+    auto& streaming_event = session->GetStreamingEvent();
+    engine::io::ReadableBase& peer_read = *peer_socket_;
+    while (true) {
+        auto notified_event = engine::CriticalAsyncNoSpan([&streaming_event] {
+            [[maybe_unused]] const auto res = streaming_event.WaitForEvent();
+        });
+        const auto index = engine::WaitAny(peer_read, request_task, notified_event);
+        if (index != 2) return index == 0;
+        session->HandleStreamingEvents();
+    }
+}
 
+engine::TaskWithResult<void> Connection::HandleQueueItem(
+    const std::shared_ptr<http::HttpRequest>& request,
+    engine::TaskWithResult<void> request_task
+) noexcept {
     if (engine::current_task::IsCancelRequested()) {
-        // We could've packed all remaining requests into a vector and cancel them
-        // in parallel. But pipelining is almost never used so why bother.
+        // The tasks of the remaining pipelined requests are cancelled one by one
+        // by the following calls. Pipelining is almost never used so why bother.
         request_task.SyncCancel();
         LOG_DEBUG() << "Request processing interrupted";
         is_response_chain_valid_ = false;
@@ -252,8 +406,16 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<h
     }
 
     try {
+        if (request->IsBodyStreamed() && !request->IsBodyStreamReceived()) {
+            // Do not delay the previous responses while the body is received
+            FlushResponseBatch();
+            ReceiveStreamedBody(*request, request_task);
+        }
+
         auto& response = request->GetHttpResponse();
         if (response.IsBodyStreamed()) {
+            // Do not delay the previous responses while the body is produced
+            FlushResponseBatch();
             // TODO: wait for TCP connection closure too
             response.WaitForHeadersEnd();
         } else {
@@ -270,7 +432,9 @@ engine::TaskWithResult<void> Connection::HandleQueueItem(const std::shared_ptr<h
 
             request_task.WaitFor(config_.abort_check_delay);
             if (!request_task.IsFinished()) {
-                // Slow path for not-so-fast handlers
+                // Slow path for not-so-fast handlers. Do not delay the previous
+                // responses until this one is ready.
+                FlushResponseBatch();
                 engine::io::ReadableBase& peer_read = *peer_socket_;
                 const auto task_num = engine::WaitAny(peer_read, request_task);
 
@@ -355,16 +519,62 @@ void Connection::SendResponse(http::HttpRequest& request) {
                                                                                            : logging::Level::kError;
             LOG(log_level) << "I/O error while sending data: " << ex;
             response.SetSendFailed(std::chrono::steady_clock::now());
+            is_response_chain_valid_ = false;
         } catch (const std::exception& ex) {
             LOG_ERROR() << "Error while sending data: " << ex;
             response.SetSendFailed(std::chrono::steady_clock::now());
+            is_response_chain_valid_ = false;
         }
     } else {
         response.SetSendFailed(std::chrono::steady_clock::now());
     }
+    FinishResponse(request);
+}
+
+bool Connection::TryBatchResponse(const std::shared_ptr<http::HttpRequest>& request) {
+    // HTTP/2 has its own framing, upgrades take over the socket
+    if (config_.http_version == USERVER_NAMESPACE::http::HttpVersion::k2 || !is_response_chain_valid_ ||
+        !peer_socket_ || request->IsUpgradeWebsocket()) {
+        return false;
+    }
+
+    UASSERT(!request->GetHttpResponse().IsSent());
+    request->SetStartSendResponseTime();
+    if (!response_batch_.Append(request->GetHttpResponse())) return false;
+    batched_requests_.push_back(request);
+    return true;
+}
+
+void Connection::FlushResponseBatch() {
+    if (batched_requests_.empty()) return;
+
+    if (is_response_chain_valid_ && peer_socket_) {
+        try {
+            response_batch_.Flush(*peer_socket_);
+        } catch (const std::exception& ex) {
+            // the responses are marked as failed by Flush()
+            LOG_WARNING() << "Error while sending " << batched_requests_.size() << " pipelined responses: " << ex;
+            is_response_chain_valid_ = false;
+        }
+    } else {
+        response_batch_.SetSendFailed();
+    }
+    for (auto& request : batched_requests_) {
+        FinishResponse(*request);
+    }
+    batched_requests_.clear();
+}
+
+void Connection::FinishResponse(http::HttpRequest& request) {
     request.SetFinishSendResponseTime();
     stats_->active_request_count.Subtract(1);
     stats_->requests_processed_count.Add(1);
+    // The response of a request cancelled before its handler ran is never
+    // ready and has no ready time
+    if (request.GetHttpResponse().IsReady()) {
+        const auto processing_time = std::chrono::duration_cast<std::chrono::microseconds>(request.GetResponseTime());
+        if (processing_time.count() > 0) stats_->requests_processing_time_us.Add(processing_time.count());
+    }
 
     request.WriteAccessLogs(request_handler_.LoggerAccess(), request_handler_.LoggerAccessTskv(), peer_name_);
 }
@@ -384,7 +594,8 @@ std::unique_ptr<request::RequestParser> Connection::MakeParser(USERVER_NAMESPACE
             stats_->parser_stats,
             data_accounter_,
             remote_address_,
-            peer_socket_.get()
+            peer_socket_.get(),
+            &request_handler_
         );
     }
     return std::make_unique<http::HttpRequestParser>(
@@ -393,7 +604,8 @@ std::unique_ptr<request::RequestParser> Connection::MakeParser(USERVER_NAMESPACE
         on_req_cb,
         stats_->parser_stats,
         data_accounter_,
-        remote_address_
+        remote_address_,
+        &request_handler_
     );
 }
 
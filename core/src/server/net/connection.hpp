@@ -10,10 +10,12 @@
 // TODO: use fwd
 #include <server/http/http2_session.hpp>
 #include <server/http/http_request_parser.hpp>
+#include <server/http/http_response_batch.hpp>
 //
 #include <userver/engine/io/socket.hpp>
 #include <userver/server/http/http_request.hpp>
 #include <userver/server/request/request_config.hpp>
+#include <userver/utils/span.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -45,11 +47,38 @@ private:
     bool IsRequestTasksEmpty() const noexcept;
 
     void ListenForRequests() noexcept;
-    void ProcessRequest(std::shared_ptr<http::HttpRequest>&& request_ptr);
+    // Starts the handler of the current request and the handlers of up to
+    // requests_queue_size_threshold following requests of safe methods
+    void StartRequestTasks(std::size_t current_pending);
+    // Starts the handler of the pending request unless it is already started
+    void StartRequestTask(std::size_t pending);
+    void ProcessRequest(
+        std::shared_ptr<http::HttpRequest>&& request_ptr,
+        engine::TaskWithResult<void> request_task,
+        bool is_last_pending
+    );
     bool WaitOnSocket(engine::Deadline deadline);
-
-    engine::TaskWithResult<void> HandleQueueItem(const std::shared_ptr<http::HttpRequest>& request) noexcept;
+    // Reads the request body right into the request being parsed, avoiding
+    // a copy from pending_data_
+    utils::span<char> GetBodyReadBuffer() noexcept;
+    size_t ReadBody(utils::span<char> buffer, engine::Deadline deadline);
+
+    // Keeps parsing the socket data while the handler reads the request body,
+    // see HttpRequest::GetBodyStream()
+    void ReceiveStreamedBody(const http::HttpRequest& request, engine::TaskWithResult<void>& request_task);
+    // Handles the HTTP/2 streaming events until the socket is readable (true)
+    // or the request task is finished (false)
+    bool WaitForHttp2StreamingEvents(engine::TaskWithResult<void>& request_task);
+    engine::TaskWithResult<void> HandleQueueItem(
+        const std::shared_ptr<http::HttpRequest>& request,
+        engine::TaskWithResult<void> request_task
+    ) noexcept;
     void SendResponse(http::HttpRequest& request);
+    // Responses to the pipelined requests of quick handlers are written with
+    // a single syscall, see http::HttpResponseBatch
+    bool TryBatchResponse(const std::shared_ptr<http::HttpRequest>& request);
+    void FlushResponseBatch();
+    void FinishResponse(http::HttpRequest& request);
 
     std::string Getpeername() const;
 
@@ -68,6 +97,11 @@ private:
 
     using HttpRequestPtr = std::shared_ptr<http::HttpRequest>;
     std::vector<HttpRequestPtr> pending_requests_;
+    // Tasks of the pending_requests_ with the same indices. Both vectors keep
+    // their capacity, so the pipelined requests are handed over without allocations.
+    std::vector<engine::TaskWithResult<void>> request_tasks_;
+    std::vector<HttpRequestPtr> batched_requests_;
+    http::HttpResponseBatch response_batch_;
 
     engine::io::Sockaddr remote_address_;
     std::string peer_name_;
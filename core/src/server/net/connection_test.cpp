@@ -1,5 +1,10 @@
 #include <server/net/connection.hpp>
 
+#include <array>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include <fmt/format.h>
 
 #include <server/handlers/http_handler_base_statistics.hpp>
@@ -7,6 +12,7 @@
 #include <server/net/create_socket.hpp>
 #include <userver/clients/http/client.hpp>
 #include <userver/engine/io/sockaddr.hpp>
+#include <userver/engine/mutex.hpp>
 #include <userver/engine/sleep.hpp>
 #include <userver/server/http/http_request.hpp>
 
@@ -23,9 +29,10 @@ constexpr auto kAcceptTimeout = utest::kMaxTestWaitTime;
 
 class TestHttprequestHandler : public server::http::RequestHandlerBase {
 public:
-    enum class Behaviors { kNoop, kHang };
+    enum class Behaviors { kNoop, kHang, kWaitForAll, kLogSlowly };
 
-    explicit TestHttprequestHandler(Behaviors behavior = Behaviors::kNoop) : behavior_(behavior) {}
+    explicit TestHttprequestHandler(Behaviors behavior = Behaviors::kNoop, std::size_t wait_for_count = 0)
+        : behavior_(behavior), wait_for_count_(wait_for_count) {}
 
     engine::TaskWithResult<void> StartRequestTask(std::shared_ptr<server::http::HttpRequest> http_request
     ) const override {
@@ -40,6 +47,23 @@ public:
                     ASSERT_TRUE(engine::current_task::IsCancelRequested());
                     ++asyncs_finished;
                 });
+            case Behaviors::kWaitForAll:
+                return engine::AsyncNoSpan([this]() {
+                    ++asyncs_started;
+                    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+                    while (asyncs_started < wait_for_count_ && !deadline.IsReached()) {
+                        engine::SleepFor(std::chrono::milliseconds{1});
+                    }
+                    if (asyncs_started >= wait_for_count_) ++asyncs_finished;
+                });
+            case Behaviors::kLogSlowly:
+                return engine::AsyncNoSpan([this, method = http_request->GetMethodStr()]() {
+                    AppendToLog(method + " started");
+                    // Gives the following requests a chance to be handled meanwhile
+                    engine::SleepFor(std::chrono::milliseconds{50});
+                    AppendToLog(method + " finished");
+                    ++asyncs_finished;
+                });
         }
 
         UINVARIANT(false, "Unexpected behavior");
@@ -50,13 +74,28 @@ public:
     const logging::TextLoggerPtr& LoggerAccess() const noexcept override { return no_logger_; };
     const logging::TextLoggerPtr& LoggerAccessTskv() const noexcept override { return no_logger_; };
 
+    std::vector<std::string> GetLog() const {
+        const std::lock_guard lock{log_mutex_};
+        return log_;
+    }
+
     // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
     mutable std::atomic<std::size_t> asyncs_finished{0};
+    // NOLINTNEXTLINE(misc-non-private-member-variables-in-classes)
+    mutable std::atomic<std::size_t> asyncs_started{0};
 
 private:
+    void AppendToLog(std::string event) const {
+        const std::lock_guard lock{log_mutex_};
+        log_.push_back(std::move(event));
+    }
+
     const Behaviors behavior_;
+    const std::size_t wait_for_count_;
     logging::TextLoggerPtr no_logger_;
     server::http::HandlerInfoIndex handler_info_index_;
+    mutable engine::Mutex log_mutex_;
+    mutable std::vector<std::string> log_;
 };
 
 std::string HttpConnectionUriFromSocket(engine::io::Socket& sock) {
@@ -355,4 +394,133 @@ UTEST_P(ServerNetConnection, CancelMultipleInFlight) {
     FAIL() << "Failed to simulate cancellation of multiple requests";
 }
 
+UTEST(ServerNetConnection, PipelinedRequestsConcurrently) {
+    constexpr std::size_t kPipelinedRequests = 10;
+    net::ListenerConfig config = CreateConfig();
+    auto request_socket = net::CreateSocket(config, config.ports[0]);
+
+    auto addr = engine::io::Sockaddr::MakeLoopbackAddress();
+    addr.SetPort(request_socket.Getsockname().Port());
+    engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+    client.Connect(addr, Deadline::FromDuration(kAcceptTimeout));
+
+    auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+    ASSERT_TRUE(peer.IsValid());
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    // Each handler waits for all the others, it would hang if they were handled one by one
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kWaitForAll, kPipelinedRequests};
+
+    auto task = engine::AsyncNoSpan([&] {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(peer)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    std::string requests;
+    for (std::size_t i = 0; i < kPipelinedRequests; ++i) {
+        requests += "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    }
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    ASSERT_EQ(client.SendAll(requests.data(), requests.size(), deadline), requests.size());
+
+    std::string responses;
+    std::size_t responses_count = 0;
+    while (responses_count < kPipelinedRequests) {
+        std::array<char, 4096> buffer{};
+        const auto received = client.RecvSome(buffer.data(), buffer.size(), deadline);
+        ASSERT_NE(received, 0);
+        responses.append(buffer.data(), received);
+
+        responses_count = 0;
+        for (auto pos = responses.find("HTTP/1.1 404"); pos != std::string::npos;
+             pos = responses.find("HTTP/1.1 404", pos + 1)) {
+            ++responses_count;
+        }
+    }
+    EXPECT_EQ(handler.asyncs_finished, kPipelinedRequests);
+
+    task.RequestCancel();
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
+UTEST(ServerNetConnection, PipelinedUnsafeRequestHandledInOrder) {
+    net::ListenerConfig config = CreateConfig();
+    auto request_socket = net::CreateSocket(config, config.ports[0]);
+
+    auto addr = engine::io::Sockaddr::MakeLoopbackAddress();
+    addr.SetPort(request_socket.Getsockname().Port());
+    engine::io::Socket client{addr.Domain(), engine::io::SocketType::kStream};
+    client.Connect(addr, Deadline::FromDuration(kAcceptTimeout));
+
+    auto peer = request_socket.Accept(Deadline::FromDuration(kAcceptTimeout));
+    ASSERT_TRUE(peer.IsValid());
+    auto stats = std::make_shared<net::Stats>();
+    server::request::ResponseDataAccounter data_accounter;
+    TestHttprequestHandler handler{TestHttprequestHandler::Behaviors::kLogSlowly};
+
+    auto task = engine::AsyncNoSpan([&] {
+        net::Connection connection(
+            config.connection_config,
+            config.handler_defaults,
+            std::make_unique<engine::io::Socket>(std::move(peer)),
+            {},
+            handler,
+            stats,
+            data_accounter
+        );
+
+        connection.Process();
+    });
+
+    // The GET must not see the state from before the POST (RFC 9112, 9.3.2),
+    // and the POST must not run before the responses to the GETs are sent
+    const std::string requests =
+        "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n"
+        "POST / HTTP/1.1\r\nHost: localhost\r\nContent-Length: 4\r\n\r\ntest"
+        "GET / HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    constexpr std::size_t kPipelinedRequests = 3;
+    const auto deadline = Deadline::FromDuration(utest::kMaxTestWaitTime);
+    ASSERT_EQ(client.SendAll(requests.data(), requests.size(), deadline), requests.size());
+
+    std::string responses;
+    std::size_t responses_count = 0;
+    while (responses_count < kPipelinedRequests) {
+        std::array<char, 4096> buffer{};
+        const auto received = client.RecvSome(buffer.data(), buffer.size(), deadline);
+        ASSERT_NE(received, 0);
+        responses.append(buffer.data(), received);
+
+        responses_count = 0;
+        for (auto pos = responses.find("HTTP/1.1 404"); pos != std::string::npos;
+             pos = responses.find("HTTP/1.1 404", pos + 1)) {
+            ++responses_count;
+        }
+    }
+    EXPECT_EQ(handler.asyncs_finished, kPipelinedRequests);
+
+    const std::vector<std::string> expected_log{
+        "GET started",
+        "GET finished",
+        "POST started",
+        "POST finished",
+        "GET started",
+        "GET finished",
+    };
+    EXPECT_EQ(handler.GetLog(), expected_log);
+
+    task.RequestCancel();
+    task.WaitFor(utest::kMaxTestWaitTime);
+    EXPECT_TRUE(task.IsFinished());
+}
+
 USERVER_NAMESPACE_END
@@ -1,5 +1,11 @@
 #include "create_socket.hpp"
 
+#ifdef __linux__
+#include <linux/filter.h>
+#endif
+#include <sys/socket.h>
+
+#include <array>
 #include <string>
 
 #include <fmt/format.h>
@@ -10,13 +16,27 @@
 #include <userver/fs/blocking/write.hpp>
 #include <userver/net/blocking/get_addr_info.hpp>
 
+#include <utils/check_syscall.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::net {
 
 namespace {
 
-engine::io::Socket CreateUnixSocket(const std::string& path, int backlog, boost::filesystem::perms perms) {
+engine::io::Socket MakeStreamSocket(engine::io::AddrDomain domain, engine::ev::ThreadControl* ev_thread) {
+    if (ev_thread) {
+        return engine::io::Socket{domain, engine::io::SocketType::kStream, *ev_thread};
+    }
+    return engine::io::Socket{domain, engine::io::SocketType::kStream};
+}
+
+engine::io::Socket CreateUnixSocket(
+    const std::string& path,
+    int backlog,
+    boost::filesystem::perms perms,
+    engine::ev::ThreadControl* ev_thread
+) {
     const auto addr = engine::io::Sockaddr::MakeUnixSocketAddress(path);
 
     /* Use blocking API here, it is not critical as CreateUnixSocket() is called
@@ -25,7 +45,7 @@ engine::io::Socket CreateUnixSocket(const std::string& path, int backlog, boost:
     if (fs::blocking::GetFileType(path) == boost::filesystem::file_type::socket_file)
         fs::blocking::RemoveSingleFile(path);
 
-    engine::io::Socket socket{addr.Domain(), engine::io::SocketType::kStream};
+    auto socket = MakeStreamSocket(addr.Domain(), ev_thread);
     socket.Bind(addr);
     socket.Listen(backlog);
 
@@ -33,7 +53,8 @@ engine::io::Socket CreateUnixSocket(const std::string& path, int backlog, boost:
     return socket;
 }
 
-engine::io::Socket CreateIpv6Socket(const std::string& address, uint16_t port, int backlog) {
+engine::io::Socket
+CreateIpv6Socket(const std::string& address, uint16_t port, int backlog, engine::ev::ThreadControl* ev_thread) {
     std::vector<engine::io::Sockaddr> addrs;
 
     try {
@@ -54,19 +75,59 @@ engine::io::Socket CreateIpv6Socket(const std::string& address, uint16_t port, i
         ));
 
     auto& addr = addrs.front();
-    engine::io::Socket socket{addr.Domain(), engine::io::SocketType::kStream};
+    auto socket = MakeStreamSocket(addr.Domain(), ev_thread);
     socket.Bind(addr);
     socket.Listen(backlog);
     return socket;
 }
 
+engine::io::Socket DoCreateSocket(
+    const ListenerConfig& config,
+    const PortConfig& port_config,
+    engine::ev::ThreadControl* ev_thread
+) {
+    if (port_config.unix_socket_path.empty())
+        return CreateIpv6Socket(port_config.address, port_config.port, config.backlog, ev_thread);
+    else
+        return CreateUnixSocket(port_config.unix_socket_path, config.backlog, port_config.unix_socket_perms, ev_thread);
+}
+
 }  // namespace
 
 engine::io::Socket CreateSocket(const ListenerConfig& config, const PortConfig& port_config) {
-    if (port_config.unix_socket_path.empty())
-        return CreateIpv6Socket(port_config.address, port_config.port, config.backlog);
-    else
-        return CreateUnixSocket(port_config.unix_socket_path, config.backlog, port_config.unix_socket_perms);
+    return DoCreateSocket(config, port_config, nullptr);
+}
+
+engine::io::Socket
+CreateSocket(const ListenerConfig& config, const PortConfig& port_config, engine::ev::ThreadControl& ev_thread) {
+    return DoCreateSocket(config, port_config, &ev_thread);
+}
+
+void AttachReuseportCpuSteering(engine::io::Socket& socket, std::size_t group_size) {
+    UASSERT(group_size > 0);
+// MAC_COMPAT: no reuseport BPF programs
+#ifdef SO_ATTACH_REUSEPORT_CBPF
+    std::array<sock_filter, 3> code{{
+        // A = the CPU that processes the packet
+        {BPF_LD | BPF_W | BPF_ABS, 0, 0, static_cast<std::uint32_t>(SKF_AD_OFF + SKF_AD_CPU)},
+        // A = A % group_size
+        {BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<std::uint32_t>(group_size)},
+        // return A as the index of the socket in the reuseport group
+        {BPF_RET | BPF_A, 0, 0, 0},
+    }};
+    sock_fprog program{};
+    program.len = code.size();
+    program.filter = code.data();
+
+    utils::CheckSyscall(
+        ::setsockopt(socket.Fd(), SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &program, sizeof(program)),
+        "attaching reuseport CPU steering program, fd={}",
+        socket.Fd()
+    );
+#else
+    (void)socket;
+    throw std::runtime_error("Reuseport CPU steering is not supported on this platform");
+#endif
 }
 
 }  // namespace server::net
@@ -9,6 +9,15 @@ namespace server::net {
 
 engine::io::Socket CreateSocket(const ListenerConfig& config, const PortConfig& port_config);
 
+/// Same as CreateSocket(), the I/O of the socket is served by `ev_thread`
+engine::io::Socket
+CreateSocket(const ListenerConfig& config, const PortConfig& port_config, engine::ev::ThreadControl& ev_thread);
+
+/// Attaches a classic BPF program that steers new connections to the
+/// `socket`'s SO_REUSEPORT group member with index `cpu % group_size`, where
+/// `cpu` is the CPU that processes the incoming packet.
+void AttachReuseportCpuSteering(engine::io::Socket& socket, std::size_t group_size);
+
 }  // namespace server::net
 
 USERVER_NAMESPACE_END
@@ -10,9 +10,13 @@ namespace server::net {
 Listener::Listener(
     std::shared_ptr<EndpointInfo> endpoint_info,
     engine::TaskProcessor& task_processor,
-    request::ResponseDataAccounter& data_accounter
+    request::ResponseDataAccounter& data_accounter,
+    ListenerShard shard
 )
-    : task_processor_(&task_processor), endpoint_info_(std::move(endpoint_info)), data_accounter_(&data_accounter) {}
+    : task_processor_(&task_processor),
+      endpoint_info_(std::move(endpoint_info)),
+      data_accounter_(&data_accounter),
+      shard_(shard) {}
 
 Listener::~Listener() {
     if (!impl_) return;
@@ -22,7 +26,9 @@ Listener::~Listener() {
     LOG_TRACE() << "Destroyed listener";
 }
 
-void Listener::Start() { impl_ = std::make_unique<ListenerImpl>(*task_processor_, endpoint_info_, *data_accounter_); }
+void Listener::Start() {
+    impl_ = std::make_unique<ListenerImpl>(*task_processor_, endpoint_info_, *data_accounter_, shard_);
+}
 
 StatsAggregation Listener::GetStats() const {
     if (impl_) return impl_->GetStats();
@@ -17,7 +17,8 @@ public:
     Listener(
         std::shared_ptr<EndpointInfo> endpoint_info,
         engine::TaskProcessor& task_processor,
-        request::ResponseDataAccounter& data_accounter
+        request::ResponseDataAccounter& data_accounter,
+        ListenerShard shard
     );
     ~Listener();
 
@@ -34,6 +35,7 @@ private:
     engine::TaskProcessor* task_processor_;
     std::shared_ptr<EndpointInfo> endpoint_info_;
     request::ResponseDataAccounter* data_accounter_;
+    ListenerShard shard_;
 
     std::unique_ptr<ListenerImpl> impl_;
 };
@@ -72,6 +72,8 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Li
     config.handler_defaults = value["handler-defaults"].As<request::HttpRequestConfig>();
     config.max_connections = value["max_connections"].As<size_t>(config.max_connections);
     config.shards = value["shards"].As<std::optional<size_t>>(config.shards);
+    config.reuseport = value["reuseport"].As<bool>(config.reuseport);
+    config.reuseport_cpu_steering = value["reuseport-cpu-steering"].As<bool>(config.reuseport_cpu_steering);
     config.task_processor = value["task_processor"].As<std::string>();
     config.backlog = value["backlog"].As<int>(config.backlog);
 
@@ -87,6 +89,10 @@ ListenerConfig Parse(const yaml_config::YamlConfig& value, formats::parse::To<Li
         throw std::runtime_error("Invalid backlog value in " + value.GetPath());
     }
 
+    if (config.reuseport_cpu_steering && !config.reuseport) {
+        throw std::runtime_error("'reuseport-cpu-steering' requires 'reuseport' to be enabled in " + value.GetPath());
+    }
+
     return config;
 }
 
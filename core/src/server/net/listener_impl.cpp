@@ -8,6 +8,8 @@
 #include <string>
 #include <system_error>
 
+#include <engine/ev/thread_pool.hpp>
+#include <engine/task/task_processor.hpp>
 #include <server/net/create_socket.hpp>
 #include <userver/engine/async.hpp>
 #include <userver/engine/io/exception.hpp>
@@ -27,19 +29,37 @@ namespace server::net {
 ListenerImpl::ListenerImpl(
     engine::TaskProcessor& task_processor,
     std::shared_ptr<EndpointInfo> endpoint_info,
-    request::ResponseDataAccounter& data_accounter
+    request::ResponseDataAccounter& data_accounter,
+    ListenerShard shard
 )
     : task_processor_(task_processor),
       endpoint_info_(std::move(endpoint_info)),
       stats_(std::make_shared<Stats>()),
       data_accounter_(data_accounter) {
-    for (const auto& port : endpoint_info_->listener_config.ports) {
+    const auto& listener_config = endpoint_info_->listener_config;
+    if (listener_config.reuseport) {
+        auto& event_thread_pool = task_processor_.EventThreadPool();
+        ev_thread_ = &event_thread_pool.GetThread(shard.index % event_thread_pool.GetSize());
+    }
+
+    for (const auto& port : listener_config.ports) {
+        auto socket =
+            ev_thread_ ? CreateSocket(listener_config, port, *ev_thread_) : CreateSocket(listener_config, port);
+
+        // The program is shared by the whole reuseport group, sockets of
+        // the group are indexed in the order of bind(), i.e. by shard index
+        if (listener_config.reuseport_cpu_steering && shard.index == 0 && port.unix_socket_path.empty()) {
+            AttachReuseportCpuSteering(socket, shard.count);
+        }
+
+        // Each socket accepts the connections with the config of its own port,
+        // e.g. TLS is set up per port
         socket_listener_tasks.push_back(engine::CriticalAsyncNoSpan(
             task_processor_,
-            [this](engine::io::Socket&& request_socket) {
+            [this, &port](engine::io::Socket&& request_socket) {
                 while (!engine::current_task::ShouldCancel()) {
                     try {
-                        AcceptConnection(request_socket, endpoint_info_->listener_config.ports[0]);
+                        AcceptConnection(request_socket, port);
                     } catch (const engine::io::IoCancelled&) {
                         break;
                     } catch (const std::exception& ex) {
@@ -51,7 +71,7 @@ ListenerImpl::ListenerImpl(
                     }
                 }
             },
-            CreateSocket(endpoint_info_->listener_config, port)
+            std::move(socket)
         ));
     }
 }
@@ -67,7 +87,8 @@ ListenerImpl::~ListenerImpl() {
 StatsAggregation ListenerImpl::GetStats() const { return StatsAggregation{*stats_}; }
 
 void ListenerImpl::AcceptConnection(engine::io::Socket& request_socket, const PortConfig& port_config) {
-    auto peer_socket = request_socket.Accept({});
+    // In reuseport mode the connection stays on the ev thread of its shard
+    auto peer_socket = ev_thread_ ? request_socket.Accept({}, *ev_thread_) : request_socket.Accept({});
 
     const auto new_connection_count = ++endpoint_info_->connection_count;
     utils::FastScopeGuard guard{[this]() noexcept { --endpoint_info_->connection_count; }};
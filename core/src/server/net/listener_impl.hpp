@@ -13,14 +13,25 @@
 
 USERVER_NAMESPACE_BEGIN
 
+namespace engine::ev {
+class ThreadControl;
+}  // namespace engine::ev
+
 namespace server::net {
 
+/// Position of a listener among the listeners of the same endpoint
+struct ListenerShard {
+    std::size_t index{0};
+    std::size_t count{1};
+};
+
 class ListenerImpl final {
 public:
     ListenerImpl(
         engine::TaskProcessor& task_processor,
         std::shared_ptr<EndpointInfo> endpoint_info,
-        request::ResponseDataAccounter& data_accounter
+        request::ResponseDataAccounter& data_accounter,
+        ListenerShard shard
     );
     ~ListenerImpl();
 
@@ -32,6 +43,8 @@ private:
 
     engine::TaskProcessor& task_processor_;
     std::shared_ptr<EndpointInfo> endpoint_info_;
+    // Serves all the sockets of the shard in `reuseport` mode, nullptr otherwise
+    engine::ev::ThreadControl* ev_thread_{nullptr};
 
     std::shared_ptr<Stats> stats_;
     request::ResponseDataAccounter& data_accounter_;
@@ -66,6 +66,9 @@ struct Stats {
     ParserStats parser_stats;
     concurrent::StripedCounter active_request_count;
     concurrent::StripedCounter requests_processed_count;
+    // Sum of the times from the start of the processed requests till their
+    // responses were ready
+    concurrent::StripedCounter requests_processing_time_us;
 };
 
 struct StatsAggregation final {
@@ -77,7 +80,8 @@ struct StatsAggregation final {
           connections_closed{stats.connections_closed.load()},
           parser_stats{stats.parser_stats},
           active_request_count{stats.active_request_count.NonNegativeRead()},
-          requests_processed_count{stats.requests_processed_count.Read()} {}
+          requests_processed_count{stats.requests_processed_count.Read()},
+          requests_processing_time_us{stats.requests_processing_time_us.Read()} {}
 
     StatsAggregation& operator+=(const StatsAggregation& other) {
         active_connections += other.active_connections;
@@ -87,6 +91,7 @@ struct StatsAggregation final {
         parser_stats += other.parser_stats;
         active_request_count += other.active_request_count;
         requests_processed_count += other.requests_processed_count;
+        requests_processing_time_us += other.requests_processing_time_us;
 
         return *this;
     }
@@ -99,6 +104,7 @@ struct StatsAggregation final {
     ParserStatsAggregation parser_stats;
     std::size_t active_request_count{0};
     std::size_t requests_processed_count{0};
+    std::size_t requests_processing_time_us{0};
 };
 
 }  // namespace server::net
@@ -1,6 +1,9 @@
 #include <userver/server/request/request_context.hpp>
 
+#include <array>
+#include <cstddef>
 #include <memory>
+#include <memory_resource>
 #include <stdexcept>
 
 #include <server/request/internal_request_context.hpp>
@@ -10,8 +13,29 @@ USERVER_NAMESPACE_BEGIN
 
 namespace server::request {
 
+namespace {
+
+// Most requests fit into the first block, that is allocated together with the
+// arena itself
+constexpr std::size_t kArenaInitialBufferSize = 4096;
+
+class RequestArena final {
+public:
+    RequestArena() : resource_(buffer_.data(), buffer_.size(), std::pmr::new_delete_resource()) {}
+
+    std::pmr::memory_resource& GetResource() noexcept { return resource_; }
+
+private:
+    alignas(std::max_align_t) std::array<std::byte, kArenaInitialBufferSize> buffer_;
+    std::pmr::monotonic_buffer_resource resource_;
+};
+
+}  // namespace
+
 class RequestContext::Impl final {
 public:
+    std::pmr::memory_resource& GetArena();
+
     utils::AnyMovable& SetUserAnyData(utils::AnyMovable&& data);
     utils::AnyMovable& GetUserAnyData();
     utils::AnyMovable* GetUserAnyDataOptional();
@@ -25,11 +49,18 @@ public:
     impl::InternalRequestContext& GetInternalContext();
 
 private:
+    // Declared first to outlive the data that may have been allocated in it
+    std::unique_ptr<RequestArena> arena_;
     utils::AnyMovable user_data_;
     utils::impl::TransparentMap<std::string, utils::AnyMovable> named_datum_;
     impl::InternalRequestContext internal_context_;
 };
 
+std::pmr::memory_resource& RequestContext::Impl::GetArena() {
+    if (!arena_) arena_ = std::make_unique<RequestArena>();
+    return arena_->GetResource();
+}
+
 utils::AnyMovable& RequestContext::Impl::SetUserAnyData(utils::AnyMovable&& data) {
     if (user_data_.HasValue()) throw std::runtime_error("UserData is already stored in RequestContext");
     user_data_ = std::move(data);
@@ -82,6 +113,8 @@ RequestContext::RequestContext(RequestContext&&) noexcept = default;
 
 RequestContext::~RequestContext() = default;
 
+std::pmr::memory_resource& RequestContext::GetArena() { return impl_->GetArena(); }
+
 utils::AnyMovable& RequestContext::SetUserAnyData(utils::AnyMovable&& data) {
     return impl_->SetUserAnyData(std::move(data));
 }
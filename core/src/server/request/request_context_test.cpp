@@ -3,6 +3,9 @@
 #include <userver/utest/assert_macros.hpp>
 
 #include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -158,4 +161,33 @@ TEST(RequestContext, MoveOnlyByConst) {
     EXPECT_EQ(*context.GetData<std::unique_ptr<int>>(kKey), 42);
 }
 
+TEST(RequestContext, Arena) {
+    server::request::RequestContext context;
+    auto& arena = context.GetArena();
+    EXPECT_EQ(&arena, &context.GetArena());
+
+    std::pmr::vector<std::pmr::string> strings{&arena};
+    for (int i = 0; i < 1000; ++i) {
+        strings.emplace_back(std::string(100, 'a') + std::to_string(i));
+    }
+    EXPECT_EQ(std::string_view{strings.back()}, std::string(100, 'a') + "999");
+    EXPECT_EQ(strings.back().get_allocator().resource(), &arena);
+}
+
+TEST(RequestContext, ArenaOutlivesData) {
+    using Strings = std::pmr::vector<std::pmr::string>;
+
+    server::request::RequestContext context;
+    auto& strings = context.EmplaceUserData<Strings>(&context.GetArena());
+    strings.emplace_back(200, 'a');
+
+    auto& named_strings = context.EmplaceData<Strings>(std::string{kKey}, &context.GetArena());
+    named_strings.emplace_back(200, 'b');
+
+    // The arena is not relocated with the context
+    server::request::RequestContext moved_context{std::move(context)};
+    EXPECT_EQ(moved_context.GetUserData<Strings>().get_allocator().resource(), &moved_context.GetArena());
+    EXPECT_EQ(std::string_view{moved_context.GetData<Strings>(kKey).front()}, std::string(200, 'b'));
+}
+
 USERVER_NAMESPACE_END
@@ -3,6 +3,8 @@
 #include <cstddef>
 #include <string_view>
 
+#include <userver/utils/span.hpp>
+
 USERVER_NAMESPACE_BEGIN
 
 namespace server::request {
@@ -16,6 +18,15 @@ public:
     virtual ~RequestParser() noexcept = default;
 
     virtual bool Parse(std::string_view request) = 0;
+
+    // Memory for the rest of the body of the request being parsed. Data read
+    // right into it and then passed to Parse() is not copied. Empty if the
+    // parser does not know the body size.
+    virtual utils::span<char> GetBodyReadBuffer() noexcept { return {}; }
+
+    // Whether some data passed to Parse() waits for the next Parse() call,
+    // which may then be made without new data
+    virtual bool HasUnparsedData() const noexcept { return false; }
 };
 
 }  // namespace server::request
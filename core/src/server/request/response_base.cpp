@@ -71,9 +71,13 @@ ResponseBase::~ResponseBase() noexcept {
 }
 
 void ResponseBase::SetData(std::string data) {
-    create_time_ = std::chrono::steady_clock::now();
     data_ = std::move(data);
-    guard_.emplace(accounter_, create_time_, data_.size());
+    AccountBody();
+}
+
+void ResponseBase::AccountBody() {
+    create_time_ = std::chrono::steady_clock::now();
+    guard_.emplace(accounter_, create_time_, GetBodySize());
 }
 
 void ResponseBase::SetReady() { SetReady(std::chrono::steady_clock::now()); }
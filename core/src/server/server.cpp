@@ -66,8 +66,10 @@ void PortInfo::Init(
     size_t listener_shards = listener_config.shards ? *listener_config.shards : event_thread_pool.GetSize();
 
     listeners_.reserve(listener_shards);
-    while (listener_shards--) {
-        listeners_.emplace_back(endpoint_info_, task_processor, data_accounter_);
+    for (size_t shard_index = 0; shard_index < listener_shards; ++shard_index) {
+        listeners_.emplace_back(
+            endpoint_info_, task_processor, data_accounter_, net::ListenerShard{shard_index, listener_shards}
+        );
     }
 }
 
@@ -0,0 +1,216 @@
+#include <server/websocket/deflate.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include <userver/utils/assert.hpp>
+#include <userver/utils/text_light.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+namespace {
+
+constexpr std::string_view kExtensionName = "permessage-deflate";
+
+// Empty stored block that ends every Z_SYNC_FLUSH. RFC 7692 section 7.2.1
+// removes it from the messages, so it is stripped on send and re-added on
+// receive.
+constexpr std::string_view kFlushMarker{"\x00\x00\xff\xff", 4};
+
+constexpr int kMaxWindowBits = 15;
+// zlib silently uses 9 bits instead of 8 for raw deflate, so smaller windows
+// can not be promised
+constexpr int kMinServerWindowBits = 9;
+constexpr int kMemLevel = 8;
+
+constexpr std::size_t kMinDecompressBufferSize = 4096;
+
+std::string_view Trim(std::string_view str) noexcept {
+    const auto begin = str.find_first_not_of(" \t");
+    if (begin == std::string_view::npos) return {};
+    const auto end = str.find_last_not_of(" \t");
+    return str.substr(begin, end - begin + 1);
+}
+
+std::optional<int> ParseWindowBits(std::string_view value) noexcept {
+    // RFC 7692 allows the quoted-string form of the value
+    if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+        value = value.substr(1, value.size() - 2);
+    }
+
+    int bits = 0;
+    const auto* const end = value.data() + value.size();
+    const auto [ptr, ec] = std::from_chars(value.data(), end, bits);
+    if (ec != std::errc{} || ptr != end || bits < 8 || bits > kMaxWindowBits) return {};
+    return bits;
+}
+
+std::optional<DeflateParams> ParseOffer(std::string_view offer, const DeflateConfig& config) {
+    const auto parts = utils::text::SplitIntoStringViewVector(offer, ";");
+    if (parts.empty() || Trim(parts.front()) != kExtensionName) return {};
+
+    DeflateParams params;
+    params.server_no_context_takeover = config.server_no_context_takeover;
+    params.client_no_context_takeover = config.client_no_context_takeover;
+    params.server_max_window_bits = config.server_max_window_bits;
+
+    bool seen_server_no_context_takeover = false;
+    bool seen_client_no_context_takeover = false;
+    bool seen_client_max_window_bits = false;
+
+    for (auto it = parts.begin() + 1; it != parts.end(); ++it) {
+        const auto param = Trim(*it);
+        const auto eq_pos = param.find('=');
+        const auto name = Trim(param.substr(0, eq_pos));
+        const auto value = eq_pos == std::string_view::npos ? std::string_view{} : Trim(param.substr(eq_pos + 1));
+        const bool has_value = eq_pos != std::string_view::npos;
+
+        // Each parameter may appear once, an offer with unknown parameters
+        // must be declined
+        if (name == "server_no_context_takeover") {
+            if (has_value || std::exchange(seen_server_no_context_takeover, true)) return {};
+            params.server_no_context_takeover = true;
+        } else if (name == "client_no_context_takeover") {
+            if (has_value || std::exchange(seen_client_no_context_takeover, true)) return {};
+        } else if (name == "server_max_window_bits") {
+            if (params.server_max_window_bits_requested) return {};
+            const auto bits = ParseWindowBits(value);
+            if (!bits || *bits < kMinServerWindowBits) return {};
+            params.server_max_window_bits = std::min(params.server_max_window_bits, *bits);
+            params.server_max_window_bits_requested = true;
+        } else if (name == "client_max_window_bits") {
+            // The messages of the client are always decompressed with the
+            // largest window, so the hint is accepted silently
+            if (std::exchange(seen_client_max_window_bits, true)) return {};
+            if (has_value && !ParseWindowBits(value)) return {};
+        } else {
+            return {};
+        }
+    }
+
+    return params;
+}
+
+}  // namespace
+
+std::optional<DeflateParams> NegotiateDeflate(std::string_view extensions_header, const DeflateConfig& config) {
+    if (!config.enabled) return {};
+
+    for (const auto offer : utils::text::SplitIntoStringViewVector(extensions_header, ",")) {
+        auto params = ParseOffer(offer, config);
+        if (params) return params;
+    }
+    return {};
+}
+
+std::string MakeDeflateResponseHeader(const DeflateParams& params) {
+    std::string result{kExtensionName};
+    if (params.server_no_context_takeover) result += "; server_no_context_takeover";
+    if (params.client_no_context_takeover) result += "; client_no_context_takeover";
+    if (params.server_max_window_bits_requested) {
+        result += fmt::format("; server_max_window_bits={}", params.server_max_window_bits);
+    }
+    return result;
+}
+
+MessageDeflate::MessageDeflate(const DeflateParams& params, int compression_level)
+    : server_no_context_takeover_(params.server_no_context_takeover),
+      client_no_context_takeover_(params.client_no_context_takeover) {
+    // Negative window bits select the raw deflate format without zlib headers
+    if (deflateInit2(
+            &deflate_stream_,
+            compression_level,
+            Z_DEFLATED,
+            -params.server_max_window_bits,
+            kMemLevel,
+            Z_DEFAULT_STRATEGY
+        ) != Z_OK) {
+        throw std::runtime_error("Failed to initialize websocket message compressor");
+    }
+    if (inflateInit2(&inflate_stream_, -kMaxWindowBits) != Z_OK) {
+        deflateEnd(&deflate_stream_);
+        throw std::runtime_error("Failed to initialize websocket message decompressor");
+    }
+}
+
+MessageDeflate::~MessageDeflate() {
+    deflateEnd(&deflate_stream_);
+    inflateEnd(&inflate_stream_);
+}
+
+void MessageDeflate::Compress(utils::span<const std::byte> message, std::string& out) {
+    auto& stream = deflate_stream_;
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<std::byte*>(message.data()));
+    stream.avail_in = static_cast<uInt>(message.size());
+
+    out.resize(deflateBound(&stream, message.size()) + kFlushMarker.size());
+    std::size_t out_size = 0;
+    do {
+        if (out_size == out.size()) out.resize(out.size() * 2);
+        stream.next_out = reinterpret_cast<Bytef*>(out.data() + out_size);
+        stream.avail_out = static_cast<uInt>(out.size() - out_size);
+
+        [[maybe_unused]] const int ret = deflate(&stream, Z_SYNC_FLUSH);
+        UASSERT_MSG(ret == Z_OK || ret == Z_BUF_ERROR, "Unexpected deflate() result");
+        out_size = out.size() - stream.avail_out;
+    } while (stream.avail_out == 0);
+
+    UASSERT((std::string_view{out.data(), out_size}.substr(out_size - kFlushMarker.size()) == kFlushMarker));
+    out.resize(out_size - kFlushMarker.size());
+
+    if (server_no_context_takeover_) deflateReset(&stream);
+}
+
+CloseStatus MessageDeflate::Decompress(std::string_view message, std::string& out, std::size_t max_size) {
+    auto& stream = inflate_stream_;
+
+    // One more byte to tell a message of exactly max_size from a bigger one
+    const auto buffer_limit = max_size + 1;
+    out.resize(std::min(buffer_limit, std::max(kMinDecompressBufferSize, message.size() * 4)));
+    std::size_t out_size = 0;
+
+    bool stream_end = false;
+    for (const auto input : {message, kFlushMarker}) {
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+        stream.avail_in = static_cast<uInt>(input.size());
+
+        while (!stream_end && (stream.avail_in > 0 || out_size == out.size())) {
+            if (out_size == out.size()) {
+                if (out.size() == buffer_limit) return CloseStatus::kTooBigData;
+                out.resize(std::min(buffer_limit, out.size() * 2));
+            }
+            stream.next_out = reinterpret_cast<Bytef*>(out.data() + out_size);
+            stream.avail_out = static_cast<uInt>(out.size() - out_size);
+
+            const int ret = inflate(&stream, Z_SYNC_FLUSH);
+            out_size = out.size() - stream.avail_out;
+            if (ret == Z_STREAM_END) {
+                // The client finished the deflate stream, the next message
+                // starts a new one
+                stream_end = true;
+            } else if (ret == Z_BUF_ERROR) {
+                // no progress is possible, all the output is flushed
+                break;
+            } else if (ret != Z_OK) {
+                inflateReset(&stream);
+                return CloseStatus::kBadMessageData;
+            }
+        }
+    }
+
+    if (out_size > max_size) return CloseStatus::kTooBigData;
+    out.resize(out_size);
+
+    if (stream_end || client_no_context_takeover_) inflateReset(&stream);
+    return CloseStatus::kNone;
+}
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
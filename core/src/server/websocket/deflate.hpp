@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include <zlib.h>
+
+#include <userver/server/websocket/server.hpp>
+#include <userver/utils/span.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace server::websocket::impl {
+
+/// permessage-deflate parameters agreed with the client, RFC 7692
+struct DeflateParams final {
+    bool server_no_context_takeover = false;
+    bool client_no_context_takeover = false;
+    int server_max_window_bits = 15;
+    // Whether the client limited the window, it expects an answer then
+    bool server_max_window_bits_requested = false;
+};
+
+/// Picks the first acceptable permessage-deflate offer of the
+/// `Sec-WebSocket-Extensions` request header, nullopt if there is none
+std::optional<DeflateParams> NegotiateDeflate(std::string_view extensions_header, const DeflateConfig& config);
+
+/// Value of the `Sec-WebSocket-Extensions` response header
+std::string MakeDeflateResponseHeader(const DeflateParams& params);
+
+/// Compression contexts of a connection. Messages must be compressed and
+/// decompressed in the order they are sent and received.
+class MessageDeflate final {
+public:
+    MessageDeflate(const DeflateParams& params, int compression_level);
+    ~MessageDeflate();
+
+    MessageDeflate(const MessageDeflate&) = delete;
+    MessageDeflate& operator=(const MessageDeflate&) = delete;
+
+    /// Replaces the contents of `out` with the compressed `message`
+    void Compress(utils::span<const std::byte> message, std::string& out);
+
+    /// Replaces the contents of `out` with the decompressed `message`.
+    /// Returns kTooBigData if the result exceeds `max_size` and kBadMessageData
+    /// if the message is malformed, the connection must be closed then.
+    CloseStatus Decompress(std::string_view message, std::string& out, std::size_t max_size);
+
+private:
+    z_stream deflate_stream_{};
+    z_stream inflate_stream_{};
+    const bool server_no_context_takeover_;
+    const bool client_no_context_takeover_;
+};
+
+}  // namespace server::websocket::impl
+
+USERVER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#include <server/websocket/deflate.hpp>
+
+#include <cstring>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <server/websocket/protocol.hpp>
+
+USERVER_NAMESPACE_BEGIN
+
+namespace {
+
+using server::websocket::CloseStatus;
+using server::websocket::DeflateConfig;
+namespace impl = server::websocket::impl;
+
+DeflateConfig MakeEnabledConfig() {
+    DeflateConfig config;
+    config.enabled = true;
+    return config;
+}
+
+utils::span<const std::byte> AsBytes(const std::string& str) { return utils::as_bytes(utils::span<const char>(str)); }
+
+}  // namespace
+
+TEST(WebsocketDeflate, NegotiateDefaultOffer) {
+    const auto params = impl::NegotiateDeflate("permessage-deflate; client_max_window_bits", MakeEnabledConfig());
+    ASSERT_TRUE(params);
+    EXPECT_FALSE(params->server_no_context_takeover);
+    EXPECT_EQ(params->server_max_window_bits, 15);
+    EXPECT_EQ(impl::MakeDeflateResponseHeader(*params), "permessage-deflate");
+
+    EXPECT_FALSE(impl::NegotiateDeflate("permessage-deflate", DeflateConfig{}));
+    EXPECT_FALSE(impl::NegotiateDeflate("", MakeEnabledConfig()));
+}
+
+TEST(WebsocketDeflate, NegotiateParams) {
+    auto config = MakeEnabledConfig();
+    config.client_no_context_takeover = true;
+
+    const auto params = impl::NegotiateDeflate(
+        "x-webkit-deflate-frame, permessage-deflate; server_max_window_bits=8, "
+        "permessage-deflate; server_no_context_takeover; server_max_window_bits=\"10\"",
+        config
+    );
+    ASSERT_TRUE(params);
+    EXPECT_EQ(
+        impl::MakeDeflateResponseHeader(*params),
+        "permessage-deflate; server_no_context_takeover; client_no_context_takeover; server_max_window_bits=10"
+    );
+
+    EXPECT_FALSE(impl::NegotiateDeflate("permessage-deflate; unknown_param", config));
+    EXPECT_FALSE(impl::NegotiateDeflate("permessage-deflate; server_max_window_bits", config));
+    EXPECT_FALSE(
+        impl::NegotiateDeflate("permessage-deflate; server_no_context_takeover; server_no_context_takeover", config)
+    );
+}
+
+TEST(WebsocketDeflate, RoundTrip) {
+    const impl::DeflateParams params;
+    impl::MessageDeflate sender{params, 6};
+    impl::MessageDeflate receiver{params, 6};
+
+    std::string compressed;
+    std::string decompressed;
+    for (int i = 0; i < 3; ++i) {
+        const std::string message = R"({"delta": [1, 2, 3], "seq": )" + std::to_string(i) + std::string(1000, ' ') + "}";
+        sender.Compress(AsBytes(message), compressed);
+        EXPECT_LT(compressed.size(), message.size());
+
+        ASSERT_EQ(receiver.Decompress(compressed, decompressed, message.size()), CloseStatus::kNone);
+        EXPECT_EQ(decompressed, message);
+    }
+}
+
+TEST(WebsocketDeflate, DecompressLimits) {
+    const impl::DeflateParams params;
+    impl::MessageDeflate sender{params, 6};
+    impl::MessageDeflate receiver{params, 6};
+
+    const std::string message(100000, 'a');
+    std::string compressed;
+    std::string decompressed;
+    sender.Compress(AsBytes(message), compressed);
+    EXPECT_EQ(receiver.Decompress(compressed, decompressed, message.size() - 1), CloseStatus::kTooBigData);
+
+    impl::MessageDeflate bad_receiver{params, 6};
+    EXPECT_EQ(bad_receiver.Decompress("\xff\xff\xff\xff", decompressed, 1000), CloseStatus::kBadMessageData);
+}
+
+TEST(WebsocketProtocol, XorMask) {
+    const std::uint32_t mask = 0x37fa213d;
+    char mask_bytes[sizeof(mask)];
+    std::memcpy(mask_bytes, &mask, sizeof(mask));
+
+    for (std::size_t size = 0; size < 100; ++size) {
+        std::string payload;
+        for (std::size_t i = 0; i < size; ++i) payload.push_back(static_cast<char>(i * 7));
+
+        std::string expected = payload;
+        for (std::size_t i = 0; i < size; ++i) expected[i] ^= mask_bytes[i % sizeof(mask)];
+
+        impl::XorMaskInplace(payload, mask);
+        EXPECT_EQ(payload, expected) << "size " << size;
+    }
+}
+
+USERVER_NAMESPACE_END
@@ -1,5 +1,12 @@
 #include <server/websocket/protocol.hpp>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <array>
 #include <cstdlib>
 #include <cstring>
 
@@ -50,21 +57,6 @@ utils::span<T> MakeSpan(T* ptr, size_t count) {
     return utils::span<T>(ptr, ptr + count);
 }
 
-union Mask32 {
-    uint32_t mask32 = 0;
-    uint8_t mask8[4];
-};
-
-void XorMaskInplace(uint8_t* dest, size_t len, Mask32 mask) {
-    auto* dest32 = reinterpret_cast<uint32_t*>(dest);
-    while (len >= sizeof(uint32_t)) {
-        *(dest32++) ^= mask.mask32;
-        len -= sizeof(uint32_t);
-    }
-    auto* dest8 = reinterpret_cast<uint8_t*>(dest32);
-    for (unsigned i = 0; i < len; ++i) *(dest8++) ^= mask.mask8[i];
-}
-
 template <class T, class V>
 void PushRaw(const T& value, V& data) {
     const auto* valBytes = reinterpret_cast<const char*>(&value);
@@ -75,9 +67,14 @@ void PushRaw(const T& value, V& data) {
 
 namespace frames {
 
-boost::container::small_vector<char, impl::kMaxFrameHeaderSize>
-DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is_continuation, Final is_final) {
-    boost::container::small_vector<char, impl::kMaxFrameHeaderSize> frame;
+DataFrameHeaderBuffer DataFrameHeader(
+    utils::span<const std::byte> data,
+    bool is_text,
+    Continuation is_continuation,
+    Final is_final,
+    Compressed is_compressed
+) {
+    DataFrameHeaderBuffer frame;
 
     frame.resize(sizeof(WSHeader));
     auto* hdr = reinterpret_cast<WSHeader*>(frame.data());
@@ -86,7 +83,11 @@ DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is
     hdr->bytes = 0;
     hdr->bits.fin = is_final == Final::kYes ? 1 : 0;
     hdr->bits.opcode = is_text ? kText : kBinary;
-    if (is_continuation == Continuation::kYes) hdr->bits.opcode = kContinuation;
+    if (is_continuation == Continuation::kYes) {
+        hdr->bits.opcode = kContinuation;
+    } else if (is_compressed == Compressed::kYes) {
+        hdr->bits.reserved = kReservedCompressed;
+    }
 
     if (data.size() <= 125) {
         hdr->bits.payloadLen = data.size();
@@ -154,6 +155,40 @@ std::string WebsocketSecAnswer(std::string_view sec_key) {
     );
 }
 
+void XorMaskInplace(utils::span<char> payload, std::uint32_t mask) noexcept {
+    auto* data = payload.data();
+    const auto size = payload.size();
+    std::size_t i = 0;
+
+    // The mask repeats every 4 bytes, so it is applied to the whole words at
+    // once. Loads and stores are unaligned as frames start anywhere.
+#if defined(__AVX2__)
+    const auto mask256 = _mm256_set1_epi32(static_cast<int>(mask));
+    for (; i + sizeof(__m256i) <= size; i += sizeof(__m256i)) {
+        auto* chunk = reinterpret_cast<__m256i*>(data + i);
+        _mm256_storeu_si256(chunk, _mm256_xor_si256(_mm256_loadu_si256(chunk), mask256));
+    }
+#elif defined(__SSE2__)
+    const auto mask128 = _mm_set1_epi32(static_cast<int>(mask));
+    for (; i + sizeof(__m128i) <= size; i += sizeof(__m128i)) {
+        auto* chunk = reinterpret_cast<__m128i*>(data + i);
+        _mm_storeu_si128(chunk, _mm_xor_si128(_mm_loadu_si128(chunk), mask128));
+    }
+#endif
+
+    const std::uint64_t mask64 = (static_cast<std::uint64_t>(mask) << 32) | mask;
+    for (; i + sizeof(mask64) <= size; i += sizeof(mask64)) {
+        std::uint64_t chunk = 0;
+        std::memcpy(&chunk, data + i, sizeof(chunk));
+        chunk ^= mask64;
+        std::memcpy(data + i, &chunk, sizeof(chunk));
+    }
+
+    std::array<char, sizeof(mask)> mask_bytes{};
+    std::memcpy(mask_bytes.data(), &mask, sizeof(mask));
+    for (; i < size; ++i) data[i] ^= mask_bytes[i % sizeof(mask)];
+}
+
 CloseStatus ReadWSFrameImpl(
     WSHeader& hdr,
     FrameParserState& frame,
@@ -164,46 +199,68 @@ CloseStatus ReadWSFrameImpl(
     // we assume that the WSHeader has been read a while ago
     if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
-    const bool isDataFrame = (hdr.bits.opcode & (kText | kBinary)) || hdr.bits.opcode == kContinuation;
-    if (hdr.bits.payloadLen <= 125) {
-        payload_len = hdr.bits.payloadLen;
-    } else if (hdr.bits.payloadLen == 126) {
-        uint16_t payloadLen16 = 0;
-        RecvExactly(io, AsWritableBytes(MakeSpan(&payloadLen16, 1)), {});
-        payload_len = boost::endian::big_to_native(payloadLen16);
-    } else  // if (hdr.payloadLen == 127)
-    {
-        uint64_t payloadLen64 = 0;
-        RecvExactly(io, AsWritableBytes(MakeSpan(&payloadLen64, 1)), {});
-        payload_len = boost::endian::big_to_native(payloadLen64);
-    }
-    if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
-
+    const bool isDataFrame = hdr.bits.opcode < kClose;
+    const bool startsMessage = isDataFrame && hdr.bits.opcode != kContinuation;
     if (!isDataFrame && hdr.bits.payloadLen > 125) {
         // control frame should not have extended payload
         return CloseStatus::kProtocolError;
     }
+    if (hdr.bits.reserved != 0) {
+        // only permessage-deflate defines a reserved bit, in the first frame
+        // of a message
+        if (!frame.allow_compressed || !startsMessage || hdr.bits.reserved != kReservedCompressed) {
+            return CloseStatus::kProtocolError;
+        }
+    }
+    if (startsMessage) {
+        frame.is_text = hdr.bits.opcode == kText;
+        frame.is_compressed = hdr.bits.reserved == kReservedCompressed;
+    }
 
-    if (payload_len + frame.payload->size() > max_payload_size) return CloseStatus::kTooBigData;
+    // Extended payload length and masking key are read at once
+    std::size_t extLenSize = 0;
+    if (hdr.bits.payloadLen == 126) {
+        extLenSize = sizeof(std::uint16_t);
+    } else if (hdr.bits.payloadLen == 127) {
+        extLenSize = sizeof(std::uint64_t);
+    }
+    const std::size_t maskSize = hdr.bits.mask ? sizeof(std::uint32_t) : 0;
 
-    Mask32 mask;
-    if (hdr.bits.mask) RecvExactly(io, AsWritableBytes(MakeSpan(&mask, 1)), {});
+    std::array<char, sizeof(std::uint64_t) + sizeof(std::uint32_t)> hdrTail{};
+    if (extLenSize + maskSize > 0) RecvExactly(io, MakeSpan(hdrTail.data(), extLenSize + maskSize), {});
     if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
+    if (extLenSize == sizeof(std::uint16_t)) {
+        std::uint16_t payloadLen16 = 0;
+        std::memcpy(&payloadLen16, hdrTail.data(), sizeof(payloadLen16));
+        payload_len = boost::endian::big_to_native(payloadLen16);
+    } else if (extLenSize == sizeof(std::uint64_t)) {
+        std::uint64_t payloadLen64 = 0;
+        std::memcpy(&payloadLen64, hdrTail.data(), sizeof(payloadLen64));
+        payload_len = boost::endian::big_to_native(payloadLen64);
+    } else {
+        payload_len = hdr.bits.payloadLen;
+    }
+
+    if (payload_len + frame.payload->size() > max_payload_size) return CloseStatus::kTooBigData;
+
+    std::uint32_t mask = 0;
+    if (maskSize) std::memcpy(&mask, hdrTail.data() + extLenSize, sizeof(mask));
+
     if (payload_len > 0) {
-        if (isDataFrame) {
-            if (!frame.payload->empty() && hdr.bits.opcode != kContinuation) {
-                // non-continuation opcode while waiting continuation
-                return CloseStatus::kProtocolError;
-            }
+        if (startsMessage && !frame.payload->empty()) {
+            // non-continuation opcode while waiting continuation
+            return CloseStatus::kProtocolError;
         }
 
-        size_t newPayloadOffset = frame.payload->size();
-        frame.payload->resize(frame.payload->size() + payload_len);
-        RecvExactly(io, MakeSpan(frame.payload->data() + newPayloadOffset, payload_len), {});
+        const size_t newPayloadOffset = frame.payload->size();
+        frame.payload->resize(newPayloadOffset + payload_len);
+        const auto newPayload = MakeSpan(frame.payload->data() + newPayloadOffset, payload_len);
+        RecvExactly(io, newPayload, {});
         if (engine::current_task::ShouldCancel()) return CloseStatus::kGoingAway;
 
-        if (mask.mask32) XorMaskInplace(reinterpret_cast<uint8_t*>(frame.payload->data()), frame.payload->size(), mask);
+        // the previous frames of the message are unmasked already
+        if (mask) XorMaskInplace(newPayload, mask);
     }
     char opcode = hdr.bits.opcode;
     char fin = hdr.bits.fin;
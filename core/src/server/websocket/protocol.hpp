@@ -2,11 +2,14 @@
 
 #include <userver/server/websocket/server.hpp>
 
+#include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 
 #include <boost/container/small_vector.hpp>
 
+#include <server/websocket/deflate.hpp>
 #include <userver/engine/io/common.hpp>
 #include <userver/tracing/span.hpp>
 #include <userver/utils/span.hpp>
@@ -61,6 +64,10 @@ union WSHeader {
 
 static_assert(sizeof(WSHeader) == 2);
 
+// RSV1 bit of WSHeader::bits::reserved, marks the first frame of a compressed
+// message, RFC 7692 section 6
+constexpr inline unsigned char kReservedCompressed = 0x4;
+
 constexpr inline unsigned int kMaxFrameHeaderSize = sizeof(WSHeader) + sizeof(uint64_t);
 
 namespace frames {
@@ -75,8 +82,20 @@ enum class Final {
     kNo,
 };
 
-boost::container::small_vector<char, impl::kMaxFrameHeaderSize>
-DataFrameHeader(utils::span<const std::byte> data, bool is_text, Continuation is_continuation, Final is_final);
+enum class Compressed {
+    kYes,
+    kNo,
+};
+
+using DataFrameHeaderBuffer = boost::container::small_vector<char, impl::kMaxFrameHeaderSize>;
+
+DataFrameHeaderBuffer DataFrameHeader(
+    utils::span<const std::byte> data,
+    bool is_text,
+    Continuation is_continuation,
+    Final is_final,
+    Compressed is_compressed = Compressed::kNo
+);
 std::array<char, sizeof(WSHeader)> MakeControlFrame(WSOpcodes opcode, utils::span<const std::byte> data = {});
 std::string CloseFrame(CloseStatusInt status_code);
 
@@ -86,12 +105,18 @@ const std::array<char, sizeof(WSHeader)>& CloseFrame();
 
 std::string WebsocketSecAnswer(std::string_view sec_key);
 
+// Applies the client masking key (in the network byte order) to the frame payload
+void XorMaskInplace(utils::span<char> payload, std::uint32_t mask) noexcept;
+
 struct FrameParserState {
     bool closed = false;
     bool ping_received = false;
     bool pong_received = false;
     bool waiting_continuation = false;
     bool is_text = false;
+    // permessage-deflate is negotiated, compressed messages are allowed
+    bool allow_compressed = false;
+    bool is_compressed = false;
     CloseStatusInt remote_close_status = 0;
     size_t offset_when_noblock = 0;
 
@@ -108,6 +133,13 @@ std::optional<CloseStatus> ReadWSFrameDontWaitForHeader(
     std::size_t& payload_len
 );
 
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name,
+    const Config& config,
+    const std::optional<DeflateParams>& deflate_params
+);
+
 }  // namespace server::websocket::impl
 
 USERVER_NAMESPACE_END
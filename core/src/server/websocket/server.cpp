@@ -1,5 +1,8 @@
 #include <userver/server/websocket/server.hpp>
 
+#include <algorithm>
+#include <vector>
+
 #include <userver/components/component.hpp>
 #include <userver/engine/mutex.hpp>
 #include <userver/logging/log.hpp>
@@ -25,12 +28,29 @@ Message CloseMessage(CloseStatus status) { return {{}, status, false}; }
 
 utils::span<const std::byte> MakeBinarySpan(utils::span<const char> span) { return utils::as_bytes(span); }
 
+// Data frames of a message are sent by vectored writes of up to this number of
+// frames, two IoData per frame
+constexpr std::size_t kMaxFramesPerWrite = 32;
+
 }  // namespace
 
+DeflateConfig Parse(const yaml_config::YamlConfig& config, formats::parse::To<DeflateConfig>) {
+    const DeflateConfig defaults;
+    return {
+        config["enabled"].As<bool>(defaults.enabled),
+        config["server-no-context-takeover"].As<bool>(defaults.server_no_context_takeover),
+        config["client-no-context-takeover"].As<bool>(defaults.client_no_context_takeover),
+        config["server-max-window-bits"].As<int>(defaults.server_max_window_bits),
+        config["compression-level"].As<int>(defaults.compression_level),
+        config["min-message-size"].As<unsigned>(defaults.min_message_size),
+    };
+}
+
 Config Parse(const yaml_config::YamlConfig& config, formats::parse::To<Config>) {
     return {
         config["max-remote-payload"].As<unsigned>(65536),
         config["fragment-size"].As<unsigned>(65536),
+        config["permessage-deflate"].As<DeflateConfig>(DeflateConfig{}),
     };
 }
 
@@ -59,13 +79,31 @@ private:
 
     Config config;
 
+    // Compression contexts if permessage-deflate is negotiated
+    std::optional<impl::MessageDeflate> deflate_;
+
+    // Buffers reused by the messages, guarded by write_mutex_
+    std::string compressed_message_;
+    std::vector<impl::frames::DataFrameHeaderBuffer> frame_headers_;
+    std::vector<engine::io::IoData> write_list_;
+
+    // Decompressed message buffer, swapped with the buffer of the received
+    // message. Used by the single reading task.
+    std::string decompressed_message_;
+
 public:
     WebSocketConnectionImpl(
         std::unique_ptr<engine::io::RwBase> io_,
         const engine::io::Sockaddr& remote_addr,
-        const Config& server_config
+        const Config& server_config,
+        const std::optional<impl::DeflateParams>& deflate_params
     )
-        : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {}
+        : io(std::move(io_)), remote_addr_(remote_addr), config(server_config) {
+        if (deflate_params) {
+            deflate_.emplace(*deflate_params, config.deflate.compression_level);
+            frame_.allow_compressed = true;
+        }
+    }
 
     ~WebSocketConnectionImpl() override { LOG_TRACE() << "Websocket connection closed"; }
 
@@ -85,23 +123,55 @@ public:
             const auto close_frame = impl::frames::CloseFrame(static_cast<int>(message.close_status.value()));
             SendExactly(*io, close_frame, {});
         } else if (!message.data.empty()) {
-            utils::span<const std::byte> data_to_send{message.data};
-            auto continuation = impl::frames::Continuation::kNo;
-            while (data_to_send.size() > config.fragment_size && config.fragment_size > 0) {
-                const auto data_frame_header = impl::frames::DataFrameHeader(
-                    data_to_send.first(config.fragment_size),
-                    message.opcode == impl::WSOpcodes::kText,
+            SendDataFrames(message.data, message.opcode == impl::WSOpcodes::kText);
+        }
+    }
+
+    // write_mutex_ must be locked, the messages are compressed in the order
+    // they are sent
+    void SendDataFrames(utils::span<const std::byte> data, bool is_text) {
+        auto compressed = impl::frames::Compressed::kNo;
+        if (deflate_ && data.size() >= config.deflate.min_message_size) {
+            deflate_->Compress(data, compressed_message_);
+            data = MakeBinarySpan(compressed_message_);
+            compressed = impl::frames::Compressed::kYes;
+        }
+
+        const std::size_t fragment_size = config.fragment_size > 0 ? config.fragment_size : data.size();
+        auto continuation = impl::frames::Continuation::kNo;
+        while (!data.empty()) {
+            const auto batch = data.first(std::min(data.size(), fragment_size * kMaxFramesPerWrite));
+            data = data.subspan(batch.size());
+
+            frame_headers_.clear();
+            for (std::size_t offset = 0; offset < batch.size(); offset += fragment_size) {
+                const auto payload = batch.subspan(offset, std::min(fragment_size, batch.size() - offset));
+                const bool is_final = data.empty() && offset + payload.size() == batch.size();
+                frame_headers_.push_back(impl::frames::DataFrameHeader(
+                    payload,
+                    is_text,
                     continuation,
-                    impl::frames::Final::kNo
-                );
-                SendExactly(*io, data_frame_header, data_to_send.first(config.fragment_size));
+                    is_final ? impl::frames::Final::kYes : impl::frames::Final::kNo,
+                    compressed
+                ));
                 continuation = impl::frames::Continuation::kYes;
-                data_to_send = data_to_send.last(data_to_send.size() - config.fragment_size);
             }
-            const auto data_frame_header = impl::frames::DataFrameHeader(
-                data_to_send, message.opcode == impl::WSOpcodes::kText, continuation, impl::frames::Final::kYes
-            );
-            SendExactly(*io, data_frame_header, data_to_send);
+
+            // the headers are complete, so the pointers to them are stable
+            write_list_.clear();
+            std::size_t offset = 0;
+            std::size_t bytes_to_send = 0;
+            for (const auto& header : frame_headers_) {
+                const auto payload_size = std::min(fragment_size, batch.size() - offset);
+                write_list_.push_back({header.data(), header.size()});
+                write_list_.push_back({batch.data() + offset, payload_size});
+                offset += payload_size;
+                bytes_to_send += header.size() + payload_size;
+            }
+
+            if (io->WriteAll(write_list_.data(), write_list_.size(), {}) != bytes_to_send) {
+                throw(engine::io::IoException() << "Socket closed during transfer");
+            }
         }
     }
 
@@ -177,6 +247,19 @@ public:
             }
             if (frame_.waiting_continuation) continue;
 
+            if (frame_.is_compressed) {
+                UASSERT(deflate_);
+                const auto decompress_status =
+                    deflate_->Decompress(msg.data, decompressed_message_, config.max_remote_payload);
+                if (decompress_status != CloseStatus::kNone) {
+                    MessageExtended close_msg{{}, impl::WSOpcodes::kClose, decompress_status};
+                    SendExtended(close_msg);
+                    msg = CloseMessage(decompress_status);
+                    return true;
+                }
+                msg.data.swap(decompressed_message_);
+            }
+
             msg.is_text = frame_.is_text;
             stats_.msg_recv++;
             stats_.bytes_recv += msg.data.size();
@@ -219,9 +302,22 @@ WebSocketConnection::~WebSocketConnection() = default;
 
 std::shared_ptr<WebSocketConnection>
 MakeWebSocket(std::unique_ptr<engine::io::RwBase>&& socket, engine::io::Sockaddr&& peer_name, const Config& config) {
-    return std::make_shared<WebSocketConnectionImpl>(std::move(socket), std::move(peer_name), config);
+    return impl::MakeWebSocket(std::move(socket), std::move(peer_name), config, {});
+}
+
+namespace impl {
+
+std::shared_ptr<WebSocketConnection> MakeWebSocket(
+    std::unique_ptr<engine::io::RwBase>&& socket,
+    engine::io::Sockaddr&& peer_name,
+    const Config& config,
+    const std::optional<DeflateParams>& deflate_params
+) {
+    return std::make_shared<WebSocketConnectionImpl>(std::move(socket), std::move(peer_name), config, deflate_params);
 }
 
+}  // namespace impl
+
 }  // namespace server::websocket
 
 USERVER_NAMESPACE_END
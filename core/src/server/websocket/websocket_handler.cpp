@@ -68,10 +68,21 @@ std::string WebsocketHandlerBase::HandleRequestThrow(
         USERVER_NAMESPACE::http::headers::kWebsocketAccept, websocket::impl::WebsocketSecAnswer(secWebsocketKey)
     );
 
+    auto deflate_params = websocket::impl::NegotiateDeflate(
+        request.GetHeader(USERVER_NAMESPACE::http::headers::kWebsocketExtensions), config_.deflate
+    );
+    if (deflate_params) {
+        response.SetHeader(
+            USERVER_NAMESPACE::http::headers::kWebsocketExtensions,
+            websocket::impl::MakeDeflateResponseHeader(*deflate_params)
+        );
+    }
+
     request.SetUpgradeWebsocket([context = std::make_shared<server::request::RequestContext>(std::move(context)),
+                                 deflate_params,
                                  this](std::unique_ptr<engine::io::RwBase> socket, engine::io::Sockaddr&& peer_name) {
         tracing::Span span("ws/" + HandlerName());
-        auto ws = websocket::MakeWebSocket(std::move(socket), std::move(peer_name), config_);
+        auto ws = websocket::impl::MakeWebSocket(std::move(socket), std::move(peer_name), config_, deflate_params);
         try {
             Handle(*ws, *context);
         } catch (const std::exception& e) {
@@ -106,6 +117,39 @@ properties:
         type: integer
         description: max output fragment size
         defaultDescription: 65536
+    permessage-deflate:
+        type: object
+        description: permessage-deflate compression extension settings (RFC 7692)
+        additionalProperties: false
+        properties:
+            enabled:
+                type: boolean
+                description: accept the compression offered by clients
+                defaultDescription: false
+            server-no-context-takeover:
+                type: boolean
+                description: reset the compressor after each message to save memory
+                defaultDescription: false
+            client-no-context-takeover:
+                type: boolean
+                description: ask the clients to reset their compressors after each message
+                defaultDescription: false
+            server-max-window-bits:
+                type: integer
+                description: compressor window size, log2
+                defaultDescription: 15
+                minimum: 9
+                maximum: 15
+            compression-level:
+                type: integer
+                description: zlib compression level
+                defaultDescription: 6
+                minimum: 1
+                maximum: 9
+            min-message-size:
+                type: integer
+                description: smaller messages are sent uncompressed
+                defaultDescription: 128
 )");
 }
 
@@ -4,6 +4,7 @@
 /// @brief Client for any S3 api service
 
 #include <chrono>
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_set>
@@ -20,6 +21,7 @@ USERVER_NAMESPACE_BEGIN
 
 namespace clients::http {
 class Client;
+class ResponseBodySink;
 }
 
 /// @brief Top namespace for S3 library.
@@ -130,6 +132,17 @@ public:
         const HeaderDataRequest& headers_request = HeaderDataRequest()
     ) const = 0;
 
+    /// @brief Writes the object right into the sink, e.g. into a caller-provided
+    /// buffer of clients::http::BufferBodySink, without accumulating it in a
+    /// string. Throws on errors, as TryGetObject() does.
+    virtual void TryGetObjectToSink(
+        std::string_view path,
+        std::shared_ptr<clients::http::ResponseBodySink> sink,
+        std::optional<std::string> version = std::nullopt,
+        HeadersDataResponse* headers_data = nullptr,
+        const HeaderDataRequest& headers_request = HeaderDataRequest()
+    ) const = 0;
+
     virtual std::optional<std::string> GetPartialObject(
         std::string_view path,
         std::string_view range,
@@ -10,6 +10,7 @@
 #include <userver/http/url.hpp>
 #include <userver/logging/log.hpp>
 #include <userver/utils/algo.hpp>
+#include <userver/utils/assert.hpp>
 #include <userver/utils/exception.hpp>
 
 #include <userver/s3api/authenticators/access_key.hpp>
@@ -232,6 +233,18 @@ std::string ClientImpl::TryGetObject(
     return RequestApi(req, "get_object", headers_data, headers_request);
 }
 
+void ClientImpl::TryGetObjectToSink(
+    std::string_view path,
+    std::shared_ptr<clients::http::ResponseBodySink> sink,
+    std::optional<std::string> version,
+    HeadersDataResponse* headers_data,
+    const HeaderDataRequest& headers_request
+) const {
+    UINVARIANT(sink, "The sink for the object is not set");
+    auto req = api_methods::GetObject(bucket_, path, std::move(version));
+    RequestApi(req, "get_object", headers_data, headers_request, std::move(sink));
+}
+
 std::optional<std::string> ClientImpl::GetPartialObject(
     std::string_view path,
     std::string_view range,
@@ -354,11 +367,12 @@ std::string ClientImpl::RequestApi(
     Request& request,
     std::string_view method_name,
     HeadersDataResponse* headers_data,
-    const HeaderDataRequest& headers_request
+    const HeaderDataRequest& headers_request,
+    std::shared_ptr<clients::http::ResponseBodySink> body_sink
 ) const {
     Auth(request);
 
-    auto response = conn_->RequestApi(request, method_name);
+    auto response = conn_->RequestApi(request, method_name, std::move(body_sink));
 
     if (headers_data) {
         if (headers_request.need_meta) {
@@ -376,7 +390,8 @@ std::string ClientImpl::RequestApi(
         }
     }
 
-    return response->body();
+    // The body of an object may be large, do not copy it
+    return std::move(*response).body();
 }
 
 std::optional<std::string>
@@ -72,6 +72,14 @@ public:
         const HeaderDataRequest& headers_request
     ) const final;
 
+    void TryGetObjectToSink(
+        std::string_view path,
+        std::shared_ptr<clients::http::ResponseBodySink> sink,
+        std::optional<std::string> version,
+        HeadersDataResponse* headers_data,
+        const HeaderDataRequest& headers_request
+    ) const final;
+
     std::optional<std::string> GetPartialObject(
         std::string_view path,
         std::string_view range,
@@ -133,7 +141,8 @@ private:
         Request& request,
         std::string_view method_name,
         HeadersDataResponse* headers_data = nullptr,
-        const HeaderDataRequest& headers_request = HeaderDataRequest()
+        const HeaderDataRequest& headers_request = HeaderDataRequest(),
+        std::shared_ptr<clients::http::ResponseBodySink> body_sink = nullptr
     ) const;
 
     std::shared_ptr<S3Connection> conn_;
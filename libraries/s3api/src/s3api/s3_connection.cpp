@@ -31,7 +31,11 @@ GetMethod(clients::http::Request& req, std::string_view url, std::string_view bo
 }
 }  // namespace
 
-std::shared_ptr<clients::http::Response> S3Connection::RequestApi(Request& r, std::string_view method_name) {
+std::shared_ptr<clients::http::Response> S3Connection::RequestApi(
+    Request& r,
+    std::string_view method_name,
+    std::shared_ptr<clients::http::ResponseBodySink> body_sink
+) {
     if (!r.bucket.empty()) {
         r.headers[USERVER_NAMESPACE::http::headers::kHost] = r.bucket + "." + api_url_;
     } else {
@@ -51,6 +55,9 @@ std::shared_ptr<clients::http::Response> S3Connection::RequestApi(Request& r, st
     http_req.SetDestinationMetricName(
         fmt::format("{}/{}", r.headers[USERVER_NAMESPACE::http::headers::kHost], method_name)
     );
+    if (body_sink) {
+        http_req.response_body_sink(std::move(body_sink));
+    }
     std::shared_ptr<clients::http::Response> response;
     try {
         response = GetMethod(http_req, full_url, r.body, r.method).perform();
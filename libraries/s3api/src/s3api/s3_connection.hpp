@@ -38,7 +38,12 @@ public:
 
     ~S3Connection() = default;
 
-    std::shared_ptr<clients::http::Response> RequestApi(Request& r, std::string_view method_name);
+    // The body goes to the body_sink instead of the response if it is set
+    std::shared_ptr<clients::http::Response> RequestApi(
+        Request& r,
+        std::string_view method_name,
+        std::shared_ptr<clients::http::ResponseBodySink> body_sink = nullptr
+    );
 
     std::shared_ptr<clients::http::Response> DoStartApiRequest(const Request& r) const;
 
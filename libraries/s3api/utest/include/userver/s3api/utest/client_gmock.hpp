@@ -45,6 +45,17 @@ public:
         (const, override)
     );
 
+    MOCK_METHOD(
+        void,
+        TryGetObjectToSink,
+        (std::string_view path,
+         std::shared_ptr<clients::http::ResponseBodySink> sink,
+         std::optional<std::string> version,
+         HeadersDataResponse* headers_data,
+         const HeaderDataRequest& headers_request),
+        (const, override)
+    );
+
     MOCK_METHOD(
         std::optional<std::string>,
         GetPartialObject,
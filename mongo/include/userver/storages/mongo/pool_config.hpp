@@ -9,7 +9,7 @@
 #include <string>
 
 #include <userver/components/component_fwd.hpp>
-#include <userver/congestion_control/controllers/linear.hpp>
+#include <userver/congestion_control/controllers/factory.hpp>
 
 USERVER_NAMESPACE_BEGIN
 
@@ -96,7 +96,7 @@ struct PoolConfig final {
     StatsVerbosity stats_verbosity = StatsVerbosity::kTerse;
 
     /// Congestion control config
-    congestion_control::v2::LinearController::StaticConfig cc_config;
+    congestion_control::v2::StaticConfig cc_config;
 };
 
 PoolConfig Parse(const yaml_config::YamlConfig& config, formats::parse::To<PoolConfig>);
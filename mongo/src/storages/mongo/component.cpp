@@ -5,6 +5,7 @@
 #include <userver/clients/dns/resolver_utils.hpp>
 #include <userver/components/component.hpp>
 #include <userver/components/statistics_storage.hpp>
+#include <userver/congestion_control/controllers/factory.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/storages/mongo/exception.hpp>
 #include <userver/storages/mongo/pool_config.hpp>
@@ -128,7 +129,7 @@ bool MultiMongo::RemovePool(const std::string& dbalias) { return multi_mongo_.Re
 storages::mongo::MultiMongo::PoolSet MultiMongo::NewPoolSet() { return multi_mongo_.NewPoolSet(); }
 
 yaml_config::Schema MultiMongo::GetStaticConfigSchema() {
-    return yaml_config::MergeSchemas<ComponentBase>(R"(
+    auto schema = yaml_config::MergeSchemas<ComponentBase>(R"(
 type: object
 description: Dynamically configurable MongoDB client component
 additionalProperties: false
@@ -187,20 +188,11 @@ properties:
         enum:
           - getaddrinfo
           - async
-    congestion_control:
-        description: congestion control settings
-        type: object
-        additionalProperties: false
-        properties:
-            fake-mode:
-                type: boolean
-                description: whether CC limiter is actually working
-                defaultDescription: false
-            enabled:
-                type: boolean
-                description: whether CC is enabled for the database
-                defaultDescription: true
 )");
+    schema.properties->emplace(
+        "congestion_control", yaml_config::SchemaPtr{congestion_control::v2::GetStaticConfigSchema()}
+    );
+    return schema;
 }
 
 }  // namespace components
@@ -86,7 +86,7 @@ PoolConfig Parse(const yaml_config::YamlConfig& config, formats::parse::To<PoolC
     result.max_replication_lag = config["max_replication_lag"].As<std::optional<std::chrono::seconds>>();
     result.driver_impl = config["driver"].As<PoolConfig::DriverImpl>(result.driver_impl);
     result.stats_verbosity = config["stats_verbosity"].As<StatsVerbosity>(result.stats_verbosity);
-    result.cc_config = config["congestion_control"].As<congestion_control::v2::LinearController::StaticConfig>();
+    result.cc_config = config["congestion_control"].As<congestion_control::v2::StaticConfig>();
     result.pool_settings = config.As<PoolSettings>();
 
     return result;
@@ -14,7 +14,7 @@ PoolImpl::PoolImpl(std::string&& id, const PoolConfig& static_config, dynamic_co
       config_source_(config_source),
       cc_sensor_(*this),
       cc_limiter_(*this),
-      cc_controller_(
+      cc_controller_(congestion_control::v2::MakeController(
           id_,
           cc_sensor_,
           cc_limiter_,
@@ -22,22 +22,22 @@ PoolImpl::PoolImpl(std::string&& id, const PoolConfig& static_config, dynamic_co
           static_config.cc_config,
           config_source,
           [](const dynamic_config::Snapshot& config) { return config[kCcConfig]; }
-      ) {}
+      )) {}
 
 void PoolImpl::Start() {
     config_subscriber_ = config_source_.UpdateAndListen(this, "mongo_pool", &PoolImpl::OnConfigUpdate);
-    cc_controller_.Start();
+    cc_controller_->Start();
 }
 
 void PoolImpl::Stop() noexcept {
-    cc_controller_.Stop();
+    cc_controller_->Stop();
     config_subscriber_.Unsubscribe();
 }
 
 void PoolImpl::OnConfigUpdate(const dynamic_config::Snapshot& config) {
     bool cc_enabled =
         config[kCongestionControlDatabasesSettings].GetOptional(id_).value_or(config[kCongestionControlEnabled]);
-    cc_controller_.SetEnabled(cc_enabled);
+    cc_controller_->SetEnabled(cc_enabled);
 
     const auto new_pool_settings = config[kPoolSettings].GetOptional(id_);
     if (new_pool_settings.has_value()) {
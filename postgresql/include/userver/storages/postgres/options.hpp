@@ -10,7 +10,7 @@
 #include <string>
 #include <unordered_map>
 
-#include <userver/congestion_control/controllers/linear.hpp>
+#include <userver/congestion_control/controllers/factory.hpp>
 #include <userver/storages/postgres/postgres_fwd.hpp>
 #include <userver/utils/impl/transparent_hash.hpp>
 #include <userver/utils/str_icase.hpp>
@@ -315,7 +315,7 @@ struct ClusterSettings {
     ConnlimitMode connlimit_mode = ConnlimitMode::kAuto;
 
     /// congestion control settings
-    congestion_control::v2::LinearController::StaticConfig cc_config;
+    congestion_control::v2::StaticConfig cc_config;
 };
 
 }  // namespace storages::postgres
@@ -9,6 +9,7 @@
 #include <userver/clients/dns/resolver_utils.hpp>
 #include <userver/components/component.hpp>
 #include <userver/components/statistics_storage.hpp>
+#include <userver/congestion_control/controllers/factory.hpp>
 #include <userver/dynamic_config/storage/component.hpp>
 #include <userver/engine/task/task_processor_fwd.hpp>
 #include <userver/error_injection/settings.hpp>
@@ -83,6 +84,7 @@ Postgres::Postgres(const ComponentConfig& config, const ComponentContext& contex
                                                                       : storages::postgres::InitMode::kAsync;
     initial_settings_.db_name = db_name_;
     initial_settings_.connlimit_mode = ParseConnlimitMode(config["connlimit_mode"].As<std::string>("auto"));
+    initial_settings_.cc_config = config["congestion_control"].As<congestion_control::v2::StaticConfig>();
 
     initial_settings_.topology_settings.max_replication_lag =
         config["max_replication_lag"].As<std::chrono::milliseconds>(storages::postgres::kDefaultMaxReplicationLag);
@@ -205,7 +207,7 @@ void Postgres::OnSecdistUpdate(const storages::secdist::SecdistConfig& secdist)
 }
 
 yaml_config::Schema Postgres::GetStaticConfigSchema() {
-    return yaml_config::MergeSchemas<ComponentBase>(R"(
+    auto schema = yaml_config::MergeSchemas<ComponentBase>(R"(
 type: object
 description: PosgreSQL client component
 additionalProperties: false
@@ -324,6 +326,10 @@ properties:
          - manual
         description: how to learn the `max_pool_size`
 )");
+    schema.properties->emplace(
+        "congestion_control", yaml_config::SchemaPtr{congestion_control::v2::GetStaticConfigSchema()}
+    );
+    return schema;
 }
 
 }  // namespace components
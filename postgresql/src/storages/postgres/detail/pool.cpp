@@ -82,7 +82,7 @@ ConnectionPool::ConnectionPool(
     const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     error_injection::Settings ei_settings,
-    const congestion_control::v2::LinearController::StaticConfig& cc_config,
+    const congestion_control::v2::StaticConfig& cc_config,
     dynamic_config::Source config_source
 )
     : dsn_{std::move(dsn)},
@@ -105,7 +105,7 @@ ConnectionPool::ConnectionPool(
       config_source_(config_source),
       cc_sensor_(*this),
       cc_limiter_(*this),
-      cc_controller_(
+      cc_controller_(congestion_control::v2::MakeController(
           "postgres" + db_name,
           cc_sensor_,
           cc_limiter_,
@@ -113,9 +113,9 @@ ConnectionPool::ConnectionPool(
           cc_config,
           config_source,
           [](const dynamic_config::Snapshot& config) { return config[kCcConfig]; }
-      ) {
+      )) {
     if (USERVER_NAMESPACE::utils::impl::kPgCcExperiment.IsEnabled()) {
-        cc_controller_.Start();
+        cc_controller_->Start();
     }
 }
 
@@ -137,7 +137,7 @@ std::shared_ptr<ConnectionPool> ConnectionPool::Create(
     const DefaultCommandControls& default_cmd_ctls,
     const testsuite::PostgresControl& testsuite_pg_ctl,
     error_injection::Settings ei_settings,
-    const congestion_control::v2::LinearController::StaticConfig& cc_config,
+    const congestion_control::v2::StaticConfig& cc_config,
     dynamic_config::Source config_source
 ) {
     // FP?: pointer magic in boost.lockfree